@@ -13,6 +13,23 @@
 
 namespace flutter {  // namespace
 
+namespace {
+
+// Mixes |value| into |seed|, following boost::hash_combine.
+void HashCombine(uint64_t& seed, uint64_t value) {
+  seed ^= value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+}
+
+void HashCombine(uint64_t& seed, double value) {
+  HashCombine(seed, static_cast<uint64_t>(std::hash<double>{}(value)));
+}
+
+void HashCombine(uint64_t& seed, const std::string& value) {
+  HashCombine(seed, static_cast<uint64_t>(std::hash<std::string>{}(value)));
+}
+
+}  // namespace
+
 constexpr int kHasScrollingAction =
     FlutterSemanticsAction::kFlutterSemanticsActionScrollLeft |
     FlutterSemanticsAction::kFlutterSemanticsActionScrollRight |
@@ -59,15 +76,27 @@ void AccessibilityBridge::CommitUpdates() {
       CreateRemoveReparentedNodesUpdate();
   if (remove_reparented.has_value()) {
     tree_->Unserialize(remove_reparented.value());
+    tree_generation_++;
 
     std::string error = tree_->error();
     if (!error.empty()) {
       FML_LOG(ERROR) << "Failed to update ui::AXTree, error: " << error;
       assert(false);
+      node_fingerprints_.clear();
       return;
     }
   }
 
+  // The framework often resends nodes that haven't changed. Such updates are
+  // dropped before being converted. Reparenting recreates the moved subtrees,
+  // so every update is applied in that case.
+  FingerprintPendingNodeUpdates(skip_unchanged_node_updates_ &&
+                                !remove_reparented.has_value());
+  if (pending_semantics_node_updates_.empty()) {
+    pending_semantics_custom_action_updates_.clear();
+    return;
+  }
+
   // Second, apply the pending node updates. This also moves reparented nodes to
   // their new parents if needed.
   ui::AXTreeUpdate update{.tree_data = tree_->data()};
@@ -80,40 +109,49 @@ void AccessibilityBridge::CommitUpdates() {
   // lists in the reversed order, this guarantees parent updates always come
   // before child updates. If the root is in the update, it is guaranteed to
   // be the first node of the last list.
-  std::vector<std::vector<SemanticsNode>> results;
+  update.nodes.reserve(pending_semantics_node_updates_.size());
+  subtree_list_.clear();
+  subtree_list_starts_.clear();
   while (!pending_semantics_node_updates_.empty()) {
-    auto begin = pending_semantics_node_updates_.begin();
-    SemanticsNode target = begin->second;
-    std::vector<SemanticsNode> sub_tree_list;
-    GetSubTreeList(target, sub_tree_list);
-    results.push_back(sub_tree_list);
-    pending_semantics_node_updates_.erase(begin);
-  }
-
-  for (size_t i = results.size(); i > 0; i--) {
-    for (const SemanticsNode& node : results[i - 1]) {
-      ConvertFlutterUpdate(node, update);
-    }
+    subtree_list_starts_.push_back(subtree_list_.size());
+    MoveSubTreeToList(pending_semantics_node_updates_.begin()->first);
   }
 
   // The first update must set the tree's root, which is guaranteed to be the
   // last list's first node. A tree's root node never changes, though it can be
   // modified.
-  if (!results.empty() && GetRootAsAXNode()->id() == ui::AXNode::kInvalidAXID) {
-    FML_DCHECK(!results.back().empty());
+  if (!subtree_list_starts_.empty() &&
+      GetRootAsAXNode()->id() == ui::AXNode::kInvalidAXID) {
+    update.root_id = subtree_list_[subtree_list_starts_.back()].id;
+  }
 
-    update.root_id = results.back().front().id;
+  size_t list_end = subtree_list_.size();
+  for (size_t i = subtree_list_starts_.size(); i > 0; i--) {
+    size_t list_start = subtree_list_starts_[i - 1];
+    for (size_t j = list_start; j < list_end; j++) {
+      ConvertFlutterUpdate(std::move(subtree_list_[j]), update);
+    }
+    list_end = list_start;
   }
+  subtree_list_.clear();
 
   tree_->Unserialize(update);
+  tree_generation_++;
   pending_semantics_node_updates_.clear();
   pending_semantics_custom_action_updates_.clear();
 
   std::string error = tree_->error();
   if (!error.empty()) {
     FML_LOG(ERROR) << "Failed to update ui::AXTree, error: " << error;
+    // The tree may be partially updated.
+    node_fingerprints_.clear();
     return;
   }
+  for (const auto& [id, fingerprint] : pending_node_fingerprints_) {
+    node_fingerprints_[id] = fingerprint;
+  }
+  pending_node_fingerprints_.clear();
+
   // Handles accessibility events as the result of the semantics update.
   for (const auto& targeted_event : event_generator_) {
     auto event_target =
@@ -142,6 +180,11 @@ const ui::AXTreeData& AccessibilityBridge::GetAXTreeData() const {
   return tree_->data();
 }
 
+void AccessibilityBridge::SetEnabledEvents(
+    const ui::AXEventGenerator::EventSet& events) {
+  event_generator_.SetEnabledEvents(events);
+}
+
 const std::vector<ui::AXEventGenerator::TargetedEvent>
 AccessibilityBridge::GetPendingEvents() const {
   std::vector<ui::AXEventGenerator::TargetedEvent> result(
@@ -189,6 +232,7 @@ void AccessibilityBridge::OnNodeDeleted(ui::AXTree* tree,
   if (id_wrapper_map_.find(node_id) != id_wrapper_map_.end()) {
     id_wrapper_map_.erase(node_id);
   }
+  node_fingerprints_.erase(node_id);
 }
 
 void AccessibilityBridge::OnAtomicUpdateFinished(
@@ -259,7 +303,8 @@ AccessibilityBridge::CreateRemoveReparentedNodesUpdate() {
       .nodes = std::vector<ui::AXNodeData>(),
   };
 
-  for (std::pair<int32_t, ui::AXNodeData> data : updates) {
+  update.nodes.reserve(updates.size());
+  for (auto& data : updates) {
     update.nodes.push_back(std::move(data.second));
   }
 
@@ -267,22 +312,122 @@ AccessibilityBridge::CreateRemoveReparentedNodesUpdate() {
 }
 
 // Private method.
-void AccessibilityBridge::GetSubTreeList(const SemanticsNode& target,
-                                         std::vector<SemanticsNode>& result) {
-  result.push_back(target);
-  for (int32_t child : target.children_in_traversal_order) {
-    auto iter = pending_semantics_node_updates_.find(child);
-    if (iter != pending_semantics_node_updates_.end()) {
-      SemanticsNode node = iter->second;
-      GetSubTreeList(node, result);
-      pending_semantics_node_updates_.erase(iter);
+void AccessibilityBridge::FingerprintPendingNodeUpdates(bool skip_unchanged) {
+  pending_node_fingerprints_.clear();
+  for (auto iter = pending_semantics_node_updates_.begin();
+       iter != pending_semantics_node_updates_.end();) {
+    const SemanticsNode& node = iter->second;
+    uint64_t fingerprint = ComputeFingerprint(node);
+    // A focused text field also updates the tree's selection, which may have
+    // been changed by another node.
+    bool updates_tree_data =
+        node.flags->is_text_field &&
+        node.flags->is_focused == FlutterTristate::kFlutterTristateTrue;
+    if (skip_unchanged && !updates_tree_data && tree_->GetFromId(node.id)) {
+      auto previous = node_fingerprints_.find(node.id);
+      if (previous != node_fingerprints_.end() &&
+          previous->second == fingerprint) {
+        iter = pending_semantics_node_updates_.erase(iter);
+        skipped_node_update_count_++;
+        continue;
+      }
+    }
+    pending_node_fingerprints_.emplace_back(node.id, fingerprint);
+    applied_node_update_count_++;
+    ++iter;
+  }
+}
+
+uint64_t AccessibilityBridge::ComputeFingerprint(
+    const SemanticsNode& node) const {
+  const FlutterSemanticsFlags* flags = node.flags;
+  FML_DCHECK(flags) << "SemanticsNode::flags must not be null";
+  uint64_t fingerprint = 0;
+  HashCombine(fingerprint, static_cast<uint64_t>(flags->is_checked));
+  for (FlutterTristate tristate :
+       {flags->is_selected, flags->is_enabled, flags->is_toggled,
+        flags->is_expanded, flags->is_required, flags->is_focused}) {
+    HashCombine(fingerprint, static_cast<uint64_t>(tristate));
+  }
+  uint64_t bits = 0;
+  for (bool flag :
+       {flags->is_button, flags->is_text_field,
+        flags->is_in_mutually_exclusive_group, flags->is_header,
+        flags->is_obscured, flags->scopes_route, flags->names_route,
+        flags->is_hidden, flags->is_image, flags->is_live_region,
+        flags->has_implicit_scrolling, flags->is_multiline,
+        flags->is_read_only, flags->is_link, flags->is_slider,
+        flags->is_keyboard_key}) {
+    bits = (bits << 1) | flag;
+  }
+  HashCombine(fingerprint, bits);
+  HashCombine(fingerprint, static_cast<uint64_t>(node.actions));
+  HashCombine(fingerprint, static_cast<uint64_t>(node.text_selection_base));
+  HashCombine(fingerprint, static_cast<uint64_t>(node.text_selection_extent));
+  HashCombine(fingerprint, static_cast<uint64_t>(node.scroll_child_count));
+  HashCombine(fingerprint, static_cast<uint64_t>(node.scroll_index));
+  HashCombine(fingerprint, node.scroll_position);
+  HashCombine(fingerprint, node.scroll_extent_max);
+  HashCombine(fingerprint, node.scroll_extent_min);
+  HashCombine(fingerprint, node.label);
+  HashCombine(fingerprint, node.hint);
+  HashCombine(fingerprint, node.value);
+  HashCombine(fingerprint, node.increased_value);
+  HashCombine(fingerprint, node.decreased_value);
+  HashCombine(fingerprint, node.tooltip);
+  HashCombine(fingerprint, static_cast<uint64_t>(node.text_direction));
+  for (double value : {node.rect.left, node.rect.top, node.rect.right,
+                       node.rect.bottom}) {
+    HashCombine(fingerprint, value);
+  }
+  const FlutterTransformation& transform = node.transform;
+  for (double value :
+       {transform.scaleX, transform.skewX, transform.transX, transform.skewY,
+        transform.scaleY, transform.transY, transform.pers0, transform.pers1,
+        transform.pers2}) {
+    HashCombine(fingerprint, value);
+  }
+  HashCombine(fingerprint,
+              static_cast<uint64_t>(node.children_in_traversal_order.size()));
+  for (int32_t child : node.children_in_traversal_order) {
+    HashCombine(fingerprint, static_cast<uint64_t>(child));
+  }
+  // The descriptions of custom actions come from the custom action updates.
+  for (int32_t action_id : node.custom_accessibility_actions) {
+    HashCombine(fingerprint, static_cast<uint64_t>(action_id));
+    auto action = pending_semantics_custom_action_updates_.find(action_id);
+    if (action != pending_semantics_custom_action_updates_.end()) {
+      HashCombine(fingerprint, action->second.label);
+    }
+  }
+  return fingerprint;
+}
+
+void AccessibilityBridge::MoveSubTreeToList(int32_t target_id) {
+  auto target = pending_semantics_node_updates_.find(target_id);
+  subtree_stack_.push_back(std::move(target->second));
+  pending_semantics_node_updates_.erase(target);
+
+  // Iterative pre-order traversal, so that deep trees cannot overflow the
+  // stack. Children are pushed in reverse to be visited in order.
+  while (!subtree_stack_.empty()) {
+    subtree_list_.push_back(std::move(subtree_stack_.back()));
+    subtree_stack_.pop_back();
+    const std::vector<int32_t>& children =
+        subtree_list_.back().children_in_traversal_order;
+    for (auto child = children.rbegin(); child != children.rend(); ++child) {
+      auto iter = pending_semantics_node_updates_.find(*child);
+      if (iter != pending_semantics_node_updates_.end()) {
+        subtree_stack_.push_back(std::move(iter->second));
+        pending_semantics_node_updates_.erase(iter);
+      }
     }
   }
 }
 
-void AccessibilityBridge::ConvertFlutterUpdate(const SemanticsNode& node,
+void AccessibilityBridge::ConvertFlutterUpdate(SemanticsNode&& node,
                                                ui::AXTreeUpdate& tree_update) {
-  ui::AXNodeData node_data;
+  ui::AXNodeData& node_data = tree_update.nodes.emplace_back();
   node_data.id = node.id;
   SetRoleFromFlutterUpdate(node_data, node);
   SetStateFromFlutterUpdate(node_data, node);
@@ -297,16 +442,27 @@ void AccessibilityBridge::ConvertFlutterUpdate(const SemanticsNode& node,
   node_data.relative_bounds.bounds.SetRect(node.rect.left, node.rect.top,
                                            node.rect.right - node.rect.left,
                                            node.rect.bottom - node.rect.top);
-  node_data.relative_bounds.transform = std::make_unique<gfx::Transform>(
-      node.transform.scaleX, node.transform.skewX, node.transform.transX, 0,
-      node.transform.skewY, node.transform.scaleY, node.transform.transY, 0,
-      node.transform.pers0, node.transform.pers1, node.transform.pers2, 0, 0, 0,
-      0, 0);
-  for (auto child : node.children_in_traversal_order) {
-    node_data.child_ids.push_back(child);
+  // Keep the offset container set by OnAtomicUpdateFinished for nodes that
+  // stay in the tree, so that the node only moves if its rect or transform
+  // changed. New and reparented nodes get theirs once they are attached.
+  ui::AXNode* existing_node = tree_->GetFromId(node.id);
+  if (existing_node && existing_node->parent()) {
+    node_data.relative_bounds.offset_container_id =
+        existing_node->parent()->id();
+  }
+  // Most nodes aren't transformed. A null transform is treated as identity
+  // and saves an allocation per node.
+  const FlutterTransformation& transform = node.transform;
+  if (transform.scaleX != 1 || transform.skewX != 0 || transform.transX != 0 ||
+      transform.skewY != 0 || transform.scaleY != 1 || transform.transY != 0 ||
+      transform.pers0 != 0 || transform.pers1 != 0 || transform.pers2 != 1) {
+    node_data.relative_bounds.transform = std::make_unique<gfx::Transform>(
+        transform.scaleX, transform.skewX, transform.transX, 0,
+        transform.skewY, transform.scaleY, transform.transY, 0,
+        transform.pers0, transform.pers1, transform.pers2, 0, 0, 0, 0, 0);
   }
   SetTreeData(node, tree_update);
-  tree_update.nodes.push_back(node_data);
+  node_data.child_ids = std::move(node.children_in_traversal_order);
 }
 
 void AccessibilityBridge::SetRoleFromFlutterUpdate(ui::AXNodeData& node_data,
@@ -495,12 +651,8 @@ void AccessibilityBridge::SetIntListAttributesFromFlutterUpdate(
     const SemanticsNode& node) {
   FlutterSemanticsAction actions = node.actions;
   if (actions & FlutterSemanticsAction::kFlutterSemanticsActionCustomAction) {
-    std::vector<int32_t> custom_action_ids;
-    for (size_t i = 0; i < node.custom_accessibility_actions.size(); i++) {
-      custom_action_ids.push_back(node.custom_accessibility_actions[i]);
-    }
     node_data.AddIntListAttribute(ax::mojom::IntListAttribute::kCustomActionIds,
-                                  custom_action_ids);
+                                  node.custom_accessibility_actions);
   }
 }
 
@@ -510,6 +662,8 @@ void AccessibilityBridge::SetStringListAttributesFromFlutterUpdate(
   FlutterSemanticsAction actions = node.actions;
   if (actions & FlutterSemanticsAction::kFlutterSemanticsActionCustomAction) {
     std::vector<std::string> custom_action_description;
+    custom_action_description.reserve(
+        node.custom_accessibility_actions.size());
     for (size_t i = 0; i < node.custom_accessibility_actions.size(); i++) {
       auto iter = pending_semantics_custom_action_updates_.find(
           node.custom_accessibility_actions[i]);
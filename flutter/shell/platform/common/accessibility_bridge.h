@@ -5,7 +5,10 @@
 #ifndef FLUTTER_SHELL_PLATFORM_COMMON_ACCESSIBILITY_BRIDGE_H_
 #define FLUTTER_SHELL_PLATFORM_COMMON_ACCESSIBILITY_BRIDGE_H_
 
+#include <cstdint>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "flutter/fml/mapping.h"
 #include "flutter/shell/platform/embedder/embedder.h"
@@ -103,6 +106,42 @@ class AccessibilityBridge
   const std::vector<ui::AXEventGenerator::TargetedEvent> GetPendingEvents()
       const;
 
+  //------------------------------------------------------------------------------
+  /// @brief      Sets whether CommitUpdates() drops the semantics node updates
+  ///             that wouldn't change the node. Enabled by default. Disabling
+  ///             it doesn't change the resulting tree or events.
+  void SetSkipUnchangedNodeUpdates(bool skip) {
+    skip_unchanged_node_updates_ = skip;
+  }
+
+  //------------------------------------------------------------------------------
+  /// @brief      The number of semantics node updates that were dropped by
+  ///             CommitUpdates() because they wouldn't change the node.
+  size_t skipped_node_update_count() const {
+    return skipped_node_update_count_;
+  }
+
+  //------------------------------------------------------------------------------
+  /// @brief      Whether |event| is generated on tree changes, as set by
+  ///             SetEnabledEvents().
+  bool IsEventEnabled(ui::AXEventGenerator::Event event) const {
+    return event_generator_.IsEventEnabled(event);
+  }
+
+  //------------------------------------------------------------------------------
+  /// @brief      The number of semantics node updates that were applied to the
+  ///             accessibility tree by CommitUpdates().
+  size_t applied_node_update_count() const {
+    return applied_node_update_count_;
+  }
+
+  //------------------------------------------------------------------------------
+  /// @brief      A counter that changes every time CommitUpdates() modifies
+  ///             the accessibility tree. Platforms can compare it against a
+  ///             previously seen value to invalidate data derived from the
+  ///             tree.
+  size_t tree_generation() const { return tree_generation_; }
+
   // |AXTreeManager|
   ui::AXNode* GetNodeFromTree(const ui::AXTreeID tree_id,
                               const ui::AXNode::AXID node_id) const override;
@@ -157,6 +196,12 @@ class AccessibilityBridge
   virtual std::shared_ptr<FlutterPlatformNodeDelegate>
   CreateFlutterPlatformNodeDelegate() = 0;
 
+  //---------------------------------------------------------------------------
+  /// @brief      Limits the events generated on tree changes, and thus passed
+  ///             to OnAccessibilityEvent, to |events|. By default, every
+  ///             event except LOCATION_CHANGED is generated.
+  void SetEnabledEvents(const ui::AXEventGenerator::EventSet& events);
+
  private:
   // See FlutterSemanticsNode in embedder.h
   typedef struct {
@@ -201,15 +246,40 @@ class AccessibilityBridge
       pending_semantics_custom_action_updates_;
   AccessibilityNodeId last_focused_id_ = ui::AXNode::kInvalidAXID;
 
+  // Scratch storage reused across commits to order the pending node updates
+  // without reallocating. Nodes are moved, not copied, out of
+  // pending_semantics_node_updates_ into subtree_list_, where the subtree
+  // lists start at the offsets in subtree_list_starts_.
+  std::vector<SemanticsNode> subtree_stack_;
+  std::vector<SemanticsNode> subtree_list_;
+  std::vector<size_t> subtree_list_starts_;
+
+  // The fingerprint of the last update applied to each node in the tree, used
+  // to drop the updates that wouldn't change a node. Fingerprints of the
+  // updates being committed are kept in pending_node_fingerprints_ until the
+  // tree has been updated.
+  std::unordered_map<int32_t, uint64_t> node_fingerprints_;
+  std::vector<std::pair<int32_t, uint64_t>> pending_node_fingerprints_;
+  bool skip_unchanged_node_updates_ = true;
+  size_t skipped_node_update_count_ = 0;
+  size_t applied_node_update_count_ = 0;
+  size_t tree_generation_ = 0;
+
   void InitAXTree(const ui::AXTreeUpdate& initial_state);
 
   // Create an update that removes any nodes that will be reparented by
   // pending_semantics_updates_. Returns std::nullopt if none are reparented.
   std::optional<ui::AXTreeUpdate> CreateRemoveReparentedNodesUpdate();
 
-  void GetSubTreeList(const SemanticsNode& target,
-                      std::vector<SemanticsNode>& result);
-  void ConvertFlutterUpdate(const SemanticsNode& node,
+  // Computes the fingerprints of the pending node updates. If
+  // |skip_unchanged| is true, removes the updates whose fingerprint matches
+  // the node in the tree.
+  void FingerprintPendingNodeUpdates(bool skip_unchanged);
+  uint64_t ComputeFingerprint(const SemanticsNode& node) const;
+  // Moves the pending update of |target_id| and the pending updates of its
+  // descendants to the end of subtree_list_, in tree order.
+  void MoveSubTreeToList(int32_t target_id);
+  void ConvertFlutterUpdate(SemanticsNode&& node,
                             ui::AXTreeUpdate& tree_update);
   void SetRoleFromFlutterUpdate(ui::AXNodeData& node_data,
                                 const SemanticsNode& node);
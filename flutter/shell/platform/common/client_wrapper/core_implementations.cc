@@ -238,6 +238,19 @@ int64_t TextureRegistrarImpl::RegisterTexture(TextureVariant* texture) {
       auto texture = static_cast<GpuSurfaceTexture*>(user_data);
       return texture->ObtainDescriptor(width, height);
     };
+  } else if (auto pixel_buffer_descriptor_texture =
+                 std::get_if<PixelBufferDescriptorTexture>(texture)) {
+    info.type = kFlutterDesktopPixelBufferDescriptorTexture;
+    info.pixel_buffer_descriptor_config.struct_size =
+        sizeof(FlutterDesktopPixelBufferDescriptorTextureConfig);
+    info.pixel_buffer_descriptor_config.user_data =
+        pixel_buffer_descriptor_texture;
+    info.pixel_buffer_descriptor_config.callback =
+        [](size_t width, size_t height,
+           void* user_data) -> const FlutterDesktopPixelBufferDescriptor* {
+      auto texture = static_cast<PixelBufferDescriptorTexture*>(user_data);
+      return texture->ObtainDescriptor(width, height);
+    };
   } else {
     std::cerr << "Attempting to register unknown texture variant." << std::endl;
     return -1;
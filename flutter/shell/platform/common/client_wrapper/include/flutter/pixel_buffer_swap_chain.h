@@ -0,0 +1,158 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_PLATFORM_COMMON_CLIENT_WRAPPER_INCLUDE_FLUTTER_PIXEL_BUFFER_SWAP_CHAIN_H_
+#define FLUTTER_SHELL_PLATFORM_COMMON_CLIENT_WRAPPER_INCLUDE_FLUTTER_PIXEL_BUFFER_SWAP_CHAIN_H_
+
+#include <flutter_texture_registrar.h>
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace flutter {
+
+// A set of RGBA pixel buffers shared between a producer, such as a camera or
+// a video decoder, and the engine.
+//
+// The producer acquires a free buffer, fills it and submits it. The engine
+// consumes the latest submitted buffer through the callback of a
+// PixelBufferTexture and hands it back through |release_callback| once it
+// has been uploaded, after which the buffer can be acquired again. With three
+// buffers, one can be displayed, one be pending and one be written at the
+// same time, so the producer does not need to allocate or wait per frame.
+//
+// Thread safety:
+// It's safe to call the member methods from any thread. The swap chain must
+// outlive the texture it is used with.
+class PixelBufferSwapChain {
+ public:
+  static constexpr size_t kBufferCount = 3;
+
+  // Creates buffers of |width| x |height| RGBA pixels.
+  PixelBufferSwapChain(size_t width, size_t height) {
+    for (Slot& slot : slots_) {
+      slot.owner = this;
+      slot.pixels.resize(width * height * 4);
+      slot.buffer.buffer = slot.pixels.data();
+      slot.buffer.width = width;
+      slot.buffer.height = height;
+      slot.buffer.release_callback = [](void* release_context) {
+        auto* slot = static_cast<Slot*>(release_context);
+        slot->owner->Release(slot);
+      };
+      slot.buffer.release_context = &slot;
+    }
+  }
+
+  // Prevent copying.
+  PixelBufferSwapChain(PixelBufferSwapChain const&) = delete;
+  PixelBufferSwapChain& operator=(PixelBufferSwapChain const&) = delete;
+
+  // Returns a buffer of |width| * |height| * 4 bytes for the producer to
+  // write, or nullptr if all buffers are in use.
+  uint8_t* AcquireBuffer() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (Slot& slot : slots_) {
+      if (IsFree(&slot)) {
+        slot.writing = true;
+        return slot.pixels.data();
+      }
+    }
+    return nullptr;
+  }
+
+  // Makes a buffer returned by AcquireBuffer the next one to be consumed. A
+  // previously submitted buffer that has not been consumed yet is recycled.
+  void SubmitBuffer(uint8_t* pixels) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Slot* slot = FindSlot(pixels);
+    if (!slot || !slot->writing) {
+      return;
+    }
+    slot->writing = false;
+    if (ready_) {
+      dropped_frames_++;
+    }
+    ready_ = slot;
+  }
+
+  // Returns a buffer acquired with AcquireBuffer to the swap chain without
+  // submitting it.
+  void DiscardBuffer(uint8_t* pixels) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Slot* slot = FindSlot(pixels);
+    if (slot) {
+      slot->writing = false;
+    }
+  }
+
+  // Returns the latest submitted buffer, or the last consumed one if nothing
+  // has been submitted since. Intended to be called from the callback of a
+  // PixelBufferTexture.
+  const FlutterDesktopPixelBuffer* ConsumeBuffer() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (ready_) {
+      presented_ = ready_;
+      ready_ = nullptr;
+    }
+    if (!presented_) {
+      return nullptr;
+    }
+    presented_->engine_references++;
+    return &presented_->buffer;
+  }
+
+  // The number of submitted buffers that were replaced before the engine
+  // consumed them.
+  uint64_t dropped_frames() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return dropped_frames_;
+  }
+
+ private:
+  struct Slot {
+    PixelBufferSwapChain* owner = nullptr;
+    std::vector<uint8_t> pixels;
+    FlutterDesktopPixelBuffer buffer = {};
+    bool writing = false;
+    // The number of times the buffer was handed to the engine and hasn't been
+    // released yet.
+    uint32_t engine_references = 0;
+  };
+
+  bool IsFree(const Slot* slot) const {
+    return !slot->writing && slot->engine_references == 0 && slot != ready_ &&
+           slot != presented_;
+  }
+
+  Slot* FindSlot(const uint8_t* pixels) {
+    for (Slot& slot : slots_) {
+      if (slot.pixels.data() == pixels) {
+        return &slot;
+      }
+    }
+    return nullptr;
+  }
+
+  void Release(Slot* slot) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (slot->engine_references > 0) {
+      slot->engine_references--;
+    }
+  }
+
+  mutable std::mutex mutex_;
+  std::array<Slot, kBufferCount> slots_;
+  // The latest submitted buffer that hasn't been consumed yet.
+  Slot* ready_ = nullptr;
+  // The buffer most recently handed to the engine.
+  Slot* presented_ = nullptr;
+  uint64_t dropped_frames_ = 0;
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_PLATFORM_COMMON_CLIENT_WRAPPER_INCLUDE_FLUTTER_PIXEL_BUFFER_SWAP_CHAIN_H_
@@ -26,8 +26,10 @@ class PixelBufferTexture {
   // Creates a pixel buffer texture that uses the provided |copy_buffer_cb| to
   // retrieve the buffer.
   // As the callback is usually invoked from the render thread, the callee must
-  // take care of proper synchronization. It also needs to be ensured that the
-  // returned buffer isn't released prior to unregistering this texture.
+  // take care of proper synchronization. Unless the returned buffer specifies
+  // a |release_callback|, it also needs to be ensured that the buffer isn't
+  // released prior to unregistering this texture. See PixelBufferSwapChain
+  // for a set of recyclable buffers.
   explicit PixelBufferTexture(CopyBufferCallback copy_buffer_callback)
       : copy_buffer_callback_(std::move(copy_buffer_callback)) {}
 
@@ -43,6 +45,37 @@ class PixelBufferTexture {
   const CopyBufferCallback copy_buffer_callback_;
 };
 
+// A pixel buffer texture with an explicit pixel format and row strides.
+class PixelBufferDescriptorTexture {
+ public:
+  // A callback used for retrieving pixel buffer descriptors.
+  typedef std::function<const FlutterDesktopPixelBufferDescriptor*(
+      size_t width,
+      size_t height)>
+      ObtainDescriptorCallback;
+
+  // Creates a pixel buffer texture that uses the provided
+  // |obtain_descriptor_callback| to retrieve the buffer.
+  // The same synchronization and lifetime requirements as for
+  // PixelBufferTexture apply, unless the descriptor specifies a
+  // |release_callback|.
+  explicit PixelBufferDescriptorTexture(
+      ObtainDescriptorCallback obtain_descriptor_callback)
+      : obtain_descriptor_callback_(std::move(obtain_descriptor_callback)) {}
+
+  // Returns the callback-provided FlutterDesktopPixelBufferDescriptor that
+  // describes the pixel data. The intended surface size is specified by
+  // |width| and |height|.
+  const FlutterDesktopPixelBufferDescriptor* ObtainDescriptor(
+      size_t width,
+      size_t height) const {
+    return obtain_descriptor_callback_(width, height);
+  }
+
+ private:
+  const ObtainDescriptorCallback obtain_descriptor_callback_;
+};
+
 // A GPU surface-based texture.
 class GpuSurfaceTexture {
  public:
@@ -76,7 +109,10 @@ class GpuSurfaceTexture {
 // The available texture variants.
 // Only PixelBufferTexture is currently implemented.
 // Other variants are expected to be added in the future.
-typedef std::variant<PixelBufferTexture, GpuSurfaceTexture> TextureVariant;
+typedef std::variant<PixelBufferTexture,
+                     GpuSurfaceTexture,
+                     PixelBufferDescriptorTexture>
+    TextureVariant;
 
 // An object keeping track of external textures.
 //
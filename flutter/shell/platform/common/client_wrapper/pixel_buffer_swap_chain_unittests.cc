@@ -0,0 +1,160 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/common/client_wrapper/include/flutter/pixel_buffer_swap_chain.h"
+
+#include <atomic>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+void ReleaseBuffer(const FlutterDesktopPixelBuffer* buffer) {
+  ASSERT_NE(buffer->release_callback, nullptr);
+  buffer->release_callback(buffer->release_context);
+}
+
+}  // namespace
+
+TEST(PixelBufferSwapChainTest, NothingToConsumeBeforeSubmit) {
+  PixelBufferSwapChain swap_chain(4, 2);
+  EXPECT_EQ(swap_chain.ConsumeBuffer(), nullptr);
+
+  uint8_t* pixels = swap_chain.AcquireBuffer();
+  ASSERT_NE(pixels, nullptr);
+  EXPECT_EQ(swap_chain.ConsumeBuffer(), nullptr);
+}
+
+TEST(PixelBufferSwapChainTest, ConsumesSubmittedBuffer) {
+  PixelBufferSwapChain swap_chain(4, 2);
+  uint8_t* pixels = swap_chain.AcquireBuffer();
+  ASSERT_NE(pixels, nullptr);
+  pixels[0] = 42;
+  swap_chain.SubmitBuffer(pixels);
+
+  const FlutterDesktopPixelBuffer* buffer = swap_chain.ConsumeBuffer();
+  ASSERT_NE(buffer, nullptr);
+  EXPECT_EQ(buffer->buffer, pixels);
+  EXPECT_EQ(buffer->buffer[0], 42);
+  EXPECT_EQ(buffer->width, 4u);
+  EXPECT_EQ(buffer->height, 2u);
+  ReleaseBuffer(buffer);
+
+  // Without a new submission, the last buffer is presented again.
+  buffer = swap_chain.ConsumeBuffer();
+  ASSERT_NE(buffer, nullptr);
+  EXPECT_EQ(buffer->buffer, pixels);
+  ReleaseBuffer(buffer);
+}
+
+TEST(PixelBufferSwapChainTest, RecyclesReleasedBuffers) {
+  PixelBufferSwapChain swap_chain(4, 2);
+
+  // The presented buffer is only recycled once a newer buffer is presented.
+  for (int frame = 0; frame < 10; frame++) {
+    uint8_t* pixels = swap_chain.AcquireBuffer();
+    ASSERT_NE(pixels, nullptr);
+    swap_chain.SubmitBuffer(pixels);
+    const FlutterDesktopPixelBuffer* buffer = swap_chain.ConsumeBuffer();
+    ASSERT_NE(buffer, nullptr);
+    EXPECT_EQ(buffer->buffer, pixels);
+    ReleaseBuffer(buffer);
+  }
+  EXPECT_EQ(swap_chain.dropped_frames(), 0u);
+}
+
+TEST(PixelBufferSwapChainTest, ReplacesPendingBuffer) {
+  PixelBufferSwapChain swap_chain(4, 2);
+  uint8_t* first = swap_chain.AcquireBuffer();
+  swap_chain.SubmitBuffer(first);
+  uint8_t* second = swap_chain.AcquireBuffer();
+  ASSERT_NE(second, first);
+  swap_chain.SubmitBuffer(second);
+  EXPECT_EQ(swap_chain.dropped_frames(), 1u);
+
+  // The replaced buffer can be acquired again.
+  uint8_t* third = swap_chain.AcquireBuffer();
+  EXPECT_NE(third, nullptr);
+  EXPECT_NE(third, second);
+
+  const FlutterDesktopPixelBuffer* buffer = swap_chain.ConsumeBuffer();
+  EXPECT_EQ(buffer->buffer, second);
+  ReleaseBuffer(buffer);
+}
+
+TEST(PixelBufferSwapChainTest, BuffersHeldByEngineAreNotAcquired) {
+  PixelBufferSwapChain swap_chain(4, 2);
+  uint8_t* first = swap_chain.AcquireBuffer();
+  swap_chain.SubmitBuffer(first);
+  const FlutterDesktopPixelBuffer* held = swap_chain.ConsumeBuffer();
+
+  uint8_t* second = swap_chain.AcquireBuffer();
+  swap_chain.SubmitBuffer(second);
+  const FlutterDesktopPixelBuffer* buffer = swap_chain.ConsumeBuffer();
+  EXPECT_EQ(buffer->buffer, second);
+
+  // |first| is no longer presented but still held by the engine.
+  uint8_t* third = swap_chain.AcquireBuffer();
+  ASSERT_NE(third, nullptr);
+  EXPECT_EQ(swap_chain.AcquireBuffer(), nullptr);
+
+  ReleaseBuffer(held);
+  EXPECT_EQ(swap_chain.AcquireBuffer(), first);
+  ReleaseBuffer(buffer);
+}
+
+TEST(PixelBufferSwapChainTest, DiscardBuffer) {
+  PixelBufferSwapChain swap_chain(4, 2);
+  uint8_t* pixels = swap_chain.AcquireBuffer();
+  swap_chain.DiscardBuffer(pixels);
+  EXPECT_EQ(swap_chain.ConsumeBuffer(), nullptr);
+
+  // Submitting a discarded buffer has no effect.
+  swap_chain.SubmitBuffer(pixels);
+  EXPECT_EQ(swap_chain.ConsumeBuffer(), nullptr);
+}
+
+TEST(PixelBufferSwapChainTest, ConcurrentProducerAndConsumer) {
+  constexpr int kFrameCount = 10000;
+  PixelBufferSwapChain swap_chain(16, 16);
+  std::atomic<bool> done = false;
+
+  std::thread producer([&swap_chain, &done]() {
+    for (int frame = 0; frame < kFrameCount;) {
+      uint8_t* pixels = swap_chain.AcquireBuffer();
+      if (!pixels) {
+        std::this_thread::yield();
+        continue;
+      }
+      pixels[0] = static_cast<uint8_t>(frame);
+      swap_chain.SubmitBuffer(pixels);
+      frame++;
+    }
+    done = true;
+  });
+
+  int consumed = 0;
+  bool producing = true;
+  while (producing) {
+    // Checked before consuming, so that the last submitted frame is consumed
+    // even if the producer finishes before the consumer gets to run.
+    producing = !done;
+    const FlutterDesktopPixelBuffer* buffer = swap_chain.ConsumeBuffer();
+    if (buffer) {
+      consumed++;
+      ReleaseBuffer(buffer);
+    }
+  }
+  producer.join();
+
+  EXPECT_GT(consumed, 0);
+  EXPECT_LT(swap_chain.dropped_frames(), static_cast<uint64_t>(kFrameCount));
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -50,6 +50,33 @@ bool FlutterPlatformNodeDelegate::AccessibilityPerformAction(
           target, FlutterSemanticsAction::kFlutterSemanticsActionShowOnScreen,
           {});
       return true;
+    case ax::mojom::Action::kIncrement:
+      bridge_ptr->DispatchAccessibilityAction(
+          target, FlutterSemanticsAction::kFlutterSemanticsActionIncrease, {});
+      return true;
+    case ax::mojom::Action::kDecrement:
+      bridge_ptr->DispatchAccessibilityAction(
+          target, FlutterSemanticsAction::kFlutterSemanticsActionDecrease, {});
+      return true;
+    case ax::mojom::Action::kScrollUp:
+      bridge_ptr->DispatchAccessibilityAction(
+          target, FlutterSemanticsAction::kFlutterSemanticsActionScrollUp, {});
+      return true;
+    case ax::mojom::Action::kScrollDown:
+      bridge_ptr->DispatchAccessibilityAction(
+          target, FlutterSemanticsAction::kFlutterSemanticsActionScrollDown,
+          {});
+      return true;
+    case ax::mojom::Action::kScrollLeft:
+      bridge_ptr->DispatchAccessibilityAction(
+          target, FlutterSemanticsAction::kFlutterSemanticsActionScrollLeft,
+          {});
+      return true;
+    case ax::mojom::Action::kScrollRight:
+      bridge_ptr->DispatchAccessibilityAction(
+          target, FlutterSemanticsAction::kFlutterSemanticsActionScrollRight,
+          {});
+      return true;
     // TODO(chunhtai): support more actions.
     default:
       return false;
@@ -25,7 +25,9 @@ typedef enum {
   // A Pixel buffer-based texture.
   kFlutterDesktopPixelBufferTexture,
   // A platform-specific GPU surface-backed texture.
-  kFlutterDesktopGpuSurfaceTexture
+  kFlutterDesktopGpuSurfaceTexture,
+  // A pixel buffer-based texture with an explicit format and row stride.
+  kFlutterDesktopPixelBufferDescriptorTexture
 } FlutterDesktopTextureType;
 
 // Supported GPU surface types.
@@ -49,7 +51,12 @@ typedef enum {
   kFlutterDesktopPixelFormatRGBA8888,
   // Represents a 32-bit BGRA color format with 8 bits each for blue, green, red
   // and alpha.
-  kFlutterDesktopPixelFormatBGRA8888
+  kFlutterDesktopPixelFormatBGRA8888,
+  // Represents a YUV 4:2:0 format with a Y plane followed by a plane of
+  // interleaved U and V samples.
+  kFlutterDesktopPixelFormatNV12,
+  // Represents a YUV 4:2:0 format with separate Y, U and V planes.
+  kFlutterDesktopPixelFormatI420
 } FlutterDesktopPixelFormat;
 
 // An image buffer object.
@@ -66,6 +73,32 @@ typedef struct {
   void* release_context;
 } FlutterDesktopPixelBuffer;
 
+// The maximum number of planes of a pixel buffer.
+#define FLUTTER_DESKTOP_PIXEL_BUFFER_MAX_PLANES 3
+
+// An image buffer object with an explicit memory layout.
+typedef struct {
+  // The size of this struct. Must be
+  // sizeof(FlutterDesktopPixelBufferDescriptor).
+  size_t struct_size;
+  // The pixel format of the buffer.
+  FlutterDesktopPixelFormat format;
+  // The planes of the buffer. RGBA8888 and BGRA8888 buffers have a single
+  // plane, NV12 buffers have two planes and I420 buffers have three planes.
+  const uint8_t* planes[FLUTTER_DESKTOP_PIXEL_BUFFER_MAX_PLANES];
+  // The number of bytes between the starts of two consecutive rows of each
+  // plane, or zero if the rows of the plane are tightly packed.
+  size_t strides[FLUTTER_DESKTOP_PIXEL_BUFFER_MAX_PLANES];
+  // Width of the pixel buffer.
+  size_t width;
+  // Height of the pixel buffer.
+  size_t height;
+  // An optional callback that gets invoked when the planes can be released.
+  void (*release_callback)(void* release_context);
+  // Opaque data passed to |release_callback|.
+  void* release_context;
+} FlutterDesktopPixelBufferDescriptor;
+
 // A GPU surface descriptor.
 typedef struct {
   // The size of this struct. Must be
@@ -109,14 +142,28 @@ typedef struct {
 // |FlutterDesktopPixelBufferTextureConfig|.
 //
 // As this is usually called from the render thread, the callee must take
-// care of proper synchronization. It also needs to be ensured that the
-// returned |FlutterDesktopPixelBuffer| isn't released prior to unregistering
-// the corresponding texture.
+// care of proper synchronization. If the returned |FlutterDesktopPixelBuffer|
+// specifies a |release_callback|, it is invoked exactly once for every call
+// of this callback after the engine is done with the pixel data. Otherwise,
+// it needs to be ensured that the buffer isn't released prior to
+// unregistering the corresponding texture.
 typedef const FlutterDesktopPixelBuffer* (
     *FlutterDesktopPixelBufferTextureCallback)(size_t width,
                                                size_t height,
                                                void* user_data);
 
+// The pixel buffer descriptor callback definition provided to the Flutter
+// engine to obtain the pixel buffer. It is invoked with the intended surface
+// size specified by |width| and |height| and the |user_data| held by
+// |FlutterDesktopPixelBufferDescriptorTextureConfig|.
+//
+// The same synchronization and lifetime requirements as for
+// |FlutterDesktopPixelBufferTextureCallback| apply.
+typedef const FlutterDesktopPixelBufferDescriptor* (
+    *FlutterDesktopPixelBufferDescriptorTextureCallback)(size_t width,
+                                                         size_t height,
+                                                         void* user_data);
+
 // The GPU surface callback definition provided to the Flutter engine to obtain
 // the surface. It is invoked with the intended surface size specified by
 // |width| and |height| and the |user_data| held by
@@ -134,6 +181,17 @@ typedef struct {
   void* user_data;
 } FlutterDesktopPixelBufferTextureConfig;
 
+// An object used to configure pixel buffer descriptor textures.
+typedef struct {
+  // The size of this struct. Must be
+  // sizeof(FlutterDesktopPixelBufferDescriptorTextureConfig).
+  size_t struct_size;
+  // The callback used by the engine to obtain the pixel buffer descriptor.
+  FlutterDesktopPixelBufferDescriptorTextureCallback callback;
+  // Opaque data that will get passed to the provided |callback|.
+  void* user_data;
+} FlutterDesktopPixelBufferDescriptorTextureConfig;
+
 // An object used to configure GPU-surface textures.
 typedef struct {
   // The size of this struct. Must be
@@ -153,6 +211,8 @@ typedef struct {
   union {
     FlutterDesktopPixelBufferTextureConfig pixel_buffer_config;
     FlutterDesktopGpuSurfaceTextureConfig gpu_surface_config;
+    FlutterDesktopPixelBufferDescriptorTextureConfig
+        pixel_buffer_descriptor_config;
   };
 } FlutterDesktopTextureInfo;
 
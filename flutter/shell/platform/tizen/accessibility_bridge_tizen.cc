@@ -10,13 +10,97 @@
 
 namespace flutter {
 
-AccessibilityBridgeTizen::AccessibilityBridgeTizen(FlutterTizenEngine* engine)
-    : engine_(engine) {}
+namespace {
+
+// The minimum interval, in seconds, between two reports of the bounds of the
+// same node.
+constexpr double kLocationChangeInterval = 0.1;
+
+// Location change times older than the interval are only dropped once there
+// are more than this many of them.
+constexpr size_t kMaxLocationChangeTimes = 256;
+
+// The interval, in seconds, at which held actions are sent when the framework
+// doesn't respond to them with a semantics update.
+constexpr double kActionFlushInterval = 0.1;
+
+}  // namespace
+
+AccessibilityBridgeTizen::AccessibilityBridgeTizen(FlutterTizenEngine* engine,
+                                                   FlutterViewId view_id)
+    : engine_(engine),
+      view_id_(view_id),
+      action_queue_([engine, view_id](uint64_t target,
+                                      FlutterSemanticsAction action,
+                                      fml::MallocMapping data) {
+        engine->DispatchAccessibilityAction(view_id, target, action,
+                                            std::move(data));
+      }) {
+  // Only generate the events that FlutterPlatformNodeDelegateTizen handles,
+  // which saves diffing attributes that nobody listens to. Bounds changes
+  // fire on every frame of an animation, so they are only reported on
+  // request.
+  ui::AXEventGenerator::EventSet events;
+  for (ui::AXEventGenerator::Event event : {
+           ui::AXEventGenerator::Event::ACTIVE_DESCENDANT_CHANGED,
+           ui::AXEventGenerator::Event::ALERT,
+           ui::AXEventGenerator::Event::CHECKED_STATE_CHANGED,
+           ui::AXEventGenerator::Event::DESCRIPTION_CHANGED,
+           ui::AXEventGenerator::Event::DOCUMENT_TITLE_CHANGED,
+           ui::AXEventGenerator::Event::ENABLED_CHANGED,
+           ui::AXEventGenerator::Event::EXPANDED,
+           ui::AXEventGenerator::Event::FOCUS_CHANGED,
+           ui::AXEventGenerator::Event::INVALID_STATUS_CHANGED,
+           ui::AXEventGenerator::Event::LOAD_COMPLETE,
+           ui::AXEventGenerator::Event::SELECTED_CHANGED,
+           ui::AXEventGenerator::Event::SUBTREE_CREATED,
+           ui::AXEventGenerator::Event::TEXT_ATTRIBUTE_CHANGED,
+           ui::AXEventGenerator::Event::VALUE_CHANGED,
+       }) {
+    events.set(static_cast<size_t>(event));
+  }
+  if (engine->accessibility_location_events()) {
+    events.set(
+        static_cast<size_t>(ui::AXEventGenerator::Event::LOCATION_CHANGED));
+  }
+  SetEnabledEvents(events);
+}
+
+AccessibilityBridgeTizen::~AccessibilityBridgeTizen() {
+  if (location_change_timer_) {
+    ecore_timer_del(location_change_timer_);
+    location_change_timer_ = nullptr;
+  }
+  if (action_flush_timer_) {
+    ecore_timer_del(action_flush_timer_);
+    action_flush_timer_ = nullptr;
+  }
+}
+
+std::weak_ptr<FlutterPlatformWindowDelegateTizen>
+AccessibilityBridgeTizen::GetWindow() {
+  FlutterPlatformAppDelegateTizen& app =
+      FlutterPlatformAppDelegateTizen::GetInstance();
+  return view_id_ == kImplicitViewId ? app.GetWindow()
+                                     : app.GetViewWindow(view_id_);
+}
 
 void AccessibilityBridgeTizen::OnAccessibilityEvent(
     ui::AXEventGenerator::TargetedEvent targeted_event) {
+  if (targeted_event.event_params.event ==
+      ui::AXEventGenerator::Event::LOCATION_CHANGED) {
+    OnLocationChanged(targeted_event.node->id());
+    return;
+  }
+  NotifyAccessibilityEvent(targeted_event.node->id(),
+                           targeted_event.event_params.event);
+}
+
+void AccessibilityBridgeTizen::NotifyAccessibilityEvent(
+    ui::AXNode::AXID id,
+    ui::AXEventGenerator::Event event) {
   std::shared_ptr<FlutterPlatformNodeDelegate> platform_node_delegate =
-      GetFlutterPlatformNodeDelegateFromID(targeted_event.node->id()).lock();
+      GetFlutterPlatformNodeDelegateFromID(id).lock();
   if (!platform_node_delegate) {
     FT_LOG(Error) << "Platform node delegate is deallocated";
     return;
@@ -24,15 +108,97 @@ void AccessibilityBridgeTizen::OnAccessibilityEvent(
   auto tizen_platform_node_delegate =
       std::static_pointer_cast<FlutterPlatformNodeDelegateTizen>(
           platform_node_delegate);
-  tizen_platform_node_delegate->NotifyAccessibilityEvent(
-      targeted_event.event_params.event);
+  tizen_platform_node_delegate->NotifyAccessibilityEvent(event);
+}
+
+void AccessibilityBridgeTizen::OnLocationChanged(ui::AXNode::AXID id) {
+  if (pending_location_changes_.count(id) > 0) {
+    return;
+  }
+  double now = ecore_time_get();
+  auto iter = location_change_times_.find(id);
+  if (iter != location_change_times_.end() &&
+      now - iter->second < kLocationChangeInterval) {
+    pending_location_changes_.insert(id);
+    if (!location_change_timer_) {
+      location_change_timer_ = ecore_timer_add(
+          kLocationChangeInterval,
+          [](void* data) -> Eina_Bool {
+            auto* self = static_cast<AccessibilityBridgeTizen*>(data);
+            self->location_change_timer_ = nullptr;
+            self->FlushLocationChanges();
+            return ECORE_CALLBACK_CANCEL;
+          },
+          this);
+    }
+    return;
+  }
+
+  if (location_change_times_.size() > kMaxLocationChangeTimes) {
+    for (auto it = location_change_times_.begin();
+         it != location_change_times_.end();) {
+      if (now - it->second >= kLocationChangeInterval) {
+        it = location_change_times_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+  location_change_times_[id] = now;
+  NotifyAccessibilityEvent(id, ui::AXEventGenerator::Event::LOCATION_CHANGED);
+}
+
+void AccessibilityBridgeTizen::FlushLocationChanges() {
+  double now = ecore_time_get();
+  for (ui::AXNode::AXID id : pending_location_changes_) {
+    // The node may have been removed in the meantime.
+    if (GetFlutterPlatformNodeDelegateFromID(id).expired()) {
+      location_change_times_.erase(id);
+      continue;
+    }
+    location_change_times_[id] = now;
+    NotifyAccessibilityEvent(id, ui::AXEventGenerator::Event::LOCATION_CHANGED);
+  }
+  pending_location_changes_.clear();
 }
 
 void AccessibilityBridgeTizen::DispatchAccessibilityAction(
     AccessibilityNodeId target,
     FlutterSemanticsAction action,
     fml::MallocMapping data) {
-  engine_->DispatchAccessibilityAction(target, action, std::move(data));
+  action_queue_.Dispatch(target, action, std::move(data));
+  ScheduleActionFlush();
+}
+
+void AccessibilityBridgeTizen::FlushActions() {
+  action_queue_.Flush();
+}
+
+void AccessibilityBridgeTizen::ScheduleActionFlush() {
+  if (action_flush_timer_ || !action_queue_.HasPendingActions()) {
+    return;
+  }
+  action_flush_timer_ = ecore_timer_add(
+      kActionFlushInterval,
+      [](void* data) -> Eina_Bool {
+        auto* self = static_cast<AccessibilityBridgeTizen*>(data);
+        self->action_queue_.Flush();
+        if (self->action_queue_.HasPendingActions()) {
+          return ECORE_CALLBACK_RENEW;
+        }
+        self->action_flush_timer_ = nullptr;
+        return ECORE_CALLBACK_CANCEL;
+      },
+      this);
+}
+
+ui::AXNode::AXID AccessibilityBridgeTizen::HitTest(ui::AXNode::AXID start_id,
+                                                  const gfx::Point& point) {
+  if (hit_test_index_generation_ != tree_generation()) {
+    hit_test_index_.Build(*GetTree());
+    hit_test_index_generation_ = tree_generation();
+  }
+  return hit_test_index_.HitTest(start_id, point);
 }
 
 std::shared_ptr<FlutterPlatformNodeDelegate>
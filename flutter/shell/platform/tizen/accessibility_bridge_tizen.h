@@ -5,23 +5,53 @@
 #ifndef EMBEDDER_ACCESSIBILITY_BRIDGE_TIZEN_H_
 #define EMBEDDER_ACCESSIBILITY_BRIDGE_TIZEN_H_
 
+#include <Ecore.h>
+
+#include <unordered_map>
+#include <unordered_set>
+
 #include "flutter/shell/platform/common/accessibility_bridge.h"
+#include "flutter/shell/platform/embedder/embedder.h"
+#include "flutter/shell/platform/tizen/accessibility_hit_test_index.h"
+#include "flutter/shell/platform/tizen/semantics_action_queue.h"
 
 namespace flutter {
 
+class FlutterPlatformWindowDelegateTizen;
 class FlutterTizenEngine;
 
 // The Tizen implementation of AccessibilityBridge.
 class AccessibilityBridgeTizen : public AccessibilityBridge {
  public:
-  AccessibilityBridgeTizen(FlutterTizenEngine* engine);
-  virtual ~AccessibilityBridgeTizen() = default;
+  // Creates a bridge for the tree of the view |view_id| of |engine|.
+  AccessibilityBridgeTizen(FlutterTizenEngine* engine, FlutterViewId view_id);
+  virtual ~AccessibilityBridgeTizen();
+
+  // The ID of the view the tree belongs to.
+  FlutterViewId view_id() const { return view_id_; }
+
+  // The window delegate the root of the tree is attached to, which is exposed
+  // to assistive clients as the window of the view.
+  std::weak_ptr<FlutterPlatformWindowDelegateTizen> GetWindow();
 
   // |AccessibilityBridge|
   void DispatchAccessibilityAction(AccessibilityNodeId target,
                                    FlutterSemanticsAction action,
                                    fml::MallocMapping data) override;
 
+  // Returns the id of the deepest node under |point| within the subtree of the
+  // node |start_id|, or kInvalidAXID if there is none. See
+  // AccessibilityHitTestIndex::HitTest.
+  //
+  // The screen bounds of all nodes are indexed on the first call after the
+  // tree has changed.
+  ui::AXNode::AXID HitTest(ui::AXNode::AXID start_id, const gfx::Point& point);
+
+  // Sends the repeated actions held since the last call. Called once the
+  // framework has sent the semantics update for the actions dispatched so
+  // far.
+  void FlushActions();
+
  protected:
   // |AccessibilityBridge|
   void OnAccessibilityEvent(
@@ -32,7 +62,36 @@ class AccessibilityBridgeTizen : public AccessibilityBridge {
   CreateFlutterPlatformNodeDelegate() override;
 
  private:
+  // Passes |event| on to the platform node of the node |id|.
+  void NotifyAccessibilityEvent(ui::AXNode::AXID id,
+                                ui::AXEventGenerator::Event event);
+
+  // Reports the new bounds of the node |id|. A node that keeps moving, as
+  // during a scroll, is reported at most once per kLocationChangeInterval,
+  // and its final bounds are reported by |location_change_timer_|.
+  void OnLocationChanged(ui::AXNode::AXID id);
+
+  void FlushLocationChanges();
+
+  // Flushes |action_queue_| until no action is in flight, for actions that
+  // don't lead to a semantics update.
+  void ScheduleActionFlush();
+
   FlutterTizenEngine* engine_;
+  FlutterViewId view_id_;
+  AccessibilityHitTestIndex hit_test_index_;
+  // The tree generation |hit_test_index_| was built from. The index starts out
+  // empty, as does the tree.
+  size_t hit_test_index_generation_ = 0;
+
+  // The time, in seconds, each node's bounds were last reported.
+  std::unordered_map<ui::AXNode::AXID, double> location_change_times_;
+  // The nodes whose bounds have changed since they were last reported.
+  std::unordered_set<ui::AXNode::AXID> pending_location_changes_;
+  Ecore_Timer* location_change_timer_ = nullptr;
+
+  SemanticsActionQueue action_queue_;
+  Ecore_Timer* action_flush_timer_ = nullptr;
 };
 
 }  // namespace flutter
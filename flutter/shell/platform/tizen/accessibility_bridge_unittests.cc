@@ -0,0 +1,175 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/common/accessibility_bridge.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "flutter/shell/platform/common/test_accessibility_bridge.h"
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+// The properties of a semantics node that the tests change.
+struct TestNode {
+  std::vector<int32_t> children;
+  std::string label;
+  std::string value;
+  FlutterSemanticsFlags flags = {};
+  FlutterRect rect = {0, 0, 100, 100};
+  int32_t selection_base = -1;
+  int32_t selection_extent = -1;
+};
+
+using TestTree = std::map<int32_t, TestNode>;
+
+// Records the target of each event along with its type.
+class EventRecordingBridge : public TestAccessibilityBridge {
+ public:
+  std::vector<std::pair<ui::AXEventGenerator::Event, int32_t>> events;
+
+ protected:
+  void OnAccessibilityEvent(
+      ui::AXEventGenerator::TargetedEvent targeted_event) override {
+    events.emplace_back(targeted_event.event_params.event,
+                        targeted_event.node->id());
+    TestAccessibilityBridge::OnAccessibilityEvent(targeted_event);
+  }
+};
+
+FlutterSemanticsNode2 CreateSemanticsNode(int32_t id, TestNode& node) {
+  node.flags.struct_size = sizeof(FlutterSemanticsFlags);
+  FlutterSemanticsNode2 result = {};
+  result.struct_size = sizeof(FlutterSemanticsNode2);
+  result.id = id;
+  result.flags2 = &node.flags;
+  result.text_selection_base = node.selection_base;
+  result.text_selection_extent = node.selection_extent;
+  result.label = node.label.c_str();
+  result.hint = "";
+  result.value = node.value.c_str();
+  result.increased_value = "";
+  result.decreased_value = "";
+  result.tooltip = "";
+  result.rect = node.rect;
+  result.transform = {1, 0, 0, 0, 1, 0, 0, 0, 1};
+  result.child_count = node.children.size();
+  result.children_in_traversal_order = node.children.data();
+  result.children_in_hit_test_order = node.children.data();
+  return result;
+}
+
+// Returns the tree of |bridge| as a string, without its random ID.
+std::string DumpTree(AccessibilityBridge& bridge) {
+  std::string dump = bridge.GetTree()->ToString();
+  size_t start = dump.find("tree_id=");
+  if (start != std::string::npos) {
+    dump.erase(start, dump.find(' ', start) - start);
+  }
+  return dump;
+}
+
+// Applies the same updates to a bridge that skips unchanged nodes and to one
+// that doesn't, and expects both to end up in the same state.
+class SkipUnchangedNodesTest : public ::testing::Test {
+ protected:
+  SkipUnchangedNodesTest()
+      : skipping_(std::make_shared<EventRecordingBridge>()),
+        applying_(std::make_shared<EventRecordingBridge>()) {
+    applying_->SetSkipUnchangedNodeUpdates(false);
+  }
+
+  // Sends the nodes of |tree_| identified by |ids| to both bridges, commits
+  // them and compares the resulting trees and events.
+  void SendAndCompare(const std::vector<int32_t>& ids) {
+    for (EventRecordingBridge* bridge : {skipping_.get(), applying_.get()}) {
+      for (int32_t id : ids) {
+        bridge->AddFlutterSemanticsNodeUpdate(
+            CreateSemanticsNode(id, tree_[id]));
+      }
+      bridge->CommitUpdates();
+    }
+    EXPECT_EQ(DumpTree(*skipping_), DumpTree(*applying_));
+    EXPECT_EQ(skipping_->events, applying_->events);
+    skipping_->events.clear();
+    applying_->events.clear();
+  }
+
+  // Sends all nodes of |tree_|, as the framework does after a rebuild.
+  void SendAllAndCompare() {
+    std::vector<int32_t> ids;
+    for (const auto& [id, node] : tree_) {
+      ids.push_back(id);
+    }
+    SendAndCompare(ids);
+  }
+
+  TestTree tree_;
+  std::shared_ptr<EventRecordingBridge> skipping_;
+  std::shared_ptr<EventRecordingBridge> applying_;
+};
+
+}  // namespace
+
+TEST_F(SkipUnchangedNodesTest, SameTreesAndEvents) {
+  tree_[0].children = {1, 2, 3};
+  tree_[1].label = "title";
+  tree_[1].flags.is_header = true;
+  tree_[2].label = "status";
+  tree_[2].flags.is_live_region = true;
+  tree_[3].label = "name";
+  tree_[3].flags.is_text_field = true;
+  tree_[3].flags.is_focused = kFlutterTristateFalse;
+  SendAllAndCompare();
+
+  // Nothing changed.
+  SendAllAndCompare();
+  EXPECT_EQ(skipping_->skipped_node_update_count(), 4u);
+
+  // A live region changes among unchanged nodes.
+  tree_[2].label = "done";
+  SendAllAndCompare();
+
+  // The text field gains focus, then its selection changes.
+  tree_[3].flags.is_focused = kFlutterTristateTrue;
+  tree_[3].value = "abc";
+  tree_[3].selection_base = 3;
+  tree_[3].selection_extent = 3;
+  SendAllAndCompare();
+  tree_[3].selection_base = 1;
+  SendAllAndCompare();
+
+  // A node moves.
+  tree_[1].rect = {10, 10, 110, 110};
+  SendAllAndCompare();
+
+  // The text field is reparented, which recreates it.
+  tree_[0].children = {1, 2};
+  tree_[1].children = {3};
+  SendAllAndCompare();
+
+  // A node is removed and added back with the same properties.
+  tree_[0].children = {1};
+  SendAndCompare({0});
+  tree_[0].children = {1, 2};
+  SendAllAndCompare();
+
+  // Nothing changed again.
+  SendAllAndCompare();
+
+  EXPECT_GT(skipping_->skipped_node_update_count(), 4u);
+  EXPECT_EQ(applying_->skipped_node_update_count(), 0u);
+  EXPECT_LT(skipping_->applied_node_update_count(),
+            applying_->applied_node_update_count());
+}
+
+}  // namespace testing
+}  // namespace flutter
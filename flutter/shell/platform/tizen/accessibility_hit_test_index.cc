@@ -0,0 +1,236 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/tizen/accessibility_hit_test_index.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "flutter/third_party/accessibility/ax/ax_tree.h"
+#include "flutter/third_party/accessibility/gfx/geometry/rect_conversions.h"
+
+namespace flutter {
+
+namespace {
+
+// The average number of nodes per grid cell the grid is sized for.
+constexpr size_t kNodesPerCell = 4;
+
+// The maximum number of columns and rows of the grid.
+constexpr int kMaxGridDimension = 128;
+
+}  // namespace
+
+void AccessibilityHitTestIndex::Build(const ui::AXTree& tree) {
+  Clear();
+  const ui::AXNode* root = tree.root();
+  if (!root) {
+    return;
+  }
+
+  // Walk the tree iteratively in pre-order, as semantics trees can be deep.
+  struct Frame {
+    const ui::AXNode* node;
+    int32_t index;
+    size_t next_child;
+  };
+  std::vector<Frame> stack;
+  AddNode(tree, root, -1);
+  stack.push_back({root, 0, 0});
+  while (!stack.empty()) {
+    Frame& frame = stack.back();
+    if (frame.next_child == frame.node->children().size()) {
+      entries_[frame.index].subtree_end = static_cast<int32_t>(entries_.size());
+      stack.pop_back();
+      continue;
+    }
+    const ui::AXNode* child = frame.node->children()[frame.next_child++];
+    const Entry& parent = entries_[frame.index];
+    int32_t index = static_cast<int32_t>(entries_.size());
+    AddNode(tree, child,
+            parent.ignored ? parent.unignored_parent : frame.index);
+    stack.push_back({child, index, 0});
+  }
+
+  BuildGrid();
+}
+
+void AccessibilityHitTestIndex::Clear() {
+  entries_.clear();
+  index_of_id_.clear();
+  grid_bounds_ = gfx::Rect();
+  columns_ = 0;
+  rows_ = 0;
+  cell_starts_.clear();
+  cell_entries_.clear();
+  large_entries_.clear();
+}
+
+ui::AXNode::AXID AccessibilityHitTestIndex::HitTest(
+    ui::AXNode::AXID start_id,
+    const gfx::Point& point) const {
+  auto iter = index_of_id_.find(start_id);
+  if (iter == index_of_id_.end()) {
+    return ui::AXNode::kInvalidAXID;
+  }
+  int32_t start = iter->second;
+  int32_t start_end = entries_[start].subtree_end;
+
+  candidates_.clear();
+  auto add_candidate = [this, &point, start, start_end](int32_t index) {
+    if (index > start && index < start_end &&
+        entries_[index].bounds.Contains(point)) {
+      candidates_.push_back(index);
+    }
+  };
+  if (grid_bounds_.Contains(point)) {
+    int column, row, last_column, last_row;
+    GetCellRange(gfx::Rect(point, gfx::Size(1, 1)), &column, &row,
+                 &last_column, &last_row);
+    size_t cell = static_cast<size_t>(row) * columns_ + column;
+    for (uint32_t i = cell_starts_[cell]; i < cell_starts_[cell + 1]; i++) {
+      add_candidate(cell_entries_[i]);
+    }
+  }
+  for (int32_t index : large_entries_) {
+    add_candidate(index);
+  }
+
+  // Descend from the start node, following the first child containing the
+  // point at each level. The candidates in pre-order list every child before
+  // its descendants and siblings in order, so a single pass is enough.
+  std::sort(candidates_.begin(), candidates_.end());
+  int32_t current = start;
+  for (int32_t index : candidates_) {
+    if (index >= entries_[current].subtree_end) {
+      break;
+    }
+    // Children of an ignored start node are parented to its ancestors.
+    if (entries_[index].unignored_parent <= current) {
+      current = index;
+    }
+  }
+
+  const Entry& result = entries_[current];
+  if (current == start &&
+      (result.ignored || !result.bounds.Contains(point))) {
+    return ui::AXNode::kInvalidAXID;
+  }
+  return result.id;
+}
+
+gfx::Rect AccessibilityHitTestIndex::GetBounds(ui::AXNode::AXID id) const {
+  auto iter = index_of_id_.find(id);
+  if (iter == index_of_id_.end()) {
+    return gfx::Rect();
+  }
+  return entries_[iter->second].bounds;
+}
+
+void AccessibilityHitTestIndex::AddNode(const ui::AXTree& tree,
+                                        const ui::AXNode* node,
+                                        int32_t unignored_parent) {
+  int32_t index = static_cast<int32_t>(entries_.size());
+  bool offscreen = false;
+  gfx::RectF bounds =
+      tree.RelativeToTreeBounds(node, gfx::RectF(), &offscreen, false);
+  entries_.push_back({node->id(), unignored_parent, index + 1,
+                      node->IsIgnored(), gfx::ToEnclosingRect(bounds)});
+  index_of_id_[node->id()] = index;
+}
+
+void AccessibilityHitTestIndex::BuildGrid() {
+  size_t count = 0;
+  for (const Entry& entry : entries_) {
+    if (!entry.ignored && !entry.bounds.IsEmpty()) {
+      grid_bounds_.Union(entry.bounds);
+      count++;
+    }
+  }
+  if (count == 0) {
+    return;
+  }
+
+  int dimension = static_cast<int>(std::sqrt(count / kNodesPerCell));
+  dimension = std::clamp(dimension, 1, kMaxGridDimension);
+  columns_ = std::min(dimension, grid_bounds_.width());
+  rows_ = std::min(dimension, grid_bounds_.height());
+  size_t cell_count = static_cast<size_t>(columns_) * rows_;
+  // A node overlapping more cells than this is checked on every hit test
+  // rather than stored in each cell.
+  size_t max_cells_per_entry = std::max<size_t>(cell_count / 4, 1);
+
+  // Count the entries of each cell, then fill them in.
+  cell_starts_.assign(cell_count + 1, 0);
+  for (int32_t i = 0; i < static_cast<int32_t>(entries_.size()); i++) {
+    const Entry& entry = entries_[i];
+    if (entry.ignored || entry.bounds.IsEmpty()) {
+      continue;
+    }
+    int first_column, first_row, last_column, last_row;
+    GetCellRange(entry.bounds, &first_column, &first_row, &last_column,
+                 &last_row);
+    size_t cells = static_cast<size_t>(last_column - first_column + 1) *
+                   (last_row - first_row + 1);
+    if (cells > max_cells_per_entry) {
+      large_entries_.push_back(i);
+      continue;
+    }
+    for (int row = first_row; row <= last_row; row++) {
+      for (int column = first_column; column <= last_column; column++) {
+        cell_starts_[static_cast<size_t>(row) * columns_ + column + 1]++;
+      }
+    }
+  }
+  for (size_t cell = 0; cell < cell_count; cell++) {
+    cell_starts_[cell + 1] += cell_starts_[cell];
+  }
+
+  cell_entries_.resize(cell_starts_[cell_count]);
+  std::vector<uint32_t> cell_ends(cell_starts_.begin(),
+                                  cell_starts_.end() - 1);
+  size_t next_large_entry = 0;
+  for (int32_t i = 0; i < static_cast<int32_t>(entries_.size()); i++) {
+    const Entry& entry = entries_[i];
+    if (entry.ignored || entry.bounds.IsEmpty()) {
+      continue;
+    }
+    if (next_large_entry < large_entries_.size() &&
+        large_entries_[next_large_entry] == i) {
+      next_large_entry++;
+      continue;
+    }
+    int first_column, first_row, last_column, last_row;
+    GetCellRange(entry.bounds, &first_column, &first_row, &last_column,
+                 &last_row);
+    for (int row = first_row; row <= last_row; row++) {
+      for (int column = first_column; column <= last_column; column++) {
+        cell_entries_[cell_ends[static_cast<size_t>(row) * columns_ +
+                                column]++] = i;
+      }
+    }
+  }
+}
+
+void AccessibilityHitTestIndex::GetCellRange(const gfx::Rect& rect,
+                                             int* first_column,
+                                             int* first_row,
+                                             int* last_column,
+                                             int* last_row) const {
+  auto to_cell = [](int coordinate, int origin, int length, int cells) {
+    int64_t cell = static_cast<int64_t>(coordinate - origin) * cells / length;
+    return static_cast<int>(std::clamp<int64_t>(cell, 0, cells - 1));
+  };
+  *first_column =
+      to_cell(rect.x(), grid_bounds_.x(), grid_bounds_.width(), columns_);
+  *last_column =
+      to_cell(rect.right() - 1, grid_bounds_.x(), grid_bounds_.width(),
+              columns_);
+  *first_row =
+      to_cell(rect.y(), grid_bounds_.y(), grid_bounds_.height(), rows_);
+  *last_row = to_cell(rect.bottom() - 1, grid_bounds_.y(),
+                      grid_bounds_.height(), rows_);
+}
+
+}  // namespace flutter
@@ -0,0 +1,99 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef EMBEDDER_ACCESSIBILITY_HIT_TEST_INDEX_H_
+#define EMBEDDER_ACCESSIBILITY_HIT_TEST_INDEX_H_
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "flutter/third_party/accessibility/ax/ax_node.h"
+#include "flutter/third_party/accessibility/gfx/geometry/point.h"
+#include "flutter/third_party/accessibility/gfx/geometry/rect.h"
+
+namespace ui {
+class AXTree;
+}  // namespace ui
+
+namespace flutter {
+
+// A snapshot of the screen bounds of all nodes in an accessibility tree,
+// bucketed into a uniform grid so that a point can be hit tested without
+// walking the tree or recomputing any bounds.
+//
+// The index must be rebuilt whenever the tree changes.
+class AccessibilityHitTestIndex {
+ public:
+  AccessibilityHitTestIndex() = default;
+
+  // Prevent copying.
+  AccessibilityHitTestIndex(AccessibilityHitTestIndex const&) = delete;
+  AccessibilityHitTestIndex& operator=(AccessibilityHitTestIndex const&) =
+      delete;
+
+  // Rebuilds the index from the current state of |tree|.
+  void Build(const ui::AXTree& tree);
+
+  void Clear();
+
+  // Returns the deepest unignored descendant of the node |start_id| whose
+  // bounds contain |point|, or the node itself if none of its descendants
+  // does. At each level the first child containing the point is followed.
+  // Returns kInvalidAXID if neither the node nor any of its unignored
+  // children contain the point, or if the node is unknown.
+  ui::AXNode::AXID HitTest(ui::AXNode::AXID start_id,
+                           const gfx::Point& point) const;
+
+  // Returns the cached screen bounds of the node |id|, or an empty rect if the
+  // node is unknown.
+  gfx::Rect GetBounds(ui::AXNode::AXID id) const;
+
+  size_t node_count() const { return entries_.size(); }
+
+ private:
+  struct Entry {
+    ui::AXNode::AXID id;
+    // The pre-order index of the closest unignored ancestor, or -1.
+    int32_t unignored_parent;
+    // One past the pre-order index of the last node in the subtree.
+    int32_t subtree_end;
+    bool ignored;
+    gfx::Rect bounds;
+  };
+
+  void AddNode(const ui::AXTree& tree,
+               const ui::AXNode* node,
+               int32_t unignored_parent);
+  void BuildGrid();
+
+  // Returns the range of grid cells overlapped by |rect|.
+  void GetCellRange(const gfx::Rect& rect,
+                    int* first_column,
+                    int* first_row,
+                    int* last_column,
+                    int* last_row) const;
+
+  // The nodes in pre-order.
+  std::vector<Entry> entries_;
+  std::unordered_map<ui::AXNode::AXID, int32_t> index_of_id_;
+
+  // The indices of the unignored nodes overlapping each cell, stored
+  // contiguously per cell. The entries of cell i start at cell_starts_[i].
+  gfx::Rect grid_bounds_;
+  int columns_ = 0;
+  int rows_ = 0;
+  std::vector<uint32_t> cell_starts_;
+  std::vector<int32_t> cell_entries_;
+  // The nodes overlapping too many cells to be stored in each of them, such as
+  // full-screen containers. These are checked on every hit test.
+  std::vector<int32_t> large_entries_;
+
+  // Scratch storage for HitTest().
+  mutable std::vector<int32_t> candidates_;
+};
+
+}  // namespace flutter
+
+#endif  // EMBEDDER_ACCESSIBILITY_HIT_TEST_INDEX_H_
@@ -0,0 +1,249 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/tizen/accessibility_hit_test_index.h"
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "flutter/third_party/accessibility/ax/ax_tree.h"
+#include "flutter/third_party/accessibility/ax/ax_tree_update.h"
+#include "flutter/third_party/accessibility/gfx/geometry/rect_conversions.h"
+#include "flutter/third_party/accessibility/gfx/transform.h"
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+ui::AXNodeData CreateNode(int32_t id,
+                          float x,
+                          float y,
+                          float width,
+                          float height,
+                          std::vector<int32_t> child_ids = {}) {
+  ui::AXNodeData node;
+  node.id = id;
+  node.relative_bounds.bounds = gfx::RectF(x, y, width, height);
+  node.child_ids = std::move(child_ids);
+  return node;
+}
+
+std::unique_ptr<ui::AXTree> CreateTree(std::vector<ui::AXNodeData> nodes) {
+  ui::AXTreeUpdate update;
+  update.root_id = nodes[0].id;
+  update.nodes = std::move(nodes);
+  auto tree = std::make_unique<ui::AXTree>();
+  EXPECT_TRUE(tree->Unserialize(update)) << tree->error();
+  return tree;
+}
+
+// Hit tests by walking the tree and computing the bounds of every child on
+// the way, as the index is expected to.
+ui::AXNode::AXID HitTestByWalking(const ui::AXTree& tree,
+                                  const ui::AXNode* node,
+                                  const gfx::Point& point) {
+  auto contains = [&tree, &point](const ui::AXNode* node) {
+    return gfx::ToEnclosingRect(
+               tree.RelativeToTreeBounds(node, gfx::RectF(), nullptr, false))
+        .Contains(point);
+  };
+  const ui::AXNode* result = nullptr;
+  bool found = true;
+  while (found) {
+    found = false;
+    for (auto iter = node->UnignoredChildrenBegin();
+         iter != node->UnignoredChildrenEnd(); ++iter) {
+      if (contains(iter.get())) {
+        result = node = iter.get();
+        found = true;
+        break;
+      }
+    }
+  }
+  if (!result && contains(node)) {
+    result = node;
+  }
+  return result ? result->id() : ui::AXNode::kInvalidAXID;
+}
+
+// Creates a scrollable grid of |rows| rows with |columns| cells each, where
+// every node is offset relative to its parent as in Flutter semantics trees.
+std::unique_ptr<ui::AXTree> CreateGridTree(int32_t rows, int32_t columns) {
+  constexpr float kCellSize = 20;
+  std::vector<ui::AXNodeData> nodes;
+  std::vector<int32_t> row_ids;
+  for (int32_t row = 0; row < rows; row++) {
+    row_ids.push_back(row + 2);
+  }
+  nodes.push_back(CreateNode(1, 0, 0, columns * kCellSize, rows * kCellSize,
+                             std::move(row_ids)));
+  int32_t next_id = rows + 2;
+  for (int32_t row = 0; row < rows; row++) {
+    std::vector<int32_t> cell_ids;
+    for (int32_t column = 0; column < columns; column++) {
+      cell_ids.push_back(next_id + column);
+    }
+    nodes.push_back(CreateNode(row + 2, 0, row * kCellSize,
+                               columns * kCellSize, kCellSize, cell_ids));
+    nodes.back().relative_bounds.offset_container_id = 1;
+    for (int32_t column = 0; column < columns; column++) {
+      // Leave a gap between the cells.
+      nodes.push_back(CreateNode(next_id++, column * kCellSize + 1, 1,
+                                 kCellSize - 2, kCellSize - 2));
+      nodes.back().relative_bounds.offset_container_id = row + 2;
+    }
+  }
+  return CreateTree(std::move(nodes));
+}
+
+}  // namespace
+
+TEST(AccessibilityHitTestIndexTest, ReturnsDeepestNode) {
+  auto tree = CreateTree({
+      CreateNode(1, 0, 0, 800, 600, {2, 3}),
+      CreateNode(2, 0, 0, 400, 600, {4}),
+      CreateNode(3, 400, 0, 400, 600),
+      CreateNode(4, 10, 10, 100, 100),
+  });
+  AccessibilityHitTestIndex index;
+  index.Build(*tree);
+  EXPECT_EQ(index.node_count(), 4u);
+
+  EXPECT_EQ(index.HitTest(1, gfx::Point(20, 20)), 4);
+  EXPECT_EQ(index.HitTest(1, gfx::Point(200, 300)), 2);
+  EXPECT_EQ(index.HitTest(1, gfx::Point(500, 300)), 3);
+  EXPECT_EQ(index.HitTest(1, gfx::Point(900, 300)), ui::AXNode::kInvalidAXID);
+
+  // Only the subtree of the start node is searched.
+  EXPECT_EQ(index.HitTest(3, gfx::Point(20, 20)), ui::AXNode::kInvalidAXID);
+  EXPECT_EQ(index.HitTest(2, gfx::Point(20, 20)), 4);
+  EXPECT_EQ(index.HitTest(5, gfx::Point(20, 20)), ui::AXNode::kInvalidAXID);
+}
+
+TEST(AccessibilityHitTestIndexTest, FollowsFirstChildContainingPoint) {
+  auto tree = CreateTree({
+      CreateNode(1, 0, 0, 800, 600, {2, 3}),
+      CreateNode(2, 0, 0, 400, 400, {4}),
+      CreateNode(3, 0, 0, 800, 600, {5}),
+      CreateNode(4, 300, 300, 50, 50),
+      CreateNode(5, 0, 0, 100, 100),
+  });
+  AccessibilityHitTestIndex index;
+  index.Build(*tree);
+
+  // Node 3 is never searched where it overlaps node 2.
+  EXPECT_EQ(index.HitTest(1, gfx::Point(50, 50)), 2);
+  EXPECT_EQ(index.HitTest(1, gfx::Point(310, 310)), 4);
+  EXPECT_EQ(index.HitTest(1, gfx::Point(500, 500)), 3);
+}
+
+TEST(AccessibilityHitTestIndexTest, AppliesOffsetContainersAndTransforms) {
+  std::vector<ui::AXNodeData> nodes = {
+      CreateNode(1, 0, 0, 800, 600, {2}),
+      CreateNode(2, 100, 100, 200, 200, {3}),
+      CreateNode(3, 10, 10, 20, 20),
+  };
+  nodes[1].relative_bounds.offset_container_id = 1;
+  nodes[1].relative_bounds.transform = std::make_unique<gfx::Transform>();
+  nodes[1].relative_bounds.transform->Scale(2, 2);
+  nodes[2].relative_bounds.offset_container_id = 2;
+  auto tree = CreateTree(std::move(nodes));
+  AccessibilityHitTestIndex index;
+  index.Build(*tree);
+
+  EXPECT_EQ(index.GetBounds(2).ToString(), "200,200 400x400");
+  EXPECT_EQ(index.GetBounds(3).ToString(), "220,220 40x40");
+  EXPECT_TRUE(index.GetBounds(4).IsEmpty());
+  EXPECT_EQ(index.HitTest(1, gfx::Point(230, 230)), 3);
+  EXPECT_EQ(index.HitTest(1, gfx::Point(150, 150)), 1);
+}
+
+TEST(AccessibilityHitTestIndexTest, SkipsIgnoredNodes) {
+  std::vector<ui::AXNodeData> nodes = {
+      CreateNode(1, 0, 0, 800, 600, {2}),
+      CreateNode(2, 0, 0, 400, 400, {3, 4}),
+      CreateNode(3, 0, 0, 100, 100),
+      CreateNode(4, 200, 200, 100, 100),
+  };
+  nodes[1].AddState(ax::mojom::State::kIgnored);
+  auto tree = CreateTree(std::move(nodes));
+  AccessibilityHitTestIndex index;
+  index.Build(*tree);
+
+  EXPECT_EQ(index.HitTest(1, gfx::Point(50, 50)), 3);
+  EXPECT_EQ(index.HitTest(1, gfx::Point(250, 250)), 4);
+  EXPECT_EQ(index.HitTest(1, gfx::Point(150, 150)), 1);
+  // An ignored node is never returned, but its children are searched.
+  EXPECT_EQ(index.HitTest(2, gfx::Point(50, 50)), 3);
+  EXPECT_EQ(index.HitTest(2, gfx::Point(150, 150)), ui::AXNode::kInvalidAXID);
+}
+
+TEST(AccessibilityHitTestIndexTest, MatchesTreeWalkOnGrid) {
+  auto tree = CreateGridTree(50, 20);
+  AccessibilityHitTestIndex index;
+  index.Build(*tree);
+  ASSERT_EQ(index.node_count(), 1u + 50 + 50 * 20);
+
+  const ui::AXNode* root = tree->root();
+  for (int y = -5; y < 50 * 20 + 5; y += 3) {
+    for (int x = -5; x < 20 * 20 + 5; x += 3) {
+      gfx::Point point(x, y);
+      ASSERT_EQ(index.HitTest(root->id(), point),
+                HitTestByWalking(*tree, root, point))
+          << x << ", " << y;
+    }
+  }
+
+  index.Clear();
+  EXPECT_EQ(index.node_count(), 0u);
+  EXPECT_EQ(index.HitTest(root->id(), gfx::Point(10, 10)),
+            ui::AXNode::kInvalidAXID);
+}
+
+// Compares hit testing a 10k-node grid through the index with walking the
+// tree. Run with --gtest_also_run_disabled_tests.
+TEST(AccessibilityHitTestIndexTest, DISABLED_GridBenchmark) {
+  constexpr int kQueries = 10000;
+  auto tree = CreateGridTree(100, 100);
+  const ui::AXNode* root = tree->root();
+
+  auto start = std::chrono::steady_clock::now();
+  AccessibilityHitTestIndex index;
+  index.Build(*tree);
+  auto build_time = std::chrono::steady_clock::now() - start;
+
+  auto measure = [root](auto hit_test) {
+    int32_t hits = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kQueries; i++) {
+      gfx::Point point((i * 37) % 2000, (i * 91) % 2000);
+      hits += hit_test(root, point) != root->id();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    EXPECT_GT(hits, 0);
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+               .count() /
+           kQueries;
+  };
+  int64_t indexed = measure([&index](const ui::AXNode* root, gfx::Point point) {
+    return index.HitTest(root->id(), point);
+  });
+  int64_t walked = measure([&tree](const ui::AXNode* root, gfx::Point point) {
+    return HitTestByWalking(*tree, root, point);
+  });
+
+  std::cout << "Build: "
+            << std::chrono::duration_cast<std::chrono::microseconds>(
+                   build_time)
+                   .count()
+            << " us, indexed: " << indexed << " ns, walked: " << walked
+            << " ns per hit test" << std::endl;
+}
+
+}  // namespace testing
+}  // namespace flutter
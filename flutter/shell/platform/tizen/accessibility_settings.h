@@ -16,6 +16,9 @@ class AccessibilitySettings {
   explicit AccessibilitySettings(FlutterTizenEngine* engine);
   virtual ~AccessibilitySettings();
 
+  // Whether the screen reader is turned on in the system settings.
+  virtual bool screen_reader_enabled() const { return screen_reader_enabled_; }
+
  private:
   static void OnHighContrastStateChanged(system_settings_key_e key,
                                          void* user_data);
@@ -23,7 +26,7 @@ class AccessibilitySettings {
                                          void* user_data);
 
   [[maybe_unused]] FlutterTizenEngine* engine_;
-  [[maybe_unused]] bool screen_reader_enabled_ = false;
+  bool screen_reader_enabled_ = false;
 };
 
 }  // namespace flutter
@@ -0,0 +1,86 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "frame_statistics_channel.h"
+
+#include "flutter/shell/platform/common/client_wrapper/include/flutter/standard_method_codec.h"
+
+namespace flutter {
+
+namespace {
+
+constexpr char kChannelName[] = "tizen/frame_statistics";
+
+EncodableList ToEncodableList(const uint64_t* values, size_t count) {
+  EncodableList list;
+  for (size_t i = 0; i < count; i++) {
+    list.push_back(EncodableValue(static_cast<int64_t>(values[i])));
+  }
+  return list;
+}
+
+}  // namespace
+
+FrameStatisticsChannel::FrameStatisticsChannel(
+    BinaryMessenger* messenger,
+    FrameStatistics* frame_statistics)
+    : frame_statistics_(frame_statistics) {
+  channel_ = std::make_unique<MethodChannel<EncodableValue>>(
+      messenger, kChannelName, &StandardMethodCodec::GetInstance());
+  channel_->SetMethodCallHandler(
+      [this](const MethodCall<EncodableValue>& call,
+             std::unique_ptr<MethodResult<EncodableValue>> result) {
+        this->HandleMethodCall(call, std::move(result));
+      });
+}
+
+FrameStatisticsChannel::~FrameStatisticsChannel() {}
+
+void FrameStatisticsChannel::HandleMethodCall(
+    const MethodCall<EncodableValue>& method_call,
+    std::unique_ptr<MethodResult<EncodableValue>> result) {
+  const std::string& method_name = method_call.method_name();
+
+  if (method_name == "setEnabled") {
+    const auto* enabled = std::get_if<bool>(method_call.arguments());
+    if (!enabled) {
+      result->Error("Invalid arguments");
+      return;
+    }
+    frame_statistics_->SetEnabled(*enabled);
+    result->Success();
+  } else if (method_name == "getStatistics") {
+    FlutterDesktopFrameStatistics statistics =
+        frame_statistics_->GetStatistics();
+    EncodableMap map;
+    map[EncodableValue("frameCount")] =
+        EncodableValue(static_cast<int64_t>(statistics.frame_count));
+    map[EncodableValue("jankyFrameCount")] =
+        EncodableValue(static_cast<int64_t>(statistics.janky_frame_count));
+    map[EncodableValue("missedVblankCount")] =
+        EncodableValue(static_cast<int64_t>(statistics.missed_vblank_count));
+    map[EncodableValue("averagePresentLatency")] = EncodableValue(
+        static_cast<int64_t>(statistics.average_present_latency_nanos));
+    map[EncodableValue("maxPresentLatency")] = EncodableValue(
+        static_cast<int64_t>(statistics.max_present_latency_nanos));
+    map[EncodableValue("averageSwapDuration")] = EncodableValue(
+        static_cast<int64_t>(statistics.average_swap_duration_nanos));
+    map[EncodableValue("maxSwapDuration")] = EncodableValue(
+        static_cast<int64_t>(statistics.max_swap_duration_nanos));
+    map[EncodableValue("presentLatencyHistogram")] =
+        EncodableValue(ToEncodableList(statistics.present_latency_histogram,
+                                       FLUTTER_DESKTOP_FRAME_HISTOGRAM_SIZE));
+    map[EncodableValue("swapDurationHistogram")] =
+        EncodableValue(ToEncodableList(statistics.swap_duration_histogram,
+                                       FLUTTER_DESKTOP_FRAME_HISTOGRAM_SIZE));
+    result->Success(EncodableValue(map));
+  } else if (method_name == "reset") {
+    frame_statistics_->Reset();
+    result->Success();
+  } else {
+    result->NotImplemented();
+  }
+}
+
+}  // namespace flutter
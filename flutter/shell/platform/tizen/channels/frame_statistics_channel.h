@@ -0,0 +1,36 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef EMBEDDER_FRAME_STATISTICS_CHANNEL_H_
+#define EMBEDDER_FRAME_STATISTICS_CHANNEL_H_
+
+#include <memory>
+
+#include "flutter/shell/platform/common/client_wrapper/include/flutter/binary_messenger.h"
+#include "flutter/shell/platform/common/client_wrapper/include/flutter/encodable_value.h"
+#include "flutter/shell/platform/common/client_wrapper/include/flutter/method_channel.h"
+#include "flutter/shell/platform/tizen/frame_statistics.h"
+
+namespace flutter {
+
+// Channel to control and query the embedder's frame statistics.
+class FrameStatisticsChannel {
+ public:
+  explicit FrameStatisticsChannel(BinaryMessenger* messenger,
+                                  FrameStatistics* frame_statistics);
+  virtual ~FrameStatisticsChannel();
+
+ private:
+  void HandleMethodCall(const MethodCall<EncodableValue>& method_call,
+                        std::unique_ptr<MethodResult<EncodableValue>> result);
+
+  std::unique_ptr<MethodChannel<EncodableValue>> channel_;
+
+  // A reference to the frame statistics owned by FlutterTizenEngine.
+  FrameStatistics* frame_statistics_ = nullptr;
+};
+
+}  // namespace flutter
+
+#endif  // EMBEDDER_FRAME_STATISTICS_CHANNEL_H_
@@ -40,6 +40,14 @@ class ExternalTexture {
                                size_t height,
                                FlutterOpenGLTexture* opengl_texture) = 0;
 
+  // Releases scratch memory that the next PopulateTexture call recreates.
+  // The GL texture holding the last frame is kept, since the engine may
+  // draw it again without populating the texture, such as for a paused video.
+  // Called on the render thread.
+  //
+  // Returns the number of bytes released.
+  virtual size_t ReleaseCachedMemory() { return 0; }
+
  protected:
   std::unique_ptr<ExternalTextureGLState> state_;
   const int64_t texture_id_ = 0;
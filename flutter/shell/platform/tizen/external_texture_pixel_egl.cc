@@ -9,8 +9,26 @@
 #include <GLES2/gl2.h>
 #include <GLES2/gl2ext.h>
 
+#include <cstring>
+
+#include "flutter/shell/platform/tizen/pixel_format_converter.h"
+
 namespace flutter {
 
+namespace {
+
+bool HasGLExtension(const char* extensions, const char* name) {
+  return extensions && strstr(extensions, name) != nullptr;
+}
+
+}  // namespace
+
+ExternalTexturePixelEGL::~ExternalTexturePixelEGL() {
+  if (state_->gl_texture != 0) {
+    glDeleteTextures(1, static_cast<GLuint*>(&state_->gl_texture));
+  }
+}
+
 bool ExternalTexturePixelEGL::PopulateTexture(
     size_t width,
     size_t height,
@@ -22,7 +40,7 @@ bool ExternalTexturePixelEGL::PopulateTexture(
   // Populate the texture object used by the engine.
   opengl_texture->target = GL_TEXTURE_2D;
   opengl_texture->name = state_->gl_texture;
-  opengl_texture->format = GL_RGBA8_OES;
+  opengl_texture->format = texture_format_;
   opengl_texture->destruction_callback = nullptr;
   opengl_texture->user_data = nullptr;
   opengl_texture->width = width;
@@ -37,20 +55,28 @@ ExternalTexturePixelEGL::ExternalTexturePixelEGL(
       texture_callback_(texture_callback),
       user_data_(user_data) {}
 
-bool ExternalTexturePixelEGL::CopyPixelBuffer(size_t& width, size_t& height) {
-  if (!texture_callback_) {
-    return false;
-  }
+ExternalTexturePixelEGL::ExternalTexturePixelEGL(
+    FlutterDesktopPixelBufferDescriptorTextureCallback descriptor_callback,
+    void* user_data)
+    : ExternalTexture(),
+      descriptor_callback_(descriptor_callback),
+      user_data_(user_data) {}
 
-  const FlutterDesktopPixelBuffer* pixel_buffer =
-      texture_callback_(width, height, user_data_);
+size_t ExternalTexturePixelEGL::ReleaseCachedMemory() {
+  size_t released = converted_pixels_.capacity();
+  std::vector<uint8_t>().swap(converted_pixels_);
+  return released;
+}
 
-  if (!pixel_buffer || !pixel_buffer->buffer) {
+bool ExternalTexturePixelEGL::CopyPixelBuffer(size_t& width, size_t& height) {
+  FlutterDesktopPixelBufferDescriptor pixel_buffer;
+  if (!ObtainPixelBuffer(texture_callback_, descriptor_callback_, user_data_,
+                         width, height, &pixel_buffer)) {
     return false;
   }
 
-  width = pixel_buffer->width;
-  height = pixel_buffer->height;
+  width = pixel_buffer.width;
+  height = pixel_buffer.height;
 
   if (state_->gl_texture == 0) {
     glGenTextures(1, static_cast<GLuint*>(&state_->gl_texture));
@@ -62,10 +88,57 @@ bool ExternalTexturePixelEGL::CopyPixelBuffer(size_t& width, size_t& height) {
   } else {
     glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(state_->gl_texture));
   }
-  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, pixel_buffer->width,
-               pixel_buffer->height, 0, GL_RGBA, GL_UNSIGNED_BYTE,
-               pixel_buffer->buffer);
+  UploadPixelBuffer(pixel_buffer);
+
+  // The pixels have been copied by glTexImage2D.
+  if (pixel_buffer.release_callback) {
+    pixel_buffer.release_callback(pixel_buffer.release_context);
+  }
   return true;
 }
 
+void ExternalTexturePixelEGL::UploadPixelBuffer(
+    const FlutterDesktopPixelBufferDescriptor& buffer) {
+  if (!extensions_queried_) {
+    const char* extensions =
+        reinterpret_cast<const char*>(glGetString(GL_EXTENSIONS));
+    supports_bgra_ =
+        HasGLExtension(extensions, "GL_EXT_texture_format_BGRA8888");
+    supports_unpack_subimage_ =
+        HasGLExtension(extensions, "GL_EXT_unpack_subimage");
+    extensions_queried_ = true;
+  }
+
+  size_t stride = GetPlaneStride(buffer, 0);
+  size_t packed_stride = buffer.width * 4;
+  GLenum format = 0;
+  if (buffer.format == kFlutterDesktopPixelFormatRGBA8888) {
+    format = GL_RGBA;
+  } else if (buffer.format == kFlutterDesktopPixelFormatBGRA8888 &&
+             supports_bgra_) {
+    format = GL_BGRA_EXT;
+  }
+  bool can_unpack_rows =
+      stride == packed_stride || (supports_unpack_subimage_ && stride % 4 == 0);
+
+  if (format != 0 && can_unpack_rows) {
+    if (stride != packed_stride) {
+      glPixelStorei(GL_UNPACK_ROW_LENGTH_EXT, stride / 4);
+    }
+    glTexImage2D(GL_TEXTURE_2D, 0, format, buffer.width, buffer.height, 0,
+                 format, GL_UNSIGNED_BYTE, buffer.planes[0]);
+    if (stride != packed_stride) {
+      glPixelStorei(GL_UNPACK_ROW_LENGTH_EXT, 0);
+    }
+    texture_format_ = format == GL_BGRA_EXT ? GL_BGRA8_EXT : GL_RGBA8_OES;
+    return;
+  }
+
+  converted_pixels_.resize(packed_stride * buffer.height);
+  ConvertToRGBA(buffer, converted_pixels_.data());
+  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, buffer.width, buffer.height, 0,
+               GL_RGBA, GL_UNSIGNED_BYTE, converted_pixels_.data());
+  texture_format_ = GL_RGBA8_OES;
+}
+
 }  // namespace flutter
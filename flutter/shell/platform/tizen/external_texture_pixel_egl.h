@@ -5,6 +5,9 @@
 #ifndef EMBEDDER_EXTERNAL_TEXTURE_PIXEL_EGL_H
 #define EMBEDDER_EXTERNAL_TEXTURE_PIXEL_EGL_H
 
+#include <cstdint>
+#include <vector>
+
 #include "flutter/shell/platform/common/public/flutter_texture_registrar.h"
 #include "flutter/shell/platform/embedder/embedder.h"
 #include "flutter/shell/platform/tizen/external_texture.h"
@@ -17,17 +20,42 @@ class ExternalTexturePixelEGL : public ExternalTexture {
       FlutterDesktopPixelBufferTextureCallback texture_callback,
       void* user_data);
 
-  ~ExternalTexturePixelEGL() = default;
+  ExternalTexturePixelEGL(
+      FlutterDesktopPixelBufferDescriptorTextureCallback descriptor_callback,
+      void* user_data);
+
+  virtual ~ExternalTexturePixelEGL();
 
   bool PopulateTexture(size_t width,
                        size_t height,
                        FlutterOpenGLTexture* opengl_texture) override;
 
+  size_t ReleaseCachedMemory() override;
+
   bool CopyPixelBuffer(size_t& width, size_t& height);
 
  private:
+  // Uploads |buffer| to the bound texture. RGBA and BGRA buffers are uploaded
+  // directly if supported by the GL driver, other buffers are converted to
+  // RGBA first.
+  void UploadPixelBuffer(const FlutterDesktopPixelBufferDescriptor& buffer);
+
   FlutterDesktopPixelBufferTextureCallback texture_callback_ = nullptr;
+  FlutterDesktopPixelBufferDescriptorTextureCallback descriptor_callback_ =
+      nullptr;
   void* user_data_ = nullptr;
+
+  // The sized internal format of the texture.
+  uint32_t texture_format_ = 0;
+
+  // Whether GL_EXT_texture_format_BGRA8888 and GL_EXT_unpack_subimage are
+  // supported, queried on the first upload.
+  bool extensions_queried_ = false;
+  bool supports_bgra_ = false;
+  bool supports_unpack_subimage_ = false;
+
+  // Scratch memory for buffers that are converted before upload.
+  std::vector<uint8_t> converted_pixels_;
 };
 
 }  // namespace flutter
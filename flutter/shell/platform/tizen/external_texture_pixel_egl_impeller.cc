@@ -8,6 +8,7 @@
 #include <EGL/eglext.h>
 
 #include "flutter/shell/platform/tizen/logger.h"
+#include "flutter/shell/platform/tizen/pixel_format_converter.h"
 
 namespace flutter {
 
@@ -15,31 +16,45 @@ bool ExternalTexturePixelEGLImpeller::PopulateTexture(
     size_t width,
     size_t height,
     FlutterOpenGLTexture* opengl_texture) {
-  if (!texture_callback_) {
+  FlutterDesktopPixelBufferDescriptor pixel_buffer;
+  if (!ObtainPixelBuffer(texture_callback_, descriptor_callback_, user_data_,
+                         width, height, &pixel_buffer)) {
     return false;
   }
 
-  const FlutterDesktopPixelBuffer* pixel_buffer =
-      texture_callback_(width, height, user_data_);
+  width = pixel_buffer.width;
+  height = pixel_buffer.height;
 
-  if (!pixel_buffer || !pixel_buffer->buffer) {
-    return false;
+  // Populate the texture object used by the engine. Packed RGBA buffers are
+  // passed to the engine as is and released once the engine has uploaded them.
+  if (pixel_buffer.format == kFlutterDesktopPixelFormatRGBA8888 &&
+      GetPlaneStride(pixel_buffer, 0) == width * 4) {
+    opengl_texture->buffer = pixel_buffer.planes[0];
+    opengl_texture->destruction_callback = pixel_buffer.release_callback;
+    opengl_texture->user_data = pixel_buffer.release_context;
+  } else {
+    converted_pixels_.resize(width * height * 4);
+    ConvertToRGBA(pixel_buffer, converted_pixels_.data());
+    if (pixel_buffer.release_callback) {
+      pixel_buffer.release_callback(pixel_buffer.release_context);
+    }
+    opengl_texture->buffer = converted_pixels_.data();
+    opengl_texture->destruction_callback = nullptr;
+    opengl_texture->user_data = nullptr;
   }
-
-  width = pixel_buffer->width;
-  height = pixel_buffer->height;
-
-  // Populate the texture object used by the engine.
-  opengl_texture->buffer = pixel_buffer->buffer;
-  opengl_texture->buffer_size =
-      size_t(pixel_buffer->width) * size_t(pixel_buffer->height) * 4;
-  opengl_texture->destruction_callback = nullptr;
-  opengl_texture->user_data = nullptr;
+  opengl_texture->buffer_size = width * height * 4;
   opengl_texture->width = width;
   opengl_texture->height = height;
   return true;
 }
 
+size_t ExternalTexturePixelEGLImpeller::ReleaseCachedMemory() {
+  // The texture is owned by the engine.
+  size_t released = converted_pixels_.capacity();
+  std::vector<uint8_t>().swap(converted_pixels_);
+  return released;
+}
+
 ExternalTexturePixelEGLImpeller::ExternalTexturePixelEGLImpeller(
     FlutterDesktopPixelBufferTextureCallback texture_callback,
     void* user_data)
@@ -47,4 +62,11 @@ ExternalTexturePixelEGLImpeller::ExternalTexturePixelEGLImpeller(
       texture_callback_(texture_callback),
       user_data_(user_data) {}
 
+ExternalTexturePixelEGLImpeller::ExternalTexturePixelEGLImpeller(
+    FlutterDesktopPixelBufferDescriptorTextureCallback descriptor_callback,
+    void* user_data)
+    : ExternalTexture(),
+      descriptor_callback_(descriptor_callback),
+      user_data_(user_data) {}
+
 }  // namespace flutter
@@ -5,6 +5,9 @@
 #ifndef EMBEDDER_EXTERNAL_TEXTURE_PIXEL_EGL_IMPELLER_H
 #define EMBEDDER_EXTERNAL_TEXTURE_PIXEL_EGL_IMPELLER_H
 
+#include <cstdint>
+#include <vector>
+
 #include "flutter/shell/platform/common/public/flutter_texture_registrar.h"
 #include "flutter/shell/platform/embedder/embedder.h"
 #include "flutter/shell/platform/tizen/external_texture.h"
@@ -17,15 +20,27 @@ class ExternalTexturePixelEGLImpeller : public ExternalTexture {
       FlutterDesktopPixelBufferTextureCallback texture_callback,
       void* user_data);
 
+  ExternalTexturePixelEGLImpeller(
+      FlutterDesktopPixelBufferDescriptorTextureCallback descriptor_callback,
+      void* user_data);
+
   ~ExternalTexturePixelEGLImpeller() = default;
 
   bool PopulateTexture(size_t width,
                        size_t height,
                        FlutterOpenGLTexture* opengl_texture) override;
 
+  size_t ReleaseCachedMemory() override;
+
  private:
   FlutterDesktopPixelBufferTextureCallback texture_callback_ = nullptr;
+  FlutterDesktopPixelBufferDescriptorTextureCallback descriptor_callback_ =
+      nullptr;
   void* user_data_ = nullptr;
+
+  // Packed RGBA copy of the last buffer that is not in the layout expected by
+  // the engine.
+  std::vector<uint8_t> converted_pixels_;
 };
 
 }  // namespace flutter
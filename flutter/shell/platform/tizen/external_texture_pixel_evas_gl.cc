@@ -4,6 +4,7 @@
 
 #include "external_texture_pixel_evas_gl.h"
 
+#include "flutter/shell/platform/tizen/pixel_format_converter.h"
 #include "flutter/shell/platform/tizen/tizen_evas_gl_helper.h"
 
 extern Evas_GL* g_evas_gl;
@@ -11,6 +12,12 @@ EVAS_GL_GLOBAL_GLES2_DECLARE();
 
 namespace flutter {
 
+ExternalTexturePixelEvasGL::~ExternalTexturePixelEvasGL() {
+  if (state_->gl_texture != 0) {
+    glDeleteTextures(1, static_cast<GLuint*>(&state_->gl_texture));
+  }
+}
+
 bool ExternalTexturePixelEvasGL::PopulateTexture(
     size_t width,
     size_t height,
@@ -37,21 +44,29 @@ ExternalTexturePixelEvasGL::ExternalTexturePixelEvasGL(
       texture_callback_(texture_callback),
       user_data_(user_data) {}
 
-bool ExternalTexturePixelEvasGL::CopyPixelBuffer(size_t& width,
-                                                 size_t& height) {
-  if (!texture_callback_) {
-    return false;
-  }
+ExternalTexturePixelEvasGL::ExternalTexturePixelEvasGL(
+    FlutterDesktopPixelBufferDescriptorTextureCallback descriptor_callback,
+    void* user_data)
+    : ExternalTexture(),
+      descriptor_callback_(descriptor_callback),
+      user_data_(user_data) {}
 
-  const FlutterDesktopPixelBuffer* pixel_buffer =
-      texture_callback_(width, height, user_data_);
+size_t ExternalTexturePixelEvasGL::ReleaseCachedMemory() {
+  size_t released = converted_pixels_.capacity();
+  std::vector<uint8_t>().swap(converted_pixels_);
+  return released;
+}
 
-  if (!pixel_buffer || !pixel_buffer->buffer) {
+bool ExternalTexturePixelEvasGL::CopyPixelBuffer(size_t& width,
+                                                 size_t& height) {
+  FlutterDesktopPixelBufferDescriptor pixel_buffer;
+  if (!ObtainPixelBuffer(texture_callback_, descriptor_callback_, user_data_,
+                         width, height, &pixel_buffer)) {
     return false;
   }
 
-  width = pixel_buffer->width;
-  height = pixel_buffer->height;
+  width = pixel_buffer.width;
+  height = pixel_buffer.height;
 
   if (state_->gl_texture == 0) {
     glGenTextures(1, static_cast<GLuint*>(&state_->gl_texture));
@@ -63,9 +78,23 @@ bool ExternalTexturePixelEvasGL::CopyPixelBuffer(size_t& width,
   } else {
     glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(state_->gl_texture));
   }
-  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, pixel_buffer->width,
-               pixel_buffer->height, 0, GL_RGBA, GL_UNSIGNED_BYTE,
-               pixel_buffer->buffer);
+
+  // Evas GL does not expose the BGRA and unpack row length extensions, so
+  // only packed RGBA buffers can be uploaded as is.
+  const uint8_t* pixels = pixel_buffer.planes[0];
+  if (pixel_buffer.format != kFlutterDesktopPixelFormatRGBA8888 ||
+      GetPlaneStride(pixel_buffer, 0) != width * 4) {
+    converted_pixels_.resize(width * height * 4);
+    ConvertToRGBA(pixel_buffer, converted_pixels_.data());
+    pixels = converted_pixels_.data();
+  }
+  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA,
+               GL_UNSIGNED_BYTE, pixels);
+
+  // The pixels have been copied by glTexImage2D.
+  if (pixel_buffer.release_callback) {
+    pixel_buffer.release_callback(pixel_buffer.release_context);
+  }
   return true;
 }
 
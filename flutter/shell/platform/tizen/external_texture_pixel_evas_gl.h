@@ -5,6 +5,9 @@
 #ifndef EMBEDDER_EXTERNAL_TEXTURE_PIXEL_EVAS_GL_H
 #define EMBEDDER_EXTERNAL_TEXTURE_PIXEL_EVAS_GL_H
 
+#include <cstdint>
+#include <vector>
+
 #include "flutter/shell/platform/common/public/flutter_texture_registrar.h"
 #include "flutter/shell/platform/embedder/embedder.h"
 #include "flutter/shell/platform/tizen/external_texture.h"
@@ -17,17 +20,28 @@ class ExternalTexturePixelEvasGL : public ExternalTexture {
       FlutterDesktopPixelBufferTextureCallback texture_callback,
       void* user_data);
 
-  ~ExternalTexturePixelEvasGL() = default;
+  ExternalTexturePixelEvasGL(
+      FlutterDesktopPixelBufferDescriptorTextureCallback descriptor_callback,
+      void* user_data);
+
+  virtual ~ExternalTexturePixelEvasGL();
 
   bool PopulateTexture(size_t width,
                        size_t height,
                        FlutterOpenGLTexture* opengl_texture) override;
 
+  size_t ReleaseCachedMemory() override;
+
   bool CopyPixelBuffer(size_t& width, size_t& height);
 
  private:
   FlutterDesktopPixelBufferTextureCallback texture_callback_ = nullptr;
+  FlutterDesktopPixelBufferDescriptorTextureCallback descriptor_callback_ =
+      nullptr;
   void* user_data_ = nullptr;
+
+  // Scratch memory for buffers that are not packed RGBA.
+  std::vector<uint8_t> converted_pixels_;
 };
 
 }  // namespace flutter
@@ -0,0 +1,179 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "file_prefetcher.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+namespace flutter {
+
+namespace {
+
+constexpr char kProfileHeader[] = "flutter-tizen-page-profile";
+constexpr int kProfileVersion = 2;
+
+}  // namespace
+
+FilePrefetcher::FilePrefetcher(const std::string& path)
+    : page_size_(static_cast<size_t>(sysconf(_SC_PAGESIZE))) {
+  std::unique_ptr<fml::FileMapping> mapping =
+      fml::FileMapping::CreateReadOnly(path);
+  struct stat file_stat;
+  if (mapping && mapping->GetSize() > 0 &&
+      stat(path.c_str(), &file_stat) == 0) {
+    mapping_ = std::move(mapping);
+    modified_time_ =
+        static_cast<uint64_t>(file_stat.st_mtim.tv_sec) * 1000000000 +
+        file_stat.st_mtim.tv_nsec;
+  }
+}
+
+// The mapping does not need to be kept alive after madvise() returns since the
+// pages are read into the page cache that is shared with the engine's mapping.
+size_t FilePrefetcher::PrefetchAll() {
+  if (!mapping_) {
+    return 0;
+  }
+  uint8_t* base = const_cast<uint8_t*>(mapping_->GetMapping());
+  size_t size = mapping_->GetSize();
+  return madvise(base, size, MADV_WILLNEED) == 0 ? size : 0;
+}
+
+size_t FilePrefetcher::Prefetch(const std::vector<PageRange>& ranges) {
+  if (!mapping_) {
+    return 0;
+  }
+  uint8_t* base = const_cast<uint8_t*>(mapping_->GetMapping());
+  size_t size = mapping_->GetSize();
+  size_t advised = 0;
+  for (const PageRange& range : ranges) {
+    size_t offset = range.first_page * page_size_;
+    if (offset >= size) {
+      continue;
+    }
+    size_t length = std::min(range.page_count * page_size_, size - offset);
+    if (madvise(base + offset, length, MADV_WILLNEED) == 0) {
+      advised += length;
+    }
+  }
+  return advised;
+}
+
+std::vector<FilePrefetcher::PageRange> FilePrefetcher::GetResidentPages()
+    const {
+  if (!mapping_) {
+    return {};
+  }
+  size_t size = mapping_->GetSize();
+  std::vector<unsigned char> residency((size + page_size_ - 1) / page_size_);
+  if (mincore(const_cast<uint8_t*>(mapping_->GetMapping()), size,
+              residency.data()) != 0) {
+    return {};
+  }
+  return ToPageRanges(residency);
+}
+
+bool FilePrefetcher::LoadProfile(const std::string& profile_path,
+                                 std::vector<PageRange>* ranges) const {
+  std::ifstream file(profile_path);
+  if (!file.is_open()) {
+    return false;
+  }
+  std::stringstream buffer;
+  buffer << file.rdbuf();
+  return ParseProfile(buffer.str(), file_size(), modified_time_, page_size_,
+                      ranges);
+}
+
+bool FilePrefetcher::SaveProfile(const std::string& profile_path,
+                                 const std::vector<PageRange>& ranges) const {
+  if (!mapping_) {
+    return false;
+  }
+  std::ofstream file(profile_path, std::ios::trunc);
+  if (!file.is_open()) {
+    return false;
+  }
+  file << SerializeProfile(file_size(), modified_time_, page_size_, ranges);
+  return file.good();
+}
+
+std::vector<FilePrefetcher::PageRange> FilePrefetcher::ToPageRanges(
+    const std::vector<unsigned char>& residency) {
+  std::vector<PageRange> ranges;
+  for (size_t page = 0; page < residency.size(); page++) {
+    // Only the least significant bit is defined by mincore().
+    if (!(residency[page] & 1)) {
+      continue;
+    }
+    if (!ranges.empty() &&
+        ranges.back().first_page + ranges.back().page_count == page) {
+      ranges.back().page_count++;
+    } else {
+      ranges.push_back({page, 1});
+    }
+  }
+  return ranges;
+}
+
+std::string FilePrefetcher::SerializeProfile(
+    size_t file_size,
+    uint64_t modified_time,
+    size_t page_size,
+    const std::vector<PageRange>& ranges) {
+  std::ostringstream stream;
+  stream << kProfileHeader << " " << kProfileVersion << "\n";
+  stream << page_size << " " << file_size << " " << modified_time << "\n";
+  for (const PageRange& range : ranges) {
+    stream << range.first_page << " " << range.page_count << "\n";
+  }
+  return stream.str();
+}
+
+bool FilePrefetcher::ParseProfile(const std::string& profile,
+                                  size_t file_size,
+                                  uint64_t modified_time,
+                                  size_t page_size,
+                                  std::vector<PageRange>* ranges) {
+  std::istringstream stream(profile);
+  std::string header;
+  int version = 0;
+  if (!(stream >> header >> version) || header != kProfileHeader ||
+      version != kProfileVersion) {
+    return false;
+  }
+  size_t profile_page_size = 0;
+  size_t profile_file_size = 0;
+  uint64_t profile_modified_time = 0;
+  if (!(stream >> profile_page_size >> profile_file_size >>
+        profile_modified_time) ||
+      profile_page_size != page_size || profile_file_size != file_size ||
+      profile_modified_time != modified_time) {
+    return false;
+  }
+
+  size_t page_count = (file_size + page_size - 1) / page_size;
+  std::vector<PageRange> result;
+  PageRange range;
+  while (stream >> range.first_page >> range.page_count) {
+    if (range.page_count == 0 || range.first_page >= page_count ||
+        range.page_count > page_count - range.first_page) {
+      return false;
+    }
+    result.push_back(range);
+  }
+  if (!stream.eof()) {
+    return false;
+  }
+  *ranges = std::move(result);
+  return true;
+}
+
+}  // namespace flutter
@@ -0,0 +1,104 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef EMBEDDER_FILE_PREFETCHER_H_
+#define EMBEDDER_FILE_PREFETCHER_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "flutter/fml/mapping.h"
+
+namespace flutter {
+
+// Warms up the page cache for a read-only file, such as the AOT library or the
+// ICU data, so that the engine does not take page faults on its first access.
+//
+// A page profile lists the pages of the file that were resident in memory
+// after a previous run. If a profile recorded for the same file is available,
+// only the profiled pages are prefetched. A profile is tied to the size and
+// the modification time of the file, so that it is recorded again when the
+// file is replaced, e.g. by an app update.
+class FilePrefetcher {
+ public:
+  // A contiguous range of pages of the file.
+  struct PageRange {
+    size_t first_page = 0;
+    size_t page_count = 0;
+
+    bool operator==(const PageRange& other) const {
+      return first_page == other.first_page && page_count == other.page_count;
+    }
+  };
+
+  explicit FilePrefetcher(const std::string& path);
+
+  // Prevent copying.
+  FilePrefetcher(FilePrefetcher const&) = delete;
+  FilePrefetcher& operator=(FilePrefetcher const&) = delete;
+
+  // Whether the file was mapped successfully.
+  bool IsValid() const { return mapping_ != nullptr; }
+
+  size_t file_size() const { return mapping_ ? mapping_->GetSize() : 0; }
+
+  // The modification time of the file in nanoseconds since the epoch.
+  uint64_t modified_time() const { return modified_time_; }
+
+  // Advises the kernel to read the whole file ahead. Reads are asynchronous.
+  //
+  // Returns the number of bytes advised.
+  size_t PrefetchAll();
+
+  // Advises the kernel to read the pages in |ranges| ahead.
+  //
+  // Returns the number of bytes advised.
+  size_t Prefetch(const std::vector<PageRange>& ranges);
+
+  // Returns the pages of the file that are currently in the page cache.
+  std::vector<PageRange> GetResidentPages() const;
+
+  // Reads the page profile at |profile_path| into |ranges|.
+  //
+  // Returns false if the profile does not exist or was recorded for a file of
+  // a different size or modification time.
+  bool LoadProfile(const std::string& profile_path,
+                   std::vector<PageRange>* ranges) const;
+
+  // Writes |ranges| to the page profile at |profile_path|.
+  bool SaveProfile(const std::string& profile_path,
+                   const std::vector<PageRange>& ranges) const;
+
+  // Merges a per-page residency vector as returned by mincore() into ranges.
+  static std::vector<PageRange> ToPageRanges(
+      const std::vector<unsigned char>& residency);
+
+  // Converts page ranges of a |file_size| bytes file last modified at
+  // |modified_time| to the profile format.
+  static std::string SerializeProfile(size_t file_size,
+                                      uint64_t modified_time,
+                                      size_t page_size,
+                                      const std::vector<PageRange>& ranges);
+
+  // Parses a profile previously created by SerializeProfile. Fails if the
+  // profile does not match |file_size|, |modified_time| and |page_size|.
+  static bool ParseProfile(const std::string& profile,
+                           size_t file_size,
+                           uint64_t modified_time,
+                           size_t page_size,
+                           std::vector<PageRange>* ranges);
+
+ private:
+  std::unique_ptr<fml::FileMapping> mapping_;
+
+  size_t page_size_ = 0;
+
+  uint64_t modified_time_ = 0;
+};
+
+}  // namespace flutter
+
+#endif  // EMBEDDER_FILE_PREFETCHER_H_
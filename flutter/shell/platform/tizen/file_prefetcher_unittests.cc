@@ -0,0 +1,215 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/tizen/file_prefetcher.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+using PageRange = FilePrefetcher::PageRange;
+
+constexpr size_t kPageSize = 4096;
+constexpr uint64_t kModifiedTime = 1700000000000000000;
+
+
+// Drops the pages of the file at |path| from the page cache.
+void EvictFromPageCache(const std::string& path) {
+  int fd = open(path.c_str(), O_RDONLY);
+  ASSERT_GE(fd, 0);
+  fdatasync(fd);
+  posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+  close(fd);
+}
+
+// Reads one byte of every page of the file at |path| through a new mapping
+// and returns the elapsed time in microseconds.
+int64_t TouchAllPages(const std::string& path) {
+  auto start = std::chrono::steady_clock::now();
+  std::unique_ptr<fml::FileMapping> mapping =
+      fml::FileMapping::CreateReadOnly(path);
+  volatile uint8_t sum = 0;
+  for (size_t offset = 0; offset < mapping->GetSize(); offset += kPageSize) {
+    sum += mapping->GetMapping()[offset];
+  }
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+}  // namespace
+
+class FilePrefetcherTest : public ::testing::Test {
+ protected:
+  // Removes the files created by the test, including page profiles.
+  void TearDown() override {
+    for (const std::string& path : created_paths_) {
+      std::remove(path.c_str());
+    }
+  }
+
+  // Creates a file of |size| bytes in the temporary directory.
+  std::string CreateTestFile(const std::string& name, size_t size) {
+    std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    std::string page(kPageSize, 'x');
+    for (size_t written = 0; written < size; written += page.size()) {
+      file.write(page.data(), std::min(page.size(), size - written));
+    }
+    created_paths_.push_back(path.string());
+    return path.string();
+  }
+
+  // Returns a path in the temporary directory that is removed on teardown.
+  std::string GetTestPath(const std::string& name) {
+    std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+    created_paths_.push_back(path.string());
+    return path.string();
+  }
+
+ private:
+  std::vector<std::string> created_paths_;
+};
+
+TEST_F(FilePrefetcherTest, ToPageRanges) {
+  std::vector<unsigned char> residency = {1, 1, 0, 0, 1, 0, 3, 1, 1};
+  std::vector<PageRange> ranges = FilePrefetcher::ToPageRanges(residency);
+  ASSERT_EQ(ranges.size(), 3u);
+  EXPECT_EQ(ranges[0], (PageRange{0, 2}));
+  EXPECT_EQ(ranges[1], (PageRange{4, 1}));
+  EXPECT_EQ(ranges[2], (PageRange{6, 3}));
+
+  EXPECT_TRUE(FilePrefetcher::ToPageRanges({0, 0, 2}).empty());
+}
+
+TEST_F(FilePrefetcherTest, ProfileRoundTrip) {
+  std::vector<PageRange> ranges = {{0, 4}, {10, 2}, {20, 1}};
+  std::string profile = FilePrefetcher::SerializeProfile(
+      21 * kPageSize, kModifiedTime, kPageSize, ranges);
+
+  std::vector<PageRange> parsed;
+  ASSERT_TRUE(FilePrefetcher::ParseProfile(profile, 21 * kPageSize,
+                                           kModifiedTime, kPageSize, &parsed));
+  EXPECT_EQ(parsed, ranges);
+
+  // An empty profile is valid.
+  profile = FilePrefetcher::SerializeProfile(kPageSize, kModifiedTime,
+                                             kPageSize, {});
+  EXPECT_TRUE(FilePrefetcher::ParseProfile(profile, kPageSize, kModifiedTime,
+                                           kPageSize, &parsed));
+  EXPECT_TRUE(parsed.empty());
+}
+
+TEST_F(FilePrefetcherTest, RejectsMismatchedProfile) {
+  std::vector<PageRange> ranges = {{0, 4}};
+  std::string profile = FilePrefetcher::SerializeProfile(
+      8 * kPageSize, kModifiedTime, kPageSize, ranges);
+  std::vector<PageRange> parsed;
+
+  // The file has been modified since the profile was recorded.
+  EXPECT_FALSE(FilePrefetcher::ParseProfile(profile, 9 * kPageSize,
+                                            kModifiedTime, kPageSize, &parsed));
+  EXPECT_FALSE(FilePrefetcher::ParseProfile(
+      profile, 8 * kPageSize, kModifiedTime + 1, kPageSize, &parsed));
+  EXPECT_FALSE(FilePrefetcher::ParseProfile(
+      profile, 8 * kPageSize, kModifiedTime, 2 * kPageSize, &parsed));
+
+  // Out of range pages.
+  profile = FilePrefetcher::SerializeProfile(2 * kPageSize, kModifiedTime,
+                                             kPageSize, {{1, 2}});
+  EXPECT_FALSE(FilePrefetcher::ParseProfile(profile, 2 * kPageSize,
+                                            kModifiedTime, kPageSize, &parsed));
+
+  EXPECT_FALSE(FilePrefetcher::ParseProfile("garbage", 2 * kPageSize,
+                                            kModifiedTime, kPageSize, &parsed));
+  EXPECT_FALSE(FilePrefetcher::ParseProfile(
+      "flutter-tizen-page-profile 2\n4096 8192 0\n0 x\n", 2 * kPageSize, 0,
+      kPageSize, &parsed));
+  // A profile of an older version.
+  EXPECT_FALSE(FilePrefetcher::ParseProfile(
+      "flutter-tizen-page-profile 1\n4096 8192\n0 1\n", 2 * kPageSize, 0,
+      kPageSize, &parsed));
+}
+
+TEST_F(FilePrefetcherTest, InvalidFile) {
+  FilePrefetcher prefetcher("/nonexistent/libapp.so");
+  EXPECT_FALSE(prefetcher.IsValid());
+  EXPECT_EQ(prefetcher.PrefetchAll(), 0u);
+  EXPECT_TRUE(prefetcher.GetResidentPages().empty());
+}
+
+TEST_F(FilePrefetcherTest, PrefetchAndRecordProfile) {
+  size_t size = 16 * kPageSize + 100;
+  std::string path = CreateTestFile("file_prefetcher_test.so", size);
+  std::string profile_path = GetTestPath("file_prefetcher_test.so.profile");
+
+  FilePrefetcher prefetcher(path);
+  ASSERT_TRUE(prefetcher.IsValid());
+  EXPECT_EQ(prefetcher.file_size(), size);
+  EXPECT_EQ(prefetcher.PrefetchAll(), size);
+  EXPECT_EQ(prefetcher.Prefetch({{2, 2}, {16, 5}}), 2 * kPageSize + 100);
+
+  // The file has just been written and prefetched, so all of it is resident.
+  std::vector<PageRange> resident = prefetcher.GetResidentPages();
+  ASSERT_FALSE(resident.empty());
+  ASSERT_TRUE(prefetcher.SaveProfile(profile_path, resident));
+
+  std::vector<PageRange> loaded;
+  ASSERT_TRUE(prefetcher.LoadProfile(profile_path, &loaded));
+  EXPECT_EQ(loaded, resident);
+
+  std::string other_path =
+      CreateTestFile("file_prefetcher_other.so", kPageSize);
+  FilePrefetcher other(other_path);
+  EXPECT_FALSE(other.LoadProfile(profile_path, &loaded));
+  EXPECT_FALSE(other.LoadProfile(profile_path + ".missing", &loaded));
+
+  // The file is replaced with one of the same size.
+  std::filesystem::last_write_time(
+      path, std::filesystem::last_write_time(path) + std::chrono::seconds(1));
+  FilePrefetcher replaced(path);
+  EXPECT_NE(replaced.modified_time(), prefetcher.modified_time());
+  EXPECT_FALSE(replaced.LoadProfile(profile_path, &loaded));
+
+}
+
+// Compares the time to fault in a file from a cold page cache with and without
+// prefetching. Run with --gtest_also_run_disabled_tests on a target device.
+TEST_F(FilePrefetcherTest, DISABLED_ColdCacheBenchmark) {
+  constexpr size_t kFileSize = 64 * 1024 * 1024;
+  constexpr int kIterations = 5;
+  std::string path = CreateTestFile("file_prefetcher_benchmark.so", kFileSize);
+
+  int64_t cold_total = 0;
+  int64_t prefetched_total = 0;
+  for (int i = 0; i < kIterations; i++) {
+    EvictFromPageCache(path);
+    cold_total += TouchAllPages(path);
+
+    EvictFromPageCache(path);
+    FilePrefetcher(path).PrefetchAll();
+    prefetched_total += TouchAllPages(path);
+  }
+
+  std::cout << "Cold: " << cold_total / kIterations << " us, prefetched: "
+            << prefetched_total / kIterations << " us" << std::endl;
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -6,7 +6,10 @@
 
 #include <app_common.h>
 
+#include <iterator>
+
 #include "flutter/shell/platform/common/accessibility_bridge.h"
+#include "flutter/shell/platform/tizen/accessibility_bridge_tizen.h"
 #include "flutter/shell/platform/tizen/logger.h"
 #include "flutter/third_party/accessibility/ax/platform/ax_platform_node_auralinux.h"
 
@@ -76,6 +79,9 @@ void FlutterPlatformNodeDelegateTizen::NotifyAccessibilityEvent(
     case ui::AXEventGenerator::Event::LOAD_COMPLETE:
       paltform_node->NotifyAccessibilityEvent(ax::mojom::Event::kLoadComplete);
       break;
+    case ui::AXEventGenerator::Event::LOCATION_CHANGED:
+      paltform_node->OnLocationChanged();
+      break;
     case ui::AXEventGenerator::Event::SELECTED_CHANGED:
       paltform_node->NotifyAccessibilityEvent(ax::mojom::Event::kSelection);
       break;
@@ -105,10 +111,14 @@ FlutterPlatformNodeDelegateTizen::GetNativeViewAccessible() {
 gfx::NativeViewAccessible FlutterPlatformNodeDelegateTizen::GetParent() {
   gfx::NativeViewAccessible parent = FlutterPlatformNodeDelegate::GetParent();
   if (!parent) {
-    parent = FlutterPlatformAppDelegateTizen::GetInstance()
-                 .GetWindow()
-                 .lock()
-                 ->GetNativeViewAccessible();
+    // The root node is the child of the window of its view.
+    auto bridge = std::static_pointer_cast<AccessibilityBridgeTizen>(
+        std::static_pointer_cast<AccessibilityBridge>(GetOwnerBridge().lock()));
+    std::shared_ptr<FlutterPlatformWindowDelegateTizen> window =
+        bridge ? bridge->GetWindow().lock() : nullptr;
+    if (window) {
+      parent = window->GetNativeViewAccessible();
+    }
   }
   return parent;
 }
@@ -136,28 +146,24 @@ bool FlutterPlatformNodeDelegateTizen::HitTestPoint(
 gfx::NativeViewAccessible FlutterPlatformNodeDelegateTizen::HitTestSync(
     int screen_physical_pixel_x,
     int screen_physical_pixel_y) const {
-  gfx::NativeViewAccessible result = nullptr;
-  gfx::Point point(screen_physical_pixel_x, screen_physical_pixel_y);
-  ui::AXNode* ax_node = GetAXNode();
-  auto bridge =
-      std::static_pointer_cast<AccessibilityBridge>(GetOwnerBridge().lock());
-  for (auto iter = ax_node->UnignoredChildrenBegin();
-       iter != ax_node->UnignoredChildrenEnd(); ++iter) {
-    auto child = std::static_pointer_cast<FlutterPlatformNodeDelegateTizen>(
-        bridge->GetFlutterPlatformNodeDelegateFromID(iter.get()->id()).lock());
-    if (child->HitTestPoint(point)) {
-      result = child->GetNativeViewAccessible();
-      break;
-    }
+  // Platform node delegates of this type are only created by
+  // AccessibilityBridgeTizen.
+  auto bridge = std::static_pointer_cast<AccessibilityBridgeTizen>(
+      std::static_pointer_cast<AccessibilityBridge>(GetOwnerBridge().lock()));
+  if (!bridge) {
+    return nullptr;
   }
-
-  if (!result) {
-    if (HitTestPoint(point) && platform_node_) {
-      result = platform_node_->GetNativeViewAccessible();
-    }
+  ui::AXNode::AXID id = bridge->HitTest(
+      GetAXNode()->id(),
+      gfx::Point(screen_physical_pixel_x, screen_physical_pixel_y));
+  if (id == ui::AXNode::kInvalidAXID) {
+    return nullptr;
   }
-
-  return result;
+  auto node = bridge->GetFlutterPlatformNodeDelegateFromID(id).lock();
+  if (!node) {
+    return nullptr;
+  }
+  return node->GetNativeViewAccessible();
 }
 
 FlutterPlatformWindowDelegateTizen::FlutterPlatformWindowDelegateTizen() {
@@ -190,6 +196,26 @@ void FlutterPlatformWindowDelegateTizen::SetRootNode(
   activated_ = true;
 }
 
+void FlutterPlatformWindowDelegateTizen::ClearRootNode() {
+  std::shared_ptr<FlutterPlatformNodeDelegate> root = root_.lock();
+  if (root) {
+    // The parent of the root node is this window, so this emits
+    // children-changed::remove on the window while it still has the child.
+    auto* platform_node = static_cast<ui::AXPlatformNodeAuraLinux*>(
+        ui::AXPlatformNode::FromNativeViewAccessible(
+            root->GetNativeViewAccessible()));
+    if (platform_node) {
+      platform_node->OnSubtreeWillBeDeleted();
+    }
+  }
+  root_.reset();
+}
+
+void FlutterPlatformWindowDelegateTizen::SetQueryCallback(
+    std::function<void()> callback) {
+  query_callback_ = std::move(callback);
+}
+
 const ui::AXNodeData& FlutterPlatformWindowDelegateTizen::GetData() const {
   return data_;
 }
@@ -205,6 +231,7 @@ gfx::NativeViewAccessible FlutterPlatformWindowDelegateTizen::GetParent() {
 }
 
 int FlutterPlatformWindowDelegateTizen::GetChildCount() const {
+  NotifyQuery();
   if (root_.expired()) {
     return 0;
   } else {
@@ -232,6 +259,7 @@ gfx::Rect FlutterPlatformWindowDelegateTizen::GetBoundsRect(
 gfx::NativeViewAccessible FlutterPlatformWindowDelegateTizen::HitTestSync(
     int screen_physical_pixel_x,
     int screen_physical_pixel_y) const {
+  NotifyQuery();
   gfx::Point point(screen_physical_pixel_x, screen_physical_pixel_y);
   if (!root_.expired()) {
     auto node = std::static_pointer_cast<FlutterPlatformNodeDelegateTizen>(
@@ -252,6 +280,12 @@ gfx::NativeViewAccessible FlutterPlatformWindowDelegateTizen::HitTestSync(
   }
 }
 
+void FlutterPlatformWindowDelegateTizen::NotifyQuery() const {
+  if (query_callback_) {
+    query_callback_();
+  }
+}
+
 FlutterPlatformAppDelegateTizen::FlutterPlatformAppDelegateTizen() {
   ui::AXPlatformNodeAuraLinux::EnableAXMode();
   data_.role = ax::mojom::Role::kApplication;
@@ -288,9 +322,28 @@ FlutterPlatformAppDelegateTizen::GetWindow() {
   return window_;
 }
 
+std::weak_ptr<FlutterPlatformWindowDelegateTizen>
+FlutterPlatformAppDelegateTizen::GetViewWindow(FlutterViewId view_id) {
+  if (!window_) {
+    // Accessibility is disabled.
+    return {};
+  }
+  std::shared_ptr<FlutterPlatformWindowDelegateTizen>& window =
+      view_windows_[view_id];
+  if (!window) {
+    window = std::make_shared<FlutterPlatformWindowDelegateTizen>();
+  }
+  return window;
+}
+
+void FlutterPlatformAppDelegateTizen::RemoveViewWindow(FlutterViewId view_id) {
+  view_windows_.erase(view_id);
+}
+
 void FlutterPlatformAppDelegateTizen::SetAccessibilityStatus(bool enabled) {
   if (!enabled && window_) {
     window_.reset();
+    view_windows_.clear();
   } else if (enabled && !window_) {
     window_ = std::make_shared<FlutterPlatformWindowDelegateTizen>();
   }
@@ -311,7 +364,7 @@ FlutterPlatformAppDelegateTizen::GetNativeViewAccessible() {
 
 int FlutterPlatformAppDelegateTizen::GetChildCount() const {
   if (window_) {
-    return 1;
+    return 1 + static_cast<int>(view_windows_.size());
   } else {
     return 0;
   }
@@ -323,7 +376,12 @@ gfx::NativeViewAccessible FlutterPlatformAppDelegateTizen::ChildAtIndex(
     return nullptr;
   }
 
-  return window_->GetNativeViewAccessible();
+  if (index == 0) {
+    return window_->GetNativeViewAccessible();
+  }
+  auto iter = view_windows_.begin();
+  std::advance(iter, index - 1);
+  return iter->second->GetNativeViewAccessible();
 }
 
 }  // namespace flutter
@@ -5,6 +5,9 @@
 #ifndef EMBEDDER_FLUTTER_PLATFORM_NODE_DELEGATE_TIZEN_H_
 #define EMBEDDER_FLUTTER_PLATFORM_NODE_DELEGATE_TIZEN_H_
 
+#include <functional>
+#include <map>
+
 #include "flutter/shell/platform/common/flutter_platform_node_delegate.h"
 
 namespace flutter {
@@ -52,6 +55,14 @@ class FlutterPlatformWindowDelegateTizen
   void SetGeometry(int32_t x, int32_t y, int32_t width, int32_t height);
   void SetRootNode(std::weak_ptr<FlutterPlatformNodeDelegate> node);
 
+  // Detaches the root node, notifying assistive clients that the window has
+  // lost its child. Must be called before the root node is destroyed.
+  void ClearRootNode();
+
+  // Sets a callback to be called whenever an assistive client queries the
+  // children of the window or hit tests it, before the query is answered.
+  void SetQueryCallback(std::function<void()> callback);
+
   // |ui::AXPlatformNodeDelegateBase|
   const ui::AXNodeData& GetData() const override;
 
@@ -79,9 +90,12 @@ class FlutterPlatformWindowDelegateTizen
       int screen_physical_pixel_y) const override;
 
  private:
+  void NotifyQuery() const;
+
   gfx::Rect geometry_;
   bool activated_;
   std::weak_ptr<FlutterPlatformNodeDelegate> root_;
+  std::function<void()> query_callback_;
   ui::AXPlatformNode* platform_node_;
   ui::AXNodeData data_;
 };
@@ -97,7 +111,17 @@ class FlutterPlatformAppDelegateTizen : public ui::AXPlatformNodeDelegateBase {
 
   static FlutterPlatformAppDelegateTizen& GetInstance();
 
+  // The window of the implicit view.
   std::weak_ptr<FlutterPlatformWindowDelegateTizen> GetWindow();
+
+  // The window of the additional view |view_id|, which is created on first
+  // use while accessibility is enabled.
+  std::weak_ptr<FlutterPlatformWindowDelegateTizen> GetViewWindow(
+      FlutterViewId view_id);
+
+  // Destroys the window of the additional view |view_id|, if any.
+  void RemoveViewWindow(FlutterViewId view_id);
+
   void SetAccessibilityStatus(bool enabled);
 
   // |ui::AXPlatformNodeDelegateBase|
@@ -116,6 +140,10 @@ class FlutterPlatformAppDelegateTizen : public ui::AXPlatformNodeDelegateBase {
   FlutterPlatformAppDelegateTizen();
 
   std::shared_ptr<FlutterPlatformWindowDelegateTizen> window_;
+  // The windows of additional views, which follow |window_| among the
+  // children of the application.
+  std::map<FlutterViewId, std::shared_ptr<FlutterPlatformWindowDelegateTizen>>
+      view_windows_;
   ui::AXPlatformNode* platform_node_;
   ui::AXNodeData data_;
 };
@@ -7,6 +7,7 @@
 #define EMBEDDER_FLUTTER_PROJECT_BUNDLE_H_
 
 #include <filesystem>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -18,6 +19,9 @@ namespace flutter {
 using UniqueAotDataPtr =
     std::unique_ptr<_FlutterEngineAOTData, FlutterEngineCollectAOTDataFnPtr>;
 
+// AOT data shared by multiple engine instances.
+using SharedAotDataPtr = std::shared_ptr<_FlutterEngineAOTData>;
+
 // The data associated with a Flutter project needed to run it in an engine.
 class FlutterProjectBundle {
  public:
@@ -39,6 +43,9 @@ class FlutterProjectBundle {
   // Returns the path to the ICU data file.
   const std::filesystem::path& icu_path() { return icu_path_; }
 
+  // Returns the path to the AOT library file, if any.
+  const std::filesystem::path& aot_library_path() { return aot_library_path_; }
+
   // Returns the arguments to be passed to the engine.
   const std::vector<std::string> engine_arguments() {
     return engine_arguments_;
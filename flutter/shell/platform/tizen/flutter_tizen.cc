@@ -11,9 +11,11 @@
 #include "flutter/shell/platform/embedder/embedder.h"
 #include "flutter/shell/platform/tizen/flutter_project_bundle.h"
 #include "flutter/shell/platform/tizen/flutter_tizen_engine.h"
+#include "flutter/shell/platform/tizen/flutter_tizen_engine_pool.h"
 #include "flutter/shell/platform/tizen/flutter_tizen_view.h"
 #include "flutter/shell/platform/tizen/logger.h"
 #include "flutter/shell/platform/tizen/public/flutter_platform_view.h"
+#include "flutter/shell/platform/tizen/thread_policy.h"
 #include "flutter/shell/platform/tizen/tizen_view.h"
 #ifdef NUI_SUPPORT
 #include "flutter/shell/platform/tizen/tizen_renderer_egl.h"
@@ -35,6 +37,18 @@ FlutterDesktopEngineRef HandleForEngine(flutter::FlutterTizenEngine* engine) {
   return reinterpret_cast<FlutterDesktopEngineRef>(engine);
 }
 
+// Returns the engine pool corresponding to the given opaque API handle.
+flutter::FlutterTizenEnginePool* EnginePoolFromHandle(
+    FlutterDesktopEnginePoolRef ref) {
+  return reinterpret_cast<flutter::FlutterTizenEnginePool*>(ref);
+}
+
+// Returns the opaque API handle for the given engine pool instance.
+FlutterDesktopEnginePoolRef HandleForEnginePool(
+    flutter::FlutterTizenEnginePool* pool) {
+  return reinterpret_cast<FlutterDesktopEnginePoolRef>(pool);
+}
+
 // Returns the view corresponding to the given opaque API handle.
 flutter::FlutterTizenView* ViewFromHandle(FlutterDesktopViewRef view) {
   return reinterpret_cast<flutter::FlutterTizenView*>(view);
@@ -56,11 +70,8 @@ FlutterDesktopViewRef HandleForView(flutter::FlutterTizenView* view) {
   return reinterpret_cast<FlutterDesktopViewRef>(view);
 }
 
-}  // namespace
-
-FlutterDesktopEngineRef FlutterDesktopEngineCreate(
-    const FlutterDesktopEngineProperties& engine_properties) {
-  flutter::FlutterProjectBundle project(engine_properties);
+// Configures and starts the logger using the engine switches of |project|.
+void StartLogger(flutter::FlutterProjectBundle& project) {
   if (project.HasArgument("--verbose-logging")) {
     flutter::Logger::SetLoggingLevel(flutter::kLogLevelDebug);
   }
@@ -69,12 +80,54 @@ FlutterDesktopEngineRef FlutterDesktopEngineCreate(
     flutter::Logger::SetLoggingPort(std::stoi(logging_port));
   }
   flutter::Logger::Start();
+}
+
+constexpr struct {
+  const char* name;
+  FlutterThreadPriority priority;
+} kThreadPolicySwitches[] = {
+    {"--tizen-thread-policy-background", kBackground},
+    {"--tizen-thread-policy-normal", kNormal},
+    {"--tizen-thread-policy-display", kDisplay},
+    {"--tizen-thread-policy-raster", kRaster},
+};
+
+// Sets the thread policies given by the engine switches of |project|, such as
+// "--tizen-thread-policy-raster sched=fifo,priority=10,affinity=0xf0".
+void ConfigureThreadPolicies(flutter::FlutterProjectBundle& project) {
+  for (const auto& thread_policy_switch : kThreadPolicySwitches) {
+    std::string spec;
+    if (!project.GetArgumentValue(thread_policy_switch.name, &spec)) {
+      continue;
+    }
+    flutter::ThreadPolicy policy;
+    if (!flutter::ParseThreadPolicy(spec, &policy)) {
+      FT_LOG(Error) << "Invalid thread policy for "
+                    << thread_policy_switch.name << ": " << spec;
+      continue;
+    }
+    flutter::SetThreadPolicy(thread_policy_switch.priority, policy);
+  }
+}
+
+}  // namespace
+
+FlutterDesktopEngineRef FlutterDesktopEngineCreate(
+    const FlutterDesktopEngineProperties& engine_properties) {
+  flutter::FlutterProjectBundle project(engine_properties);
+  ConfigureThreadPolicies(project);
+  StartLogger(project);
 
   auto engine = std::make_unique<flutter::FlutterTizenEngine>(project);
   return HandleForEngine(engine.release());
 }
 
 bool FlutterDesktopEngineRun(const FlutterDesktopEngineRef engine) {
+  // Logging is stopped by the shutdown of any engine, such as a previous
+  // engine of the same engine pool.
+  if (!flutter::Logger::IsRunning()) {
+    flutter::Logger::Start();
+  }
   return EngineFromHandle(engine)->RunEngine();
 }
 
@@ -86,6 +139,26 @@ void FlutterDesktopEngineShutdown(FlutterDesktopEngineRef engine_ref) {
   delete engine;
 }
 
+FlutterDesktopEnginePoolRef FlutterDesktopEnginePoolCreate(
+    const FlutterDesktopEngineProperties& engine_properties,
+    size_t size) {
+  flutter::FlutterProjectBundle project(engine_properties);
+  ConfigureThreadPolicies(project);
+  StartLogger(project);
+
+  auto pool = std::make_unique<flutter::FlutterTizenEnginePool>(project, size);
+  return HandleForEnginePool(pool.release());
+}
+
+FlutterDesktopEngineRef FlutterDesktopEnginePoolAcquire(
+    FlutterDesktopEnginePoolRef pool) {
+  return HandleForEngine(EnginePoolFromHandle(pool)->Acquire().release());
+}
+
+void FlutterDesktopEnginePoolDestroy(FlutterDesktopEnginePoolRef pool) {
+  delete EnginePoolFromHandle(pool);
+}
+
 FlutterDesktopViewRef FlutterDesktopPluginRegistrarGetView(
     FlutterDesktopPluginRegistrarRef registrar) {
   return HandleForView(registrar->engine->view());
@@ -172,6 +245,90 @@ void FlutterDesktopEngineNotifyLowMemoryWarning(
   EngineFromHandle(engine)->NotifyLowMemoryWarning();
 }
 
+size_t FlutterDesktopEngineNotifyMemoryPressure(
+    FlutterDesktopEngineRef engine,
+    FlutterDesktopMemoryPressureLevel level) {
+  flutter::MemoryPressureLevel pressure_level;
+  switch (level) {
+    case kFlutterDesktopMemoryPressureModerate:
+      pressure_level = flutter::MemoryPressureLevel::kModerate;
+      break;
+    case kFlutterDesktopMemoryPressureCritical:
+      pressure_level = flutter::MemoryPressureLevel::kCritical;
+      break;
+    default:
+      pressure_level = flutter::MemoryPressureLevel::kNormal;
+      break;
+  }
+  return EngineFromHandle(engine)->NotifyMemoryPressure(pressure_level);
+}
+
+size_t FlutterDesktopEngineGetReleasedMemoryBytes(
+    FlutterDesktopEngineRef engine) {
+  flutter::MemoryPressureMonitor* monitor =
+      EngineFromHandle(engine)->memory_pressure_monitor();
+  return monitor ? monitor->released_bytes() : 0;
+}
+
+void FlutterDesktopEngineSetFrameStatisticsEnabled(
+    FlutterDesktopEngineRef engine,
+    bool enabled) {
+  EngineFromHandle(engine)->frame_statistics()->SetEnabled(enabled);
+}
+
+bool FlutterDesktopEngineGetFrameStatistics(
+    FlutterDesktopEngineRef engine,
+    FlutterDesktopFrameStatistics* statistics) {
+  if (!statistics) {
+    return false;
+  }
+  *statistics = EngineFromHandle(engine)->frame_statistics()->GetStatistics();
+  return true;
+}
+
+size_t FlutterDesktopEngineGetFrameTimings(FlutterDesktopEngineRef engine,
+                                           FlutterDesktopFrameTiming* timings,
+                                           size_t max_count) {
+  if (!timings) {
+    return 0;
+  }
+  return EngineFromHandle(engine)->frame_statistics()->GetFrameTimings(
+      timings, max_count);
+}
+
+void FlutterDesktopEngineResetFrameStatistics(FlutterDesktopEngineRef engine) {
+  EngineFromHandle(engine)->frame_statistics()->Reset();
+}
+
+void FlutterDesktopEngineSetOffscreenSize(FlutterDesktopEngineRef engine,
+                                          int32_t width,
+                                          int32_t height,
+                                          double pixel_ratio) {
+  flutter::FlutterTizenEngine* tizen_engine = EngineFromHandle(engine);
+  if (tizen_engine->view()) {
+    FT_LOG(Error) << "The engine is not running in headless mode.";
+    return;
+  }
+  if (tizen_engine->offscreen_surface()) {
+    tizen_engine->offscreen_surface()->SetSize(width, height);
+  }
+  tizen_engine->SendWindowMetrics(flutter::kImplicitViewId, 0, 0, width,
+                                  height, pixel_ratio);
+}
+
+bool FlutterDesktopEngineCopyOffscreenFrame(FlutterDesktopEngineRef engine,
+                                            uint8_t* buffer,
+                                            size_t buffer_size,
+                                            size_t* width,
+                                            size_t* height) {
+  flutter::OffscreenSurface* surface =
+      EngineFromHandle(engine)->offscreen_surface();
+  if (!surface) {
+    return false;
+  }
+  return surface->CopyFrame(buffer, buffer_size, width, height);
+}
+
 void FlutterDesktopEngineNotifyAppIsInactive(FlutterDesktopEngineRef engine) {
   EngineFromHandle(engine)->lifecycle_channel()->AppIsInactive();
 }
@@ -201,7 +358,8 @@ FlutterDesktopViewRef FlutterDesktopViewCreateFromNewWindow(
       window_properties.height};
 
   std::unique_ptr<flutter::TizenWindow> window;
-  if (window_properties.renderer_type == FlutterDesktopRendererType::kEvasGL) {
+  if (window_properties.renderer_type == FlutterDesktopRendererType::kEvasGL ||
+      window_properties.renderer_type == FlutterDesktopRendererType::kCPU) {
     window = std::make_unique<flutter::TizenWindowElementary>(
         window_geometry, window_properties.transparent,
         window_properties.focusable, window_properties.top_level);
@@ -230,6 +388,54 @@ FlutterDesktopViewRef FlutterDesktopViewCreateFromNewWindow(
   return HandleForView(view.release());
 }
 
+FlutterDesktopViewRef FlutterDesktopViewCreateAdditionalFromNewWindow(
+    const FlutterDesktopWindowProperties& window_properties,
+    FlutterDesktopEngineRef engine,
+    FlutterDesktopViewAddedCallback callback,
+    void* user_data) {
+  flutter::FlutterTizenEngine* tizen_engine = EngineFromHandle(engine);
+  flutter::TizenGeometry window_geometry = {
+      window_properties.x, window_properties.y, window_properties.width,
+      window_properties.height};
+
+  std::unique_ptr<flutter::TizenWindow> window;
+  if (window_properties.renderer_type == FlutterDesktopRendererType::kCPU) {
+    window = std::make_unique<flutter::TizenWindowElementary>(
+        window_geometry, window_properties.transparent,
+        window_properties.focusable, window_properties.top_level);
+  } else if (window_properties.renderer_type ==
+             FlutterDesktopRendererType::kEGL) {
+    window = std::make_unique<flutter::TizenWindowEcoreWl2>(
+        window_geometry, window_properties.transparent,
+        window_properties.focusable, window_properties.top_level,
+        window_properties.pointing_device_support,
+        window_properties.floating_menu_support,
+        window_properties.window_handle);
+  } else {
+    FT_LOG(Error) << "Additional views are only supported by the software and "
+                     "EGL renderers.";
+    return nullptr;
+  }
+
+  auto view = std::make_unique<flutter::FlutterTizenView>(
+      tizen_engine->AllocateViewId(), std::move(window), tizen_engine,
+      window_properties.user_pixel_ratio);
+  FlutterDesktopViewRef view_ref = HandleForView(view.get());
+  if (!tizen_engine->AddView(view.get(), window_properties.renderer_type,
+                             [view_ref, callback, user_data](bool added) {
+                               if (callback) {
+                                 callback(view_ref, added, user_data);
+                               }
+                             })) {
+    return nullptr;
+  }
+  return HandleForView(view.release());
+}
+
+int64_t FlutterDesktopViewGetId(FlutterDesktopViewRef view) {
+  return ViewFromHandle(view)->view_id();
+}
+
 void* FlutterDesktopViewGetNativeHandle(FlutterDesktopViewRef view_ref) {
   flutter::FlutterTizenView* view = ViewFromHandle(view_ref);
   return view->tizen_view()->GetNativeHandle();
@@ -298,7 +504,10 @@ void FlutterDesktopViewOnKeyEvent(FlutterDesktopViewRef view,
 void FlutterDesktopViewSetFocus(FlutterDesktopViewRef view, bool focused) {
   if (auto* tizen_view = dynamic_cast<flutter::TizenView*>(
           ViewFromHandle(view)->tizen_view())) {
-    tizen_view->SetFocus(focused);
+    if (tizen_view->focused() != focused) {
+      tizen_view->SetFocus(focused);
+      ViewFromHandle(view)->OnFocusChange(focused);
+    }
   }
 }
 
@@ -346,6 +555,14 @@ bool FlutterDesktopTextureRegistrarMarkExternalTextureFrameAvailable(
       ->MarkTextureFrameAvailable(texture_id);
 }
 
+bool FlutterDesktopTextureRegistrarGetFrameStatistics(
+    FlutterDesktopTextureRegistrarRef texture_registrar,
+    int64_t texture_id,
+    FlutterDesktopTextureFrameStatistics* statistics) {
+  return TextureRegistrarFromHandle(texture_registrar)
+      ->GetFrameStatistics(texture_id, statistics);
+}
+
 FlutterDesktopMessengerRef FlutterDesktopMessengerAddRef(
     FlutterDesktopMessengerRef messenger) {
   return messenger;
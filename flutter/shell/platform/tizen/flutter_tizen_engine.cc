@@ -5,19 +5,29 @@
 
 #include "flutter_tizen_engine.h"
 
+#include <app_common.h>
+
 #include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <future>
 #include <string>
 #include <vector>
 
 #include "flutter/shell/platform/tizen/accessibility_bridge_tizen.h"
+#include "flutter/shell/platform/tizen/file_prefetcher.h"
 #include "flutter/shell/platform/tizen/flutter_platform_node_delegate_tizen.h"
 #include "flutter/shell/platform/tizen/flutter_tizen_display_monitor.h"
 #include "flutter/shell/platform/tizen/flutter_tizen_view.h"
 #include "flutter/shell/platform/tizen/logger.h"
 #include "flutter/shell/platform/tizen/system_utils.h"
+#include "flutter/shell/platform/tizen/thread_policy.h"
 #include "flutter/shell/platform/tizen/tizen_input_method_context.h"
 #include "flutter/shell/platform/tizen/tizen_renderer_egl.h"
 #include "flutter/shell/platform/tizen/tizen_renderer_evas_gl.h"
+#include "flutter/shell/platform/tizen/tizen_renderer_gl.h"
+#include "flutter/shell/platform/tizen/tizen_renderer_software.h"
+#include "flutter/shell/platform/tizen/tracer.h"
 
 #ifdef NUI_SUPPORT
 #include "flutter/shell/platform/tizen/tizen_renderer_nui_gl.h"
@@ -32,6 +42,75 @@ namespace {
 constexpr size_t kPlatformTaskRunnerIdentifier = 1;
 constexpr size_t kRenderTaskRunnerIdentifier = 2;
 
+// The names of the page profiles in the app data directory.
+constexpr char kAotPageProfileName[] = "flutter_aot_page_profile";
+constexpr char kIcuPageProfileName[] = "flutter_icu_page_profile";
+
+// The time without queries from assistive clients after which the
+// accessibility tree is released in lazy accessibility mode.
+constexpr uint64_t kAccessibilityIdleTimeoutNanos = 60'000'000'000;
+
+// Updates |focused_node_id| with the focus changes in |update|, or sets it to
+// -1 if the focused node has lost focus. Returns whether another node has
+// gained focus, which a screen reader announces without querying the tree.
+bool UpdateFocusedNode(const FlutterSemanticsUpdate2& update,
+                       int32_t* focused_node_id) {
+  bool focus_moved = false;
+  for (size_t i = 0; i < update.node_count; i++) {
+    const FlutterSemanticsNode2* node = update.nodes[i];
+    bool focused =
+        node->flags2 && node->flags2->is_focused == kFlutterTristateTrue;
+    if (focused && node->id != *focused_node_id) {
+      *focused_node_id = node->id;
+      focus_moved = true;
+    } else if (!focused && node->id == *focused_node_id) {
+      *focused_node_id = -1;
+    }
+  }
+  return focus_moved;
+}
+
+// Returns the path of the page profile |name| in the app data directory, or an
+// empty string if the directory is unavailable.
+std::string GetPageProfilePath(const char* name) {
+  char* data_path = app_get_data_path();
+  if (!data_path) {
+    return std::string();
+  }
+  std::string path = (std::filesystem::path(data_path) / name).string();
+  free(data_path);
+  return path;
+}
+
+// Prefetches the pages of |path| listed in the profile at |profile_path|.
+//
+// Returns false if there is no valid profile for the file.
+bool PrefetchFile(const std::filesystem::path& path,
+                  const std::string& profile_path) {
+  FilePrefetcher prefetcher(path.string());
+  std::vector<FilePrefetcher::PageRange> ranges;
+  if (!prefetcher.IsValid() || profile_path.empty() ||
+      !prefetcher.LoadProfile(profile_path, &ranges)) {
+    return false;
+  }
+  size_t bytes = prefetcher.Prefetch(ranges);
+  FT_LOG(Debug) << "Prefetched " << bytes << " of " << prefetcher.file_size()
+                << " bytes of " << path.filename().string();
+  return true;
+}
+
+// Records the pages of |path| that are currently in the page cache.
+void RecordPageProfile(const std::filesystem::path& path,
+                       const std::string& profile_path) {
+  FilePrefetcher prefetcher(path.string());
+  if (!prefetcher.IsValid() || profile_path.empty()) {
+    return;
+  }
+  if (!prefetcher.SaveProfile(profile_path, prefetcher.GetResidentPages())) {
+    FT_LOG(Error) << "Failed to write the page profile to " << profile_path;
+  }
+}
+
 // Converts a LanguageInfo struct to a FlutterLocale struct. |info| must outlive
 // the returned value, since the returned FlutterLocale has pointers into it.
 FlutterLocale CovertToFlutterLocale(const LanguageInfo& info) {
@@ -50,13 +129,20 @@ FlutterLocale CovertToFlutterLocale(const LanguageInfo& info) {
   return locale;
 }
 
+// The state of an AddView or RemoveView call passed to the engine.
+struct ViewRequest {
+  FlutterTizenEngine* engine;
+  FlutterViewId view_id;
+  FlutterTizenEngine::ViewCallback callback;
+};
+
 }  // namespace
 
 FlutterTizenEngine::FlutterTizenEngine(const FlutterProjectBundle& project)
-    : project_(std::make_unique<FlutterProjectBundle>(project)),
-      aot_data_(nullptr, nullptr) {
+    : project_(std::make_unique<FlutterProjectBundle>(project)) {
   embedder_api_.struct_size = sizeof(FlutterEngineProcTable);
   FlutterEngineGetProcAddresses(&embedder_api_);
+  Tracer::Start(embedder_api_);
 
   // Run flutter task on Tizen main loop.
   // Tizen engine has four threads (GPU thread, UI thread, IO thread, platform
@@ -78,6 +164,14 @@ FlutterTizenEngine::FlutterTizenEngine(const FlutterProjectBundle& project)
   plugin_registrar_->engine = this;
 
   display_monitor_ = std::make_unique<FlutterTizenDisplayMonitor>(this);
+
+  frame_statistics_ =
+      std::make_unique<FrameStatistics>(embedder_api_.GetCurrentTime);
+
+  lazy_accessibility_ = project_->HasArgument("--tizen-lazy-accessibility");
+  multi_view_ = project_->HasArgument("--tizen-multi-view");
+  accessibility_location_events_ =
+      project_->HasArgument("--tizen-accessibility-location-events");
 }
 
 FlutterTizenEngine::~FlutterTizenEngine() {
@@ -85,25 +179,27 @@ FlutterTizenEngine::~FlutterTizenEngine() {
 }
 
 std::unique_ptr<TizenRenderer> FlutterTizenEngine::CreateRenderer(
+    TizenViewBase* tizen_view,
     FlutterDesktopRendererType renderer_type) {
   switch (renderer_type) {
     case FlutterDesktopRendererType::kEvasGL:
-      return std::make_unique<TizenRendererEvasGL>(view_->tizen_view());
+      return std::make_unique<TizenRendererEvasGL>(tizen_view);
     case FlutterDesktopRendererType::kEGL:
 #ifdef NUI_SUPPORT
-      if (auto* nui_view =
-              dynamic_cast<flutter::TizenViewNui*>(view_->tizen_view())) {
+      if (auto* nui_view = dynamic_cast<flutter::TizenViewNui*>(tizen_view)) {
         return std::make_unique<TizenRendererNuiGL>(
             nui_view, project_->HasArgument("--enable-impeller"));
       }
 #endif
       return std::make_unique<TizenRendererEgl>(
-          view_->tizen_view(), project_->HasArgument("--enable-impeller"));
+          tizen_view, project_->HasArgument("--enable-impeller"));
+    case FlutterDesktopRendererType::kCPU:
+      return std::make_unique<TizenRendererSoftware>(tizen_view);
   }
 }
 
 bool FlutterTizenEngine::RunEngine() {
-  if (engine_ != nullptr) {
+  if (running_) {
     FT_LOG(Error) << "The engine has already started.";
     return false;
   }
@@ -112,14 +208,86 @@ bool FlutterTizenEngine::RunEngine() {
     return false;
   }
 
+  uint64_t run_start = embedder_api_.GetCurrentTime();
+  {
+    FT_TRACE_SCOPE("FlutterTizenEngine::RunEngine::Run");
+    if (engine_) {
+      // The engine has been initialized in advance by PrewarmEngine.
+      FlutterEngineResult result = embedder_api_.RunInitialized(engine_);
+      if (result != kSuccess) {
+        FT_LOG(Error) << "Failed to run the prewarmed engine with error: "
+                      << result;
+        return false;
+      }
+    } else if (!StartEngine(false)) {
+      return false;
+    }
+  }
+  running_ = true;
+  uint64_t post_run_start = embedder_api_.GetCurrentTime();
+  startup_timings_.engine_run = post_run_start - run_start;
+
+  internal_plugin_registrar_ =
+      std::make_unique<PluginRegistrar>(plugin_registrar_.get());
+  accessibility_channel_ = std::make_unique<AccessibilityChannel>(
+      internal_plugin_registrar_->messenger());
+  app_control_channel_ = std::make_unique<AppControlChannel>(
+      internal_plugin_registrar_->messenger());
+  lifecycle_channel_ = std::make_unique<LifecycleChannel>(
+      internal_plugin_registrar_->messenger());
+  settings_channel_ = std::make_unique<SettingsChannel>(
+      internal_plugin_registrar_->messenger());
+
+  if (IsHeaded()) {
+    texture_registrar_ = std::make_unique<FlutterTizenTextureRegistrar>(this);
+    keyboard_channel_ = std::make_unique<KeyboardChannel>(
+        internal_plugin_registrar_->messenger(),
+        [this](const FlutterKeyEvent& event, FlutterKeyEventCallback callback,
+               void* user_data) { SendKeyEvent(event, callback, user_data); });
+    navigation_channel_ = std::make_unique<NavigationChannel>(
+        internal_plugin_registrar_->messenger());
+    frame_statistics_channel_ = std::make_unique<FrameStatisticsChannel>(
+        internal_plugin_registrar_->messenger(), frame_statistics_.get());
+  }
+
+  accessibility_settings_ = std::make_unique<AccessibilitySettings>(this);
+
+  CreateMemoryPressureMonitor();
+
+  display_monitor_->UpdateDisplays();
+
+  SetupLocales();
+
+  startup_timings_.post_run = embedder_api_.GetCurrentTime() - post_run_start;
+  FT_LOG(Info) << "Startup timings (us): aot_data_load="
+               << startup_timings_.aot_data_load / 1000
+               << ", aot_data_wait=" << startup_timings_.aot_data_wait / 1000
+               << ", renderer_creation="
+               << startup_timings_.renderer_creation / 1000
+               << ", engine_run=" << startup_timings_.engine_run / 1000
+               << ", post_run=" << startup_timings_.post_run / 1000;
+
+  return true;
+}
+
+bool FlutterTizenEngine::PrewarmEngine() {
+  if (engine_ != nullptr) {
+    FT_LOG(Error) << "The engine has already been initialized.";
+    return false;
+  }
+  FT_TRACE_SCOPE("FlutterTizenEngine::PrewarmEngine");
+  return StartEngine(true);
+}
+
+bool FlutterTizenEngine::StartEngine(bool initialize_only) {
   if (!project_->HasValidPaths()) {
     FT_LOG(Error) << "Missing or unresolvable paths to assets.";
     return false;
   }
   std::string assets_path_string = project_->assets_path().u8string();
   std::string icu_path_string = project_->icu_path().u8string();
-  if (embedder_api_.RunsAOTCompiledDartCode()) {
-    aot_data_ = project_->LoadAotData(embedder_api_);
+  if (embedder_api_.RunsAOTCompiledDartCode() && !aot_data_) {
+    aot_data_ = TakeAotData();
     if (!aot_data_) {
       FT_LOG(Error) << "Unable to start engine without AOT data.";
       return false;
@@ -159,6 +327,7 @@ bool FlutterTizenEngine::RunEngine() {
   FlutterCustomTaskRunners custom_task_runners = {};
   custom_task_runners.struct_size = sizeof(FlutterCustomTaskRunners);
   custom_task_runners.platform_task_runner = &platform_task_runner;
+  custom_task_runners.thread_priority_setter = ApplyThreadPolicy;
 
   FlutterTaskRunnerDescription render_task_runner = {};
 
@@ -195,6 +364,7 @@ bool FlutterTizenEngine::RunEngine() {
                         << engine_message->struct_size;
           return;
         }
+        FT_TRACE_SCOPE("IncomingMessageDispatcher::HandleMessage");
         auto* engine = static_cast<FlutterTizenEngine*>(user_data);
         FlutterDesktopMessage message =
             engine->ConvertToDesktopMessage(*engine_message);
@@ -214,7 +384,12 @@ bool FlutterTizenEngine::RunEngine() {
     engine->OnUpdateSemantics(update);
   };
 
-  if (IsHeaded() && dynamic_cast<TizenRendererEgl*>(renderer_.get())) {
+  // A prewarmed engine is expected to be attached to a view using the EGL
+  // renderer later.
+  bool uses_egl_renderer =
+      IsHeaded() ? dynamic_cast<TizenRendererEgl*>(renderer_.get()) != nullptr
+                 : initialize_only;
+  if (uses_egl_renderer) {
     vsync_waiter_ = std::make_unique<TizenVsyncWaiter>(this);
     args.vsync_callback = [](void* user_data, intptr_t baton) -> void {
       auto* engine = static_cast<FlutterTizenEngine*>(user_data);
@@ -225,43 +400,70 @@ bool FlutterTizenEngine::RunEngine() {
     };
   }
 
-  FlutterRendererConfig renderer_config = GetRendererConfig();
+  FlutterRendererConfig renderer_config =
+      GetRendererConfig(IsHeaded() || initialize_only);
+  // GL renderers only present through a compositor if additional views are
+  // enabled, since it costs an extra draw per frame.
+  const FlutterCompositor* renderer_compositor =
+      renderer_ && (multi_view_ ||
+                    !dynamic_cast<TizenRendererGL*>(renderer_.get()))
+          ? renderer_->GetCompositor()
+          : nullptr;
+  if (renderer_compositor) {
+    // Route the frames of additional views to their own renderers.
+    compositor_ = *renderer_compositor;
+    compositor_.user_data = this;
+    compositor_.create_backing_store_callback =
+        [](const FlutterBackingStoreConfig* config,
+           FlutterBackingStore* backing_store_out, void* user_data) -> bool {
+      auto* engine = static_cast<FlutterTizenEngine*>(user_data);
+      const FlutterCompositor* compositor =
+          engine->renderer_->GetCompositor();
+      return compositor->create_backing_store_callback(
+          config, backing_store_out, compositor->user_data);
+    };
+    compositor_.collect_backing_store_callback =
+        [](const FlutterBackingStore* backing_store, void* user_data) -> bool {
+      auto* engine = static_cast<FlutterTizenEngine*>(user_data);
+      const FlutterCompositor* compositor =
+          engine->renderer_->GetCompositor();
+      return compositor->collect_backing_store_callback(backing_store,
+                                                        compositor->user_data);
+    };
+    compositor_.present_view_callback =
+        [](const FlutterPresentViewInfo* info) -> bool {
+      auto* engine = static_cast<FlutterTizenEngine*>(info->user_data);
+      std::lock_guard<std::mutex> lock(engine->views_mutex_);
+      TizenRenderer* renderer = engine->GetRendererLocked(info->view_id);
+      if (!renderer) {
+        // A frame still in flight for a view being removed.
+        return true;
+      }
+      // All layers have the size of the frame.
+      FlutterTizenView* view = engine->GetViewLocked(info->view_id);
+      if (info->layers_count > 0 &&
+          !view->ShouldPresentFrame(
+              static_cast<size_t>(info->layers[0]->size.width),
+              static_cast<size_t>(info->layers[0]->size.height))) {
+        // A frame rendered for the previous window size.
+        return true;
+      }
+      return renderer->PresentLayers(info->layers, info->layers_count);
+    };
+    args.compositor = &compositor_;
+  }
 
-  FlutterEngineResult result = embedder_api_.Run(
-      FLUTTER_ENGINE_VERSION, &renderer_config, &args, this, &engine_);
+  FlutterEngineResult result =
+      initialize_only
+          ? embedder_api_.Initialize(FLUTTER_ENGINE_VERSION, &renderer_config,
+                                     &args, this, &engine_)
+          : embedder_api_.Run(FLUTTER_ENGINE_VERSION, &renderer_config, &args,
+                              this, &engine_);
   if (result != kSuccess || engine_ == nullptr) {
     FT_LOG(Error) << "Failed to start the Flutter engine with error: "
                   << result;
     return false;
   }
-
-  internal_plugin_registrar_ =
-      std::make_unique<PluginRegistrar>(plugin_registrar_.get());
-  accessibility_channel_ = std::make_unique<AccessibilityChannel>(
-      internal_plugin_registrar_->messenger());
-  app_control_channel_ = std::make_unique<AppControlChannel>(
-      internal_plugin_registrar_->messenger());
-  lifecycle_channel_ = std::make_unique<LifecycleChannel>(
-      internal_plugin_registrar_->messenger());
-  settings_channel_ = std::make_unique<SettingsChannel>(
-      internal_plugin_registrar_->messenger());
-
-  if (IsHeaded()) {
-    texture_registrar_ = std::make_unique<FlutterTizenTextureRegistrar>(this);
-    keyboard_channel_ = std::make_unique<KeyboardChannel>(
-        internal_plugin_registrar_->messenger(),
-        [this](const FlutterKeyEvent& event, FlutterKeyEventCallback callback,
-               void* user_data) { SendKeyEvent(event, callback, user_data); });
-    navigation_channel_ = std::make_unique<NavigationChannel>(
-        internal_plugin_registrar_->messenger());
-  }
-
-  accessibility_settings_ = std::make_unique<AccessibilitySettings>(this);
-
-  display_monitor_->UpdateDisplays();
-
-  SetupLocales();
-
   return true;
 }
 
@@ -288,9 +490,33 @@ bool FlutterTizenEngine::StopEngine() {
       }
     }
 
+    RecordPageProfiles();
+
     FlutterEngineResult result = embedder_api_.Shutdown(engine_);
+    std::shared_ptr<FlutterPlatformWindowDelegateTizen> window =
+        FlutterPlatformAppDelegateTizen::GetInstance().GetWindow().lock();
+    if (window) {
+      window->SetQueryCallback(nullptr);
+    }
+    // Destroyed after shutdown since trimming textures on the render thread
+    // reports to the monitor.
+    memory_pressure_monitor_.reset();
+    // Additional views may outlive the engine, so they must not keep
+    // referring to it.
+    std::vector<FlutterViewId> view_ids;
+    {
+      std::lock_guard<std::mutex> lock(views_mutex_);
+      for (auto& [view_id, additional_view] : additional_views_) {
+        additional_view.view->DetachEngine();
+        view_ids.push_back(view_id);
+      }
+    }
+    for (FlutterViewId view_id : view_ids) {
+      DestroyView(view_id);
+    }
     view_ = nullptr;
     engine_ = nullptr;
+    running_ = false;
     return (result == kSuccess);
   }
   return false;
@@ -299,7 +525,32 @@ bool FlutterTizenEngine::StopEngine() {
 void FlutterTizenEngine::SetView(FlutterTizenView* view,
                                  FlutterDesktopRendererType renderer_type) {
   view_ = view;
-  renderer_ = CreateRenderer(renderer_type);
+
+  // The AOT data does not depend on the renderer, so load it in parallel.
+  // The renderer itself must be created on the platform thread since the
+  // native display is not safe to use from other threads.
+  PreloadAotData();
+
+  uint64_t renderer_start = embedder_api_.GetCurrentTime();
+  {
+    FT_TRACE_SCOPE("FlutterTizenEngine::CreateRenderer");
+    renderer_ = CreateRenderer(view->tizen_view(), renderer_type);
+  }
+  startup_timings_.renderer_creation =
+      embedder_api_.GetCurrentTime() - renderer_start;
+
+  if (engine_ && !running_ &&
+      (multi_view_ || !dynamic_cast<TizenRendererEgl*>(renderer_.get()))) {
+    // The engine was prewarmed for the EGL renderer without a compositor.
+    // Start over in RunEngine.
+    FT_LOG(Info) << "Discarding the prewarmed engine for another renderer.";
+    {
+      std::lock_guard<std::mutex> lock(vsync_mutex_);
+      vsync_waiter_.reset();
+    }
+    embedder_api_.Shutdown(engine_);
+    engine_ = nullptr;
+  }
 
   if (renderer_type == FlutterDesktopRendererType::kEvasGL) {
     render_loop_ = std::make_unique<TizenRenderEventLoop>(
@@ -314,6 +565,276 @@ void FlutterTizenEngine::SetView(FlutterTizenView* view,
   }
 }
 
+bool FlutterTizenEngine::AddView(FlutterTizenView* view,
+                                 FlutterDesktopRendererType renderer_type,
+                                 ViewCallback callback) {
+  if (!running_ || !view_) {
+    FT_LOG(Error) << "Additional views require a running engine with a view.";
+    return false;
+  }
+  std::unique_ptr<TizenRenderer> renderer;
+  if (renderer_type == FlutterDesktopRendererType::kCPU &&
+      dynamic_cast<TizenRendererSoftware*>(renderer_.get())) {
+    renderer = CreateRenderer(view->tizen_view(), renderer_type);
+  } else if (renderer_type == FlutterDesktopRendererType::kEGL &&
+             dynamic_cast<TizenRendererEgl*>(renderer_.get())) {
+    if (!multi_view_) {
+      FT_LOG(Error) << "Additional views of the EGL renderer require the "
+                       "--tizen-multi-view argument.";
+      return false;
+    }
+    renderer = std::make_unique<TizenRendererEgl>(
+        view->tizen_view(), static_cast<TizenRendererEgl*>(renderer_.get()));
+  } else {
+    FT_LOG(Error) << "Additional views are only supported by the software and "
+                     "EGL renderers, and must use the renderer of the view "
+                     "owning the engine.";
+    return false;
+  }
+  if (!renderer->IsValid()) {
+    FT_LOG(Error) << "Could not create a renderer for view "
+                  << view->view_id() << ".";
+    return false;
+  }
+  return AddView(view, std::move(renderer), std::move(callback));
+}
+
+bool FlutterTizenEngine::AddView(FlutterTizenView* view,
+                                 std::unique_ptr<TizenRenderer> renderer,
+                                 ViewCallback callback) {
+  FlutterViewId view_id = view->view_id();
+  {
+    std::lock_guard<std::mutex> lock(views_mutex_);
+    if (!additional_views_
+             .try_emplace(view_id, AdditionalView{view, std::move(renderer)})
+             .second) {
+      FT_LOG(Error) << "View " << view_id << " already exists.";
+      return false;
+    }
+  }
+
+  TizenGeometry geometry = view->tizen_view()->GetGeometry();
+  FlutterWindowMetricsEvent metrics = {};
+  metrics.struct_size = sizeof(FlutterWindowMetricsEvent);
+  metrics.left = static_cast<size_t>(geometry.left);
+  metrics.top = static_cast<size_t>(geometry.top);
+  metrics.width = static_cast<size_t>(geometry.width);
+  metrics.height = static_cast<size_t>(geometry.height);
+  metrics.pixel_ratio = view->GetPixelRatio();
+  metrics.view_id = view_id;
+
+  FlutterAddViewInfo info = {};
+  info.struct_size = sizeof(FlutterAddViewInfo);
+  info.view_id = view_id;
+  info.view_metrics = &metrics;
+  info.user_data = new ViewRequest{this, view_id, std::move(callback)};
+  info.add_view_callback = [](const FlutterAddViewResult* result) {
+    // Called on an engine thread.
+    std::shared_ptr<ViewRequest> request(
+        static_cast<ViewRequest*>(result->user_data));
+    bool added = result->added;
+    request->engine->RunOnPlatformThread([request, added]() {
+      if (!added) {
+        FT_LOG(Error) << "Could not add view " << request->view_id << ".";
+        request->engine->DestroyView(request->view_id);
+      }
+      if (request->callback) {
+        request->callback(added);
+      }
+    });
+  };
+  if (embedder_api_.AddView(engine_, &info) != kSuccess) {
+    FT_LOG(Error) << "Could not add view " << view_id << ".";
+    delete static_cast<ViewRequest*>(info.user_data);
+    DestroyView(view_id);
+    return false;
+  }
+  return true;
+}
+
+bool FlutterTizenEngine::RemoveView(FlutterViewId view_id,
+                                    ViewCallback callback) {
+  // The view is about to be destroyed, so its renderer must not be used
+  // anymore, even if the engine keeps rendering frames for it until the
+  // removal completes.
+  if (!DestroyView(view_id)) {
+    return false;
+  }
+
+  FlutterRemoveViewInfo info = {};
+  info.struct_size = sizeof(FlutterRemoveViewInfo);
+  info.view_id = view_id;
+  info.user_data = new ViewRequest{this, view_id, std::move(callback)};
+  info.remove_view_callback = [](const FlutterRemoveViewResult* result) {
+    // Called on an engine thread.
+    std::shared_ptr<ViewRequest> request(
+        static_cast<ViewRequest*>(result->user_data));
+    bool removed = result->removed;
+    request->engine->RunOnPlatformThread([request, removed]() {
+      if (!removed) {
+        FT_LOG(Error) << "Could not remove view " << request->view_id << ".";
+      }
+      if (request->callback) {
+        request->callback(removed);
+      }
+    });
+  };
+  if (embedder_api_.RemoveView(engine_, &info) != kSuccess) {
+    FT_LOG(Error) << "Could not remove view " << view_id << ".";
+    std::unique_ptr<ViewRequest> request(
+        static_cast<ViewRequest*>(info.user_data));
+    if (request->callback) {
+      request->callback(false);
+    }
+  }
+  return true;
+}
+
+bool FlutterTizenEngine::DestroyView(FlutterViewId view_id) {
+  std::unique_ptr<TizenRenderer> renderer;
+  std::shared_ptr<AccessibilityBridgeTizen> accessibility_bridge;
+  {
+    // The raster thread holds the lock while presenting, so the renderer is
+    // no longer in use once it's taken out.
+    std::lock_guard<std::mutex> lock(views_mutex_);
+    auto iter = additional_views_.find(view_id);
+    if (iter == additional_views_.end()) {
+      return false;
+    }
+    renderer = std::move(iter->second.renderer);
+    accessibility_bridge = std::move(iter->second.accessibility_bridge);
+    additional_views_.erase(iter);
+  }
+  if (accessibility_bridge) {
+    std::shared_ptr<FlutterPlatformWindowDelegateTizen> window =
+        accessibility_bridge->GetWindow().lock();
+    if (window) {
+      window->ClearRootNode();
+    }
+  }
+  FlutterPlatformAppDelegateTizen::GetInstance().RemoveViewWindow(view_id);
+  return true;
+}
+
+void FlutterTizenEngine::RunOnPlatformThread(std::function<void()> task) {
+  if (event_loop_->RunsTasksOnCurrentThread()) {
+    task();
+    return;
+  }
+  struct Context {
+    std::weak_ptr<FlutterTizenEngine*> engine;
+    std::function<void()> task;
+  };
+  ecore_main_loop_thread_safe_call_async(
+      [](void* data) {
+        std::unique_ptr<Context> context(static_cast<Context*>(data));
+        // The engine is only destroyed on the platform thread.
+        if (!context->engine.expired()) {
+          context->task();
+        }
+      },
+      new Context{self_, std::move(task)});
+}
+
+FlutterTizenView* FlutterTizenEngine::GetView(FlutterViewId view_id) {
+  if (view_id == kImplicitViewId) {
+    return view_;
+  }
+  std::lock_guard<std::mutex> lock(views_mutex_);
+  return GetViewLocked(view_id);
+}
+
+FlutterTizenView* FlutterTizenEngine::GetViewLocked(FlutterViewId view_id) {
+  if (view_id == kImplicitViewId) {
+    return view_;
+  }
+  auto iter = additional_views_.find(view_id);
+  return iter != additional_views_.end() ? iter->second.view : nullptr;
+}
+
+TizenRenderer* FlutterTizenEngine::GetRenderer(FlutterViewId view_id) {
+  if (view_id == kImplicitViewId) {
+    return renderer_.get();
+  }
+  std::lock_guard<std::mutex> lock(views_mutex_);
+  return GetRendererLocked(view_id);
+}
+
+TizenRenderer* FlutterTizenEngine::GetRendererLocked(FlutterViewId view_id) {
+  if (view_id == kImplicitViewId) {
+    return renderer_.get();
+  }
+  auto iter = additional_views_.find(view_id);
+  return iter != additional_views_.end() ? iter->second.renderer.get()
+                                         : nullptr;
+}
+
+void FlutterTizenEngine::SetAotData(SharedAotDataPtr aot_data) {
+  aot_data_ = std::move(aot_data);
+}
+
+void FlutterTizenEngine::PreloadAotData() {
+  if (engine_ || aot_data_ || aot_data_future_.valid() ||
+      !embedder_api_.RunsAOTCompiledDartCode()) {
+    return;
+  }
+  // Copy the proc table so that the worker does not race with its owner.
+  FlutterEngineProcTable embedder_api = embedder_api_;
+  FlutterProjectBundle* project = project_.get();
+  uint64_t* load_time = &startup_timings_.aot_data_load;
+  aot_data_future_ = std::async(
+      std::launch::async, [this, embedder_api, project, load_time]() {
+        FT_TRACE_SCOPE("FlutterProjectBundle::LoadAotData");
+        uint64_t start = embedder_api.GetCurrentTime();
+        PrefetchData();
+        UniqueAotDataPtr aot_data = project->LoadAotData(embedder_api);
+        *load_time = embedder_api.GetCurrentTime() - start;
+        return aot_data;
+      });
+}
+
+UniqueAotDataPtr FlutterTizenEngine::TakeAotData() {
+  if (!aot_data_future_.valid()) {
+    uint64_t start = embedder_api_.GetCurrentTime();
+    PrefetchData();
+    UniqueAotDataPtr aot_data = project_->LoadAotData(embedder_api_);
+    startup_timings_.aot_data_load = embedder_api_.GetCurrentTime() - start;
+    startup_timings_.aot_data_wait = startup_timings_.aot_data_load;
+    return aot_data;
+  }
+  uint64_t start = embedder_api_.GetCurrentTime();
+  UniqueAotDataPtr aot_data = aot_data_future_.get();
+  startup_timings_.aot_data_wait = embedder_api_.GetCurrentTime() - start;
+  return aot_data;
+}
+
+void FlutterTizenEngine::PrefetchData() {
+  if (!project_->HasArgument("--tizen-aot-prefetch")) {
+    return;
+  }
+  FT_TRACE_SCOPE("FlutterTizenEngine::PrefetchData");
+  // Prefetching a whole file would make the profile recorded afterwards cover
+  // the whole file, so files without a profile are only recorded this time.
+  record_aot_page_profile_ = !PrefetchFile(
+      project_->aot_library_path(), GetPageProfilePath(kAotPageProfileName));
+  record_icu_page_profile_ = !PrefetchFile(
+      project_->icu_path(), GetPageProfilePath(kIcuPageProfileName));
+}
+
+void FlutterTizenEngine::RecordPageProfiles() {
+  FT_TRACE_SCOPE("FlutterTizenEngine::RecordPageProfiles");
+  if (record_aot_page_profile_) {
+    RecordPageProfile(project_->aot_library_path(),
+                      GetPageProfilePath(kAotPageProfileName));
+    record_aot_page_profile_ = false;
+  }
+  if (record_icu_page_profile_) {
+    RecordPageProfile(project_->icu_path(),
+                      GetPageProfilePath(kIcuPageProfileName));
+    record_icu_page_profile_ = false;
+  }
+}
+
 void FlutterTizenEngine::AddPluginRegistrarDestructionCallback(
     FlutterDesktopOnPluginRegistrarDestroyed callback,
     FlutterDesktopPluginRegistrarRef registrar) {
@@ -371,7 +892,8 @@ void FlutterTizenEngine::SendPointerEvent(const FlutterPointerEvent& event) {
   embedder_api_.SendPointerEvent(engine_, &event, 1);
 }
 
-void FlutterTizenEngine::SendWindowMetrics(int32_t x,
+void FlutterTizenEngine::SendWindowMetrics(FlutterViewId view_id,
+                                           int32_t x,
                                            int32_t y,
                                            int32_t width,
                                            int32_t height,
@@ -383,12 +905,25 @@ void FlutterTizenEngine::SendWindowMetrics(int32_t x,
   event.width = static_cast<size_t>(width);
   event.height = static_cast<size_t>(height);
   event.pixel_ratio = pixel_ratio;
+  event.view_id = view_id;
   embedder_api_.SendWindowMetricsEvent(engine_, &event);
 }
 
+void FlutterTizenEngine::SendViewFocusEvent(FlutterViewId view_id,
+                                            bool focused) {
+  FlutterViewFocusEvent event = {};
+  event.struct_size = sizeof(FlutterViewFocusEvent);
+  event.view_id = view_id;
+  event.state = focused ? FlutterViewFocusState::kFocused
+                        : FlutterViewFocusState::kUnfocused;
+  event.direction = FlutterViewFocusDirection::kUndefined;
+  embedder_api_.SendViewFocusEvent(engine_, &event);
+}
+
 void FlutterTizenEngine::OnVsync(intptr_t baton,
                                  uint64_t frame_start_time_nanos,
                                  uint64_t frame_target_time_nanos) {
+  frame_statistics_->OnVsync(frame_start_time_nanos, frame_target_time_nanos);
   embedder_api_.OnVsync(engine_, baton, frame_start_time_nanos,
                         frame_target_time_nanos);
 }
@@ -412,7 +947,62 @@ void FlutterTizenEngine::SetupLocales() {
 }
 
 void FlutterTizenEngine::NotifyLowMemoryWarning() {
-  embedder_api_.NotifyLowMemoryWarning(engine_);
+  if (!memory_pressure_monitor_) {
+    embedder_api_.NotifyLowMemoryWarning(engine_);
+    return;
+  }
+  memory_pressure_monitor_->OnMemoryPressure(MemoryPressureLevel::kCritical);
+}
+
+size_t FlutterTizenEngine::NotifyMemoryPressure(MemoryPressureLevel level) {
+  if (!memory_pressure_monitor_) {
+    if (level != MemoryPressureLevel::kNormal) {
+      embedder_api_.NotifyLowMemoryWarning(engine_);
+    }
+    return 0;
+  }
+  return memory_pressure_monitor_->OnMemoryPressure(level);
+}
+
+void FlutterTizenEngine::CreateMemoryPressureMonitor() {
+  memory_pressure_monitor_ = std::make_unique<MemoryPressureMonitor>(
+      std::make_unique<VconfMemoryPressureSource>(),
+      [this](MemoryPressureLevel level) {
+        embedder_api_.NotifyLowMemoryWarning(engine_);
+      });
+
+  memory_pressure_monitor_->AddTrimmer(
+      "textures", [this](MemoryPressureLevel level) -> size_t {
+        if (texture_registrar_) {
+          texture_registrar_->TrimMemory(level, [this](size_t bytes) {
+            memory_pressure_monitor_->AddReleasedBytes(bytes);
+          });
+        }
+        return 0;
+      });
+
+  // Only the tree built from buffered updates in lazy accessibility mode can
+  // be released, since it is rebuilt from the buffer on the next query.
+  // Semantics stay enabled in the engine.
+  memory_pressure_monitor_->AddTrimmer(
+      "accessibility", [this](MemoryPressureLevel level) -> size_t {
+        if (!accessibility_bridge_ || !semantics_buffer_ ||
+            IsScreenReaderEnabled()) {
+          return 0;
+        }
+        // A lower bound, excluding the strings and lists of each node.
+        size_t released =
+            accessibility_bridge_->GetTree()->size() *
+            (sizeof(ui::AXNode) + sizeof(FlutterPlatformNodeDelegateTizen));
+        DeactivateAccessibility();
+        return released;
+      });
+
+  memory_pressure_monitor_->AddTrimmer(
+      "offscreen surface", [this](MemoryPressureLevel level) -> size_t {
+        return offscreen_surface_ ? offscreen_surface_->ReleaseCachedMemory()
+                                  : 0;
+      });
 }
 
 bool FlutterTizenEngine::RegisterExternalTexture(int64_t texture_id) {
@@ -430,6 +1020,12 @@ bool FlutterTizenEngine::MarkExternalTextureFrameAvailable(int64_t texture_id) {
               engine_, texture_id) == kSuccess);
 }
 
+bool FlutterTizenEngine::PostRenderThreadTask(VoidCallback callback,
+                                              void* user_data) {
+  return (embedder_api_.PostRenderThreadTask(engine_, callback, user_data) ==
+          kSuccess);
+}
+
 void FlutterTizenEngine::UpdateAccessibilityFeatures(bool invert_colors,
                                                      bool high_contrast) {
   int32_t flags = 0;
@@ -450,67 +1046,232 @@ FlutterDesktopMessage FlutterTizenEngine::ConvertToDesktopMessage(
   return message;
 }
 
-FlutterRendererConfig FlutterTizenEngine::GetRendererConfig() {
-  if (IsHeaded()) {
-    return renderer()->GetRendererConfig();
+FlutterRendererConfig FlutterTizenEngine::GetRendererConfig(bool headed) {
+  if (headed) {
+    if (renderer_) {
+      return renderer_->GetRendererConfig();
+    }
+    // No view has been attached to the prewarmed engine yet.
+    return TizenRendererGL::CreateRendererConfig();
   } else {
+    if (!offscreen_surface_) {
+      offscreen_surface_ = std::make_unique<OffscreenSurface>();
+      std::string dump_directory;
+      if (project_->GetArgumentValue("--tizen-offscreen-dump-dir",
+                                     &dump_directory)) {
+        std::string dump_format;
+        project_->GetArgumentValue("--tizen-offscreen-dump-format",
+                                   &dump_format);
+        offscreen_surface_->SetDumpDirectory(
+            dump_directory, dump_format == "raw"
+                                ? OffscreenSurface::DumpFormat::kRaw
+                                : OffscreenSurface::DumpFormat::kPng);
+      }
+    }
+
     FlutterRendererConfig config = {};
     config.type = kSoftware;
     config.software.struct_size = sizeof(config.software);
     config.software.surface_present_callback =
         [](void* user_data, const void* allocation, size_t row_bytes,
-           size_t height) -> bool { return true; };
+           size_t height) -> bool {
+      auto* engine = static_cast<FlutterTizenEngine*>(user_data);
+      return engine->offscreen_surface_->Present(allocation, row_bytes,
+                                                 height);
+    };
     return config;
   }
 }
 
 void FlutterTizenEngine::DispatchAccessibilityAction(
+    FlutterViewId view_id,
     uint64_t target,
     FlutterSemanticsAction action,
     fml::MallocMapping data) {
-  embedder_api_.DispatchSemanticsAction(engine_, target, action,
-                                        data.GetMapping(), data.GetSize());
+  last_accessibility_query_time_ = embedder_api_.GetCurrentTime();
+  FlutterSendSemanticsActionInfo info = {};
+  info.struct_size = sizeof(FlutterSendSemanticsActionInfo);
+  info.view_id = view_id;
+  info.node_id = target;
+  info.action = action;
+  info.data = data.GetMapping();
+  info.data_length = data.GetSize();
+  embedder_api_.SendSemanticsAction(engine_, &info);
 }
 
 void FlutterTizenEngine::SetSemanticsEnabled(bool enabled) {
   FT_LOG(Debug) << "Accessibility enabled: " << enabled;
-  if (!enabled && accessibility_bridge_) {
+  if (!enabled) {
     accessibility_bridge_.reset();
-  } else if (enabled && !accessibility_bridge_) {
-    accessibility_bridge_ = std::make_shared<AccessibilityBridgeTizen>(this);
+    semantics_buffer_.reset();
+    focused_node_id_ = -1;
+    std::lock_guard<std::mutex> lock(views_mutex_);
+    for (auto& [view_id, additional_view] : additional_views_) {
+      additional_view.accessibility_bridge.reset();
+    }
+  } else if (lazy_accessibility_) {
+    // The tree is built on the first query from an assistive client.
+    if (!semantics_buffer_) {
+      semantics_buffer_ = std::make_unique<SemanticsUpdateBuffer>();
+    }
+  } else if (!accessibility_bridge_) {
+    accessibility_bridge_ =
+        std::make_shared<AccessibilityBridgeTizen>(this, kImplicitViewId);
   }
 
   FlutterPlatformAppDelegateTizen::GetInstance().SetAccessibilityStatus(
       enabled);
+  std::shared_ptr<FlutterPlatformWindowDelegateTizen> window =
+      FlutterPlatformAppDelegateTizen::GetInstance().GetWindow().lock();
+  if (window) {
+    if (semantics_buffer_) {
+      window->SetQueryCallback([this]() { OnAccessibilityQuery(); });
+    } else {
+      window->SetQueryCallback(nullptr);
+    }
+  }
 
   embedder_api_.UpdateSemanticsEnabled(engine_, enabled);
 }
 
 void FlutterTizenEngine::OnUpdateSemantics(
     const FlutterSemanticsUpdate2* update) {
-  if (!accessibility_bridge_) {
+  if (update->view_id != kImplicitViewId) {
+    OnUpdateViewSemantics(update);
+    return;
+  }
+  if (!accessibility_bridge_ && !semantics_buffer_) {
     FT_LOG(Error) << "The accessibility bridge must be initialized.";
     return;
   }
 
+  if (semantics_buffer_) {
+    bool focus_moved = UpdateFocusedNode(*update, &focused_node_id_);
+    if (!accessibility_bridge_ && focus_moved && IsScreenReaderEnabled()) {
+      // A screen reader announces focus changes without querying the tree
+      // first, so the tree is rebuilt from the updates received so far and
+      // this update is applied to it as usual.
+      FT_LOG(Debug) << "Rebuilding the accessibility tree for an announcement.";
+      last_accessibility_query_time_ = embedder_api_.GetCurrentTime();
+      ActivateAccessibility();
+    }
+    semantics_buffer_->AddUpdate(*update);
+    if (!accessibility_bridge_) {
+      return;
+    }
+    // A screen reader may still announce changes without querying the tree,
+    // so the tree is only released while it is off.
+    if (!IsScreenReaderEnabled() &&
+        embedder_api_.GetCurrentTime() - last_accessibility_query_time_ >
+            kAccessibilityIdleTimeoutNanos) {
+      DeactivateAccessibility();
+      return;
+    }
+  }
+
+  ApplySemanticsUpdate(
+      view_,
+      static_cast<AccessibilityBridgeTizen*>(accessibility_bridge_.get()),
+      update);
+}
+
+void FlutterTizenEngine::OnUpdateViewSemantics(
+    const FlutterSemanticsUpdate2* update) {
+  // Each additional view has its own tree, exposed to AT-SPI as a window of
+  // its own.
+  FlutterTizenView* view = nullptr;
+  std::shared_ptr<AccessibilityBridgeTizen> bridge;
+  {
+    std::lock_guard<std::mutex> lock(views_mutex_);
+    auto iter = additional_views_.find(update->view_id);
+    if (iter == additional_views_.end()) {
+      // The view has been removed.
+      return;
+    }
+    if (!iter->second.accessibility_bridge) {
+      iter->second.accessibility_bridge =
+          std::make_shared<AccessibilityBridgeTizen>(this, update->view_id);
+    }
+    view = iter->second.view;
+    bridge = iter->second.accessibility_bridge;
+  }
+  ApplySemanticsUpdate(view, bridge.get(), update);
+}
+
+void FlutterTizenEngine::ApplySemanticsUpdate(
+    FlutterTizenView* view,
+    AccessibilityBridgeTizen* bridge,
+    const FlutterSemanticsUpdate2* update) {
   for (size_t i = 0; i < update->node_count; i++) {
     const FlutterSemanticsNode2* node = update->nodes[i];
-    accessibility_bridge_->AddFlutterSemanticsNodeUpdate(*node);
+    bridge->AddFlutterSemanticsNodeUpdate(*node);
   }
 
   for (size_t i = 0; i < update->custom_action_count; i++) {
     const FlutterSemanticsCustomAction2* action = update->custom_actions[i];
-    accessibility_bridge_->AddFlutterSemanticsCustomActionUpdate(*action);
+    bridge->AddFlutterSemanticsCustomActionUpdate(*action);
+  }
+
+  bridge->CommitUpdates();
+  AttachAccessibilityRoot(view, bridge);
+  // The framework has applied the actions sent so far.
+  bridge->FlushActions();
+}
+
+void FlutterTizenEngine::OnAccessibilityQuery() {
+  last_accessibility_query_time_ = embedder_api_.GetCurrentTime();
+  if (accessibility_bridge_ || !semantics_buffer_) {
+    return;
   }
+  ActivateAccessibility();
+}
 
+bool FlutterTizenEngine::IsScreenReaderEnabled() const {
+  return accessibility_settings_ &&
+         accessibility_settings_->screen_reader_enabled();
+}
+
+void FlutterTizenEngine::ActivateAccessibility() {
+  FT_LOG(Debug) << "Building the accessibility tree from "
+                << semantics_buffer_->node_count() << " buffered nodes.";
+  accessibility_bridge_ =
+      std::make_shared<AccessibilityBridgeTizen>(this, kImplicitViewId);
+  semantics_buffer_->Replay(*accessibility_bridge_);
   accessibility_bridge_->CommitUpdates();
+  AttachAccessibilityRoot(
+      view_,
+      static_cast<AccessibilityBridgeTizen*>(accessibility_bridge_.get()));
+}
 
-  // Attaches the accessibility root to the window delegate.
-  std::weak_ptr<FlutterPlatformNodeDelegate> root =
-      accessibility_bridge_->GetFlutterPlatformNodeDelegateFromID(0);
+void FlutterTizenEngine::DeactivateAccessibility() {
+  FT_LOG(Debug) << "Releasing the idle accessibility tree.";
+  // Tell assistive clients that the window has lost its child so that they
+  // drop their references into the tree. The window reports no children
+  // until the next query rebuilds the tree.
   std::shared_ptr<FlutterPlatformWindowDelegateTizen> window =
       FlutterPlatformAppDelegateTizen::GetInstance().GetWindow().lock();
-  TizenGeometry geometry = view_->tizen_view()->GetGeometry();
+  if (window) {
+    window->ClearRootNode();
+  }
+  accessibility_bridge_.reset();
+}
+
+void FlutterTizenEngine::AttachAccessibilityRoot(
+    FlutterTizenView* view,
+    AccessibilityBridgeTizen* bridge) {
+  if (!view) {
+    return;
+  }
+  std::shared_ptr<FlutterPlatformWindowDelegateTizen> window =
+      bridge->GetWindow().lock();
+  if (!window) {
+    return;
+  }
+
+  // Attaches the accessibility root to the window delegate.
+  std::weak_ptr<FlutterPlatformNodeDelegate> root =
+      bridge->GetFlutterPlatformNodeDelegateFromID(0);
+  TizenGeometry geometry = view->tizen_view()->GetGeometry();
   window->SetGeometry(geometry.left, geometry.top, geometry.width,
                       geometry.height);
   window->SetRootNode(root);
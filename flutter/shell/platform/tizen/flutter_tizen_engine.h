@@ -6,7 +6,11 @@
 #ifndef EMBEDDER_FLUTTER_TIZEN_ENGINE_H_
 #define EMBEDDER_FLUTTER_TIZEN_ENGINE_H_
 
+#include <functional>
+#include <future>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 
 #include "flutter/shell/platform/common/accessibility_bridge.h"
 #include "flutter/shell/platform/common/client_wrapper/include/flutter/plugin_registrar.h"
@@ -15,6 +19,7 @@
 #include "flutter/shell/platform/tizen/accessibility_settings.h"
 #include "flutter/shell/platform/tizen/channels/accessibility_channel.h"
 #include "flutter/shell/platform/tizen/channels/app_control_channel.h"
+#include "flutter/shell/platform/tizen/channels/frame_statistics_channel.h"
 #include "flutter/shell/platform/tizen/channels/keyboard_channel.h"
 #include "flutter/shell/platform/tizen/channels/lifecycle_channel.h"
 #include "flutter/shell/platform/tizen/channels/navigation_channel.h"
@@ -23,7 +28,11 @@
 #include "flutter/shell/platform/tizen/flutter_project_bundle.h"
 #include "flutter/shell/platform/tizen/flutter_tizen_display_monitor.h"
 #include "flutter/shell/platform/tizen/flutter_tizen_texture_registrar.h"
+#include "flutter/shell/platform/tizen/frame_statistics.h"
+#include "flutter/shell/platform/tizen/memory_pressure_monitor.h"
+#include "flutter/shell/platform/tizen/offscreen_surface.h"
 #include "flutter/shell/platform/tizen/public/flutter_tizen.h"
+#include "flutter/shell/platform/tizen/semantics_update_buffer.h"
 #include "flutter/shell/platform/tizen/tizen_event_loop.h"
 #include "flutter/shell/platform/tizen/tizen_renderer.h"
 #include "flutter/shell/platform/tizen/tizen_vsync_waiter.h"
@@ -48,8 +57,29 @@ namespace flutter {
 // https://api.flutter.dev/flutter/dart-ui/PlatformDispatcher/implicitView.html
 constexpr FlutterViewId kImplicitViewId = 0;
 
+class AccessibilityBridgeTizen;
 class FlutterTizenView;
 
+// Durations of the engine startup phases in nanoseconds. Phases that did not
+// run are left as zero.
+struct StartupTimings {
+  // Loading the AOT ELF, possibly on a worker thread.
+  uint64_t aot_data_load = 0;
+
+  // Time RunEngine was blocked waiting for the AOT data to be loaded.
+  uint64_t aot_data_wait = 0;
+
+  // Creating the renderer and its surface in SetView.
+  uint64_t renderer_creation = 0;
+
+  // Starting the engine, or only running it if it has been prewarmed.
+  uint64_t engine_run = 0;
+
+  // Creating channels and sending display and locale information after the
+  // engine has started.
+  uint64_t post_run = 0;
+};
+
 // Manages state associated with the underlying FlutterEngine.
 class FlutterTizenEngine {
  public:
@@ -62,8 +92,9 @@ class FlutterTizenEngine {
   FlutterTizenEngine(FlutterTizenEngine const&) = delete;
   FlutterTizenEngine& operator=(FlutterTizenEngine const&) = delete;
 
-  // Creates a GL renderer from the given type.
+  // Creates a renderer of the given type for |tizen_view|.
   std::unique_ptr<TizenRenderer> CreateRenderer(
+      TizenViewBase* tizen_view,
       FlutterDesktopRendererType renderer_type);
 
   // Starts running the engine with the given entrypoint. If null, defaults to
@@ -72,8 +103,15 @@ class FlutterTizenEngine {
   // Returns false if the engine couldn't be started.
   bool RunEngine();
 
+  // Initializes the engine without running it, so that RunEngine only needs to
+  // launch the engine once a view is attached. The view must use the EGL
+  // renderer, otherwise the initialized engine is discarded by SetView.
+  //
+  // Returns false if the engine couldn't be initialized.
+  bool PrewarmEngine();
+
   // Returns true if the engine is currently running.
-  bool IsRunning() { return engine_ != nullptr; }
+  bool IsRunning() { return running_; }
 
   // Stops the engine.
   bool StopEngine();
@@ -86,6 +124,44 @@ class FlutterTizenEngine {
   // headless engines.
   FlutterTizenView* view() { return view_; }
 
+  // Returns a new ID for an additional view.
+  FlutterViewId AllocateViewId() { return next_view_id_++; }
+
+  // Called on the platform thread with whether a view has been added to or
+  // removed from the engine.
+  using ViewCallback = std::function<void(bool result)>;
+
+  // Adds |view| as an additional view displaying this engine's content,
+  // rendered by its own renderer of |renderer_type|. The engine must be
+  // running and displayed by a view, which is the implicit view.
+  //
+  // Additional views require a renderer that presents through a compositor:
+  // the software renderer, or the EGL renderer if the engine has been run
+  // with the --tizen-multi-view argument. The renderer type must match that
+  // of the implicit view.
+  //
+  // Returns false if the view can't be added, in which case |callback| is
+  // not called. Otherwise |callback| is called once the engine has added the
+  // view, unless the engine is stopped first.
+  bool AddView(FlutterTizenView* view,
+               FlutterDesktopRendererType renderer_type,
+               ViewCallback callback);
+
+  // Removes the additional view identified by |view_id| and destroys its
+  // renderer. Frames rendered for the view from then on are dropped.
+  //
+  // Returns false if no such view exists, in which case |callback| is not
+  // called. Otherwise |callback| is called once the engine has removed the
+  // view, unless the engine is stopped first.
+  bool RemoveView(FlutterViewId view_id, ViewCallback callback = nullptr);
+
+  // The view identified by |view_id|, or nullptr if no such view exists.
+  FlutterTizenView* GetView(FlutterViewId view_id);
+
+  // The renderer of the view identified by |view_id|, or nullptr if no such
+  // view exists.
+  TizenRenderer* GetRenderer(FlutterViewId view_id);
+
   FlutterDesktopMessengerRef messenger() { return messenger_.get(); }
 
   IncomingMessageDispatcher* message_dispatcher() {
@@ -112,10 +188,34 @@ class FlutterTizenEngine {
 
   NavigationChannel* navigation_channel() { return navigation_channel_.get(); }
 
+  FrameStatistics* frame_statistics() { return frame_statistics_.get(); }
+
+  // The memory pressure monitor, or nullptr if the engine isn't running.
+  MemoryPressureMonitor* memory_pressure_monitor() {
+    return memory_pressure_monitor_.get();
+  }
+
+  // The render target of a headless engine, or nullptr if the engine is
+  // headed or hasn't been started yet.
+  OffscreenSurface* offscreen_surface() { return offscreen_surface_.get(); }
+
+  // Shares AOT data loaded by another owner, such as an engine pool. Must be
+  // called before the engine is started or prewarmed.
+  void SetAotData(SharedAotDataPtr aot_data);
+
+  // The durations of the startup phases, valid after RunEngine has returned.
+  const StartupTimings& startup_timings() const { return startup_timings_; }
+
   std::weak_ptr<flutter::AccessibilityBridge> accessibility_bridge() {
     return accessibility_bridge_;
   }
 
+  // Whether bounds changes of semantics nodes are reported to assistive
+  // clients, enabled by the --tizen-accessibility-location-events argument.
+  bool accessibility_location_events() const {
+    return accessibility_location_events_;
+  }
+
   // Registers |callback| to be called when the plugin registrar is destroyed.
   void AddPluginRegistrarDestructionCallback(
       FlutterDesktopOnPluginRegistrarDestroyed callback,
@@ -143,14 +243,19 @@ class FlutterTizenEngine {
   // Informs the engine of an incoming pointer event.
   void SendPointerEvent(const FlutterPointerEvent& event);
 
-  // Sends a window metrics update to the Flutter engine using current window
-  // dimensions in physical
-  void SendWindowMetrics(int32_t x,
+  // Sends a window metrics update for the view identified by |view_id| to the
+  // Flutter engine using current window dimensions in physical
+  void SendWindowMetrics(FlutterViewId view_id,
+                         int32_t x,
                          int32_t y,
                          int32_t width,
                          int32_t height,
                          double pixel_ratio);
 
+  // Informs the engine that the view identified by |view_id| has gained or
+  // lost the platform focus.
+  void SendViewFocusEvent(FlutterViewId view_id, bool focused);
+
   void OnVsync(intptr_t baton,
                uint64_t frame_start_time_nanos,
                uint64_t frame_target_time_nanos);
@@ -158,9 +263,14 @@ class FlutterTizenEngine {
   // Passes locale information to the Flutter engine.
   void SetupLocales();
 
-  // Posts a low memory notification to the Flutter engine.
+  // Posts a low memory notification to the Flutter engine, and releases
+  // memory held by the embedder as on critical memory pressure.
   void NotifyLowMemoryWarning();
 
+  // Reacts to memory pressure of |level| reported by the app. See
+  // MemoryPressureMonitor::OnMemoryPressure.
+  size_t NotifyMemoryPressure(MemoryPressureLevel level);
+
   // Attempts to register the texture with the given |texture_id|.
   bool RegisterExternalTexture(int64_t texture_id);
 
@@ -171,8 +281,14 @@ class FlutterTizenEngine {
   // given |texture_id|.
   bool MarkExternalTextureFrameAvailable(int64_t texture_id);
 
+  // Posts |callback| to be run on the render thread with |user_data|.
+  //
+  // Returns false if the engine is not running.
+  bool PostRenderThreadTask(VoidCallback callback, void* user_data);
+
   // Dispatch accessibility action back to the Flutter framework.
-  void DispatchAccessibilityAction(uint64_t target,
+  void DispatchAccessibilityAction(FlutterViewId view_id,
+                                   uint64_t target,
                                    FlutterSemanticsAction action,
                                    fml::MallocMapping data);
 
@@ -195,18 +311,94 @@ class FlutterTizenEngine {
   FlutterDesktopMessage ConvertToDesktopMessage(
       const FlutterPlatformMessage& engine_message);
 
-  // Creates and returns a FlutterRendererConfig depending on the current
-  // display mode (headed or headless).
+  // Initializes the engine, and runs it unless |initialize_only| is true.
+  bool StartEngine(bool initialize_only);
+
+  // Creates and returns a FlutterRendererConfig depending on the display mode
+  // (headed or headless).
   // The user_data received by the render callbacks refers to the
   // FlutterTizenEngine.
-  FlutterRendererConfig GetRendererConfig();
+  FlutterRendererConfig GetRendererConfig(bool headed);
+
+  // Returns the view of |view_id|. |views_mutex_| must be held.
+  FlutterTizenView* GetViewLocked(FlutterViewId view_id);
+
+  // Returns the renderer of |view_id|. |views_mutex_| must be held.
+  TizenRenderer* GetRendererLocked(FlutterViewId view_id);
+
+  // Adds |view| drawn by |renderer|. See the public AddView.
+  bool AddView(FlutterTizenView* view,
+               std::unique_ptr<TizenRenderer> renderer,
+               ViewCallback callback);
+
+  // Removes the additional view |view_id| from |additional_views_|, and
+  // destroys its renderer and accessibility tree.
+  //
+  // Returns false if no such view exists.
+  bool DestroyView(FlutterViewId view_id);
+
+  // Runs |task| on the platform thread, or drops it if the engine is
+  // destroyed first.
+  void RunOnPlatformThread(std::function<void()> task);
 
   // Called when semantics nodes updates are received from the engine.
   void OnUpdateSemantics(const FlutterSemanticsUpdate2* update);
 
+  // Applies |update| to the tree of the additional view it belongs to.
+  void OnUpdateViewSemantics(const FlutterSemanticsUpdate2* update);
+
+  // Applies |update| to the tree of |bridge|, which is displayed by |view|.
+  void ApplySemanticsUpdate(FlutterTizenView* view,
+                            AccessibilityBridgeTizen* bridge,
+                            const FlutterSemanticsUpdate2* update);
+
+  // Called when an assistive client queries the accessibility window. In lazy
+  // accessibility mode, builds the accessibility tree from the buffered
+  // semantics updates if it doesn't exist.
+  void OnAccessibilityQuery();
+
+  // Whether the screen reader is turned on in the system settings.
+  bool IsScreenReaderEnabled() const;
+
+  // Builds the accessibility tree from the buffered semantics updates in lazy
+  // accessibility mode.
+  void ActivateAccessibility();
+
+  // Releases the accessibility tree in lazy accessibility mode. The semantics
+  // updates keep being buffered.
+  void DeactivateAccessibility();
+
+  // Attaches the root of the accessibility tree of |bridge| to the window
+  // delegate of |view|.
+  void AttachAccessibilityRoot(FlutterTizenView* view,
+                               AccessibilityBridgeTizen* bridge);
+
+  // Starts loading AOT data on a worker thread so that mapping the ELF
+  // overlaps with window and renderer creation on the platform thread.
+  void PreloadAotData();
+
+  // Returns the AOT data loaded by PreloadAotData, or loads it synchronously
+  // if no preload is in progress.
+  UniqueAotDataPtr TakeAotData();
+
+  // Warms up the page cache for the AOT library and the ICU data using the
+  // page profiles recorded by a previous run, if enabled.
+  void PrefetchData();
+
+  // Records the page profiles of the files that PrefetchData could not
+  // prefetch, to be used by the next run.
+  void RecordPageProfiles();
+
+  // Creates |memory_pressure_monitor_| and registers the memory held by the
+  // embedder that can be released on memory pressure.
+  void CreateMemoryPressureMonitor();
+
   // The Flutter engine instance.
   FLUTTER_API_SYMBOL(FlutterEngine) engine_ = nullptr;
 
+  // Whether |engine_| has been run, as opposed to only initialized.
+  bool running_ = false;
+
   // The proc table of the embedder APIs.
   FlutterEngineProcTable embedder_api_ = {};
 
@@ -214,11 +406,39 @@ class FlutterTizenEngine {
   std::unique_ptr<FlutterProjectBundle> project_;
 
   // AOT data for this engine instance, if applicable.
-  UniqueAotDataPtr aot_data_;
+  SharedAotDataPtr aot_data_;
 
   // The view displaying the content running in this engine, if any.
   FlutterTizenView* view_ = nullptr;
 
+  // An additional view, its renderer and its accessibility tree.
+  struct AdditionalView {
+    FlutterTizenView* view = nullptr;
+    std::unique_ptr<TizenRenderer> renderer;
+    // Built from the semantics updates of the view while semantics are
+    // enabled, regardless of the lazy accessibility mode.
+    std::shared_ptr<AccessibilityBridgeTizen> accessibility_bridge;
+  };
+
+  // The additional views, keyed by their IDs.
+  //
+  // Guarded by |views_mutex_| since renderers are looked up when presenting on
+  // the raster thread.
+  std::unordered_map<FlutterViewId, AdditionalView> additional_views_;
+  std::mutex views_mutex_;
+
+  // The ID of the next additional view.
+  FlutterViewId next_view_id_ = kImplicitViewId + 1;
+
+  // Whether GL renderers present through a compositor so that additional
+  // views can be added, enabled by the --tizen-multi-view argument.
+  bool multi_view_ = false;
+
+  // Only referenced by the engine, so that tasks posted to the platform
+  // thread can tell whether the engine has been destroyed.
+  std::shared_ptr<FlutterTizenEngine*> self_ =
+      std::make_shared<FlutterTizenEngine*>(this);
+
   // The plugin messenger handle given to API clients.
   std::unique_ptr<FlutterDesktopMessenger> messenger_;
 
@@ -240,6 +460,26 @@ class FlutterTizenEngine {
   // The accessibility bridge for the Tizen platform.
   std::shared_ptr<AccessibilityBridge> accessibility_bridge_;
 
+  // Whether the accessibility tree is only built while assistive clients
+  // query it, enabled by the --tizen-lazy-accessibility argument. In this mode
+  // |accessibility_bridge_| only exists while the tree is in use.
+  bool lazy_accessibility_ = false;
+
+  // Whether bounds changes of semantics nodes are reported to assistive
+  // clients.
+  bool accessibility_location_events_ = false;
+
+  // The semantics updates received while semantics are enabled in lazy
+  // accessibility mode.
+  std::unique_ptr<SemanticsUpdateBuffer> semantics_buffer_;
+
+  // The time of the last query from an assistive client, in nanoseconds.
+  uint64_t last_accessibility_query_time_ = 0;
+
+  // The ID of the focused semantics node in lazy accessibility mode, or -1 if
+  // no node is focused.
+  int32_t focused_node_id_ = -1;
+
   std::unique_ptr<AccessibilitySettings> accessibility_settings_;
 
   // The plugin registrar managing internal plugins.
@@ -271,6 +511,10 @@ class FlutterTizenEngine {
   // An interface between the Flutter rasterizer and the platform.
   std::unique_ptr<TizenRenderer> renderer_;
 
+  // The compositor routing the frames of each view to its renderer, if the
+  // renderer presents through a compositor.
+  FlutterCompositor compositor_ = {};
+
   std::mutex vsync_mutex_;
 
   // The vsync waiter for the embedder.
@@ -278,6 +522,28 @@ class FlutterTizenEngine {
 
   // The display monitor.
   std::unique_ptr<FlutterTizenDisplayMonitor> display_monitor_;
+
+  // The frame timing collector.
+  std::unique_ptr<FrameStatistics> frame_statistics_;
+
+  // A plugin to query the frame statistics.
+  std::unique_ptr<FrameStatisticsChannel> frame_statistics_channel_;
+
+  // Releases memory on memory pressure.
+  std::unique_ptr<MemoryPressureMonitor> memory_pressure_monitor_;
+
+  // The surface presented to by the software rasterizer in headless mode.
+  std::unique_ptr<OffscreenSurface> offscreen_surface_;
+
+  StartupTimings startup_timings_;
+
+  // Whether the page profiles should be recorded when the engine stops.
+  bool record_aot_page_profile_ = false;
+  bool record_icu_page_profile_ = false;
+
+  // The pending result of PreloadAotData. Declared after |startup_timings_|
+  // since the worker writes to it and the future blocks on destruction.
+  std::future<UniqueAotDataPtr> aot_data_future_;
 };
 
 }  // namespace flutter
@@ -0,0 +1,85 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter_tizen_engine_pool.h"
+
+#include "flutter/shell/platform/tizen/logger.h"
+
+namespace flutter {
+
+FlutterTizenEnginePool::FlutterTizenEnginePool(
+    const FlutterProjectBundle& project,
+    size_t size)
+    : project_(std::make_unique<FlutterProjectBundle>(project)), size_(size) {
+  FlutterEngineProcTable embedder_api = {};
+  embedder_api.struct_size = sizeof(FlutterEngineProcTable);
+  FlutterEngineGetProcAddresses(&embedder_api);
+  if (embedder_api.RunsAOTCompiledDartCode()) {
+    aot_data_ = project_->LoadAotData(embedder_api);
+  }
+  ScheduleFill();
+}
+
+FlutterTizenEnginePool::~FlutterTizenEnginePool() {
+  if (fill_idler_) {
+    ecore_idler_del(fill_idler_);
+    fill_idler_ = nullptr;
+  }
+}
+
+std::unique_ptr<FlutterTizenEngine> FlutterTizenEnginePool::Acquire() {
+  std::unique_ptr<FlutterTizenEngine> engine;
+  if (engines_.empty()) {
+    FT_LOG(Info) << "No prewarmed engine is available.";
+    engine = CreateEngine();
+  } else {
+    engine = std::move(engines_.front());
+    engines_.pop_front();
+  }
+  ScheduleFill();
+  return engine;
+}
+
+std::unique_ptr<FlutterTizenEngine> FlutterTizenEnginePool::CreateEngine() {
+  auto engine = std::make_unique<FlutterTizenEngine>(*project_);
+  if (aot_data_) {
+    engine->SetAotData(aot_data_);
+  }
+  if (engine_created_callback_) {
+    engine_created_callback_(engine.get());
+  }
+  return engine;
+}
+
+bool FlutterTizenEnginePool::AddEngine() {
+  if (engines_.size() >= size_) {
+    return false;
+  }
+  std::unique_ptr<FlutterTizenEngine> engine = CreateEngine();
+  if (!engine->PrewarmEngine()) {
+    FT_LOG(Error) << "Failed to prewarm an engine.";
+    return false;
+  }
+  engines_.push_back(std::move(engine));
+  return true;
+}
+
+void FlutterTizenEnginePool::ScheduleFill() {
+  if (fill_idler_ || engines_.size() >= size_) {
+    return;
+  }
+  // Prewarm one engine per idle period to keep the main loop responsive.
+  fill_idler_ = ecore_idler_add(
+      [](void* data) -> Eina_Bool {
+        auto* self = static_cast<FlutterTizenEnginePool*>(data);
+        if (self->AddEngine() && self->engines_.size() < self->size_) {
+          return ECORE_CALLBACK_RENEW;
+        }
+        self->fill_idler_ = nullptr;
+        return ECORE_CALLBACK_CANCEL;
+      },
+      this);
+}
+
+}  // namespace flutter
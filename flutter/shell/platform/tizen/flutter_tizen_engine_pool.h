@@ -0,0 +1,74 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef EMBEDDER_FLUTTER_TIZEN_ENGINE_POOL_H_
+#define EMBEDDER_FLUTTER_TIZEN_ENGINE_POOL_H_
+
+#include <Ecore.h>
+
+#include <deque>
+#include <functional>
+#include <memory>
+
+#include "flutter/shell/platform/tizen/flutter_project_bundle.h"
+#include "flutter/shell/platform/tizen/flutter_tizen_engine.h"
+
+namespace flutter {
+
+// Keeps engines for a project initialized in advance, so that short-lived
+// views can be started without paying the full engine startup cost.
+//
+// All engines created by the pool share a single copy of the AOT data. The
+// pool is filled while the main loop is idle, one engine at a time. Must be
+// used on the main thread.
+class FlutterTizenEnginePool {
+ public:
+  // Creates a pool that keeps up to |size| prewarmed engines for |project|.
+  FlutterTizenEnginePool(const FlutterProjectBundle& project, size_t size);
+
+  ~FlutterTizenEnginePool();
+
+  // Prevent copying.
+  FlutterTizenEnginePool(FlutterTizenEnginePool const&) = delete;
+  FlutterTizenEnginePool& operator=(FlutterTizenEnginePool const&) = delete;
+
+  // Takes a prewarmed engine out of the pool, or creates a new engine if the
+  // pool is empty. The pool is refilled afterwards.
+  std::unique_ptr<FlutterTizenEngine> Acquire();
+
+  // The number of prewarmed engines currently in the pool.
+  size_t available() const { return engines_.size(); }
+
+ private:
+  friend class EnginePoolModifier;
+
+  // Creates an engine that shares the pool's AOT data.
+  std::unique_ptr<FlutterTizenEngine> CreateEngine();
+
+  // Adds a prewarmed engine to the pool. Returns false if the pool is full or
+  // an engine couldn't be prewarmed.
+  bool AddEngine();
+
+  // Fills the pool when the main loop becomes idle.
+  void ScheduleFill();
+
+  std::unique_ptr<FlutterProjectBundle> project_;
+
+  size_t size_;
+
+  // The AOT data shared by all engines, if applicable.
+  SharedAotDataPtr aot_data_;
+
+  std::deque<std::unique_ptr<FlutterTizenEngine>> engines_;
+
+  Ecore_Idler* fill_idler_ = nullptr;
+
+  // Called with every engine created by the pool before it is prewarmed.
+  // Only used by tests.
+  std::function<void(FlutterTizenEngine*)> engine_created_callback_;
+};
+
+}  // namespace flutter
+
+#endif  // EMBEDDER_FLUTTER_TIZEN_ENGINE_POOL_H_
@@ -0,0 +1,125 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/tizen/flutter_tizen_engine_pool.h"
+
+#include <Ecore.h>
+
+#include <memory>
+
+#include "flutter/shell/platform/embedder/test_utils/proc_table_replacement.h"
+#include "flutter/shell/platform/tizen/testing/engine_modifier.h"
+#include "flutter/shell/platform/tizen/testing/engine_pool_modifier.h"
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+class FlutterTizenEnginePoolTest : public ::testing::Test {
+ public:
+  FlutterTizenEnginePoolTest() { ecore_init(); }
+
+ protected:
+  void SetUp() {
+    FlutterDesktopEngineProperties engine_prop = {};
+    engine_prop.assets_path = "/foo/flutter_assets";
+    engine_prop.icu_data_path = "/foo/icudtl.dat";
+    engine_prop.aot_library_path = "/foo/libapp.so";
+    project_ = std::make_unique<FlutterProjectBundle>(engine_prop);
+  }
+
+  // Mocks the embedder API of every engine created by |pool| and counts the
+  // calls that start an engine.
+  void MockEngines(FlutterTizenEnginePool* pool) {
+    EnginePoolModifier pool_modifier(pool);
+    pool_modifier.SetEngineCreatedCallback([this](FlutterTizenEngine* engine) {
+      EngineModifier modifier(engine);
+      modifier.embedder_api().RunsAOTCompiledDartCode = []() { return false; };
+      modifier.embedder_api().Initialize = MOCK_ENGINE_PROC(
+          Initialize, ([this](size_t version, const FlutterRendererConfig*,
+                              const FlutterProjectArgs*, void*,
+                              FLUTTER_API_SYMBOL(FlutterEngine) * engine_out) {
+            initialize_count_++;
+            *engine_out =
+                reinterpret_cast<FLUTTER_API_SYMBOL(FlutterEngine)>(1);
+            return kSuccess;
+          }));
+      modifier.embedder_api().RunInitialized = MOCK_ENGINE_PROC(
+          RunInitialized, ([this](auto engine) {
+            run_initialized_count_++;
+            return kSuccess;
+          }));
+      modifier.embedder_api().Run = MOCK_ENGINE_PROC(
+          Run, ([this](size_t version, const FlutterRendererConfig*,
+                       const FlutterProjectArgs*, void*,
+                       FLUTTER_API_SYMBOL(FlutterEngine) * engine_out) {
+            run_count_++;
+            *engine_out =
+                reinterpret_cast<FLUTTER_API_SYMBOL(FlutterEngine)>(1);
+            return kSuccess;
+          }));
+      modifier.embedder_api().NotifyDisplayUpdate =
+          [](auto engine, auto update_type, auto displays,
+             auto display_count) { return kSuccess; };
+      modifier.embedder_api().UpdateLocales =
+          [](auto engine, auto locales, auto locales_count) {
+            return kSuccess;
+          };
+      modifier.embedder_api().SendPlatformMessage =
+          [](auto engine, auto message) { return kSuccess; };
+      modifier.embedder_api().Shutdown = [](auto engine) { return kSuccess; };
+    });
+  }
+
+  std::unique_ptr<FlutterProjectBundle> project_;
+  int initialize_count_ = 0;
+  int run_initialized_count_ = 0;
+  int run_count_ = 0;
+};
+
+TEST_F(FlutterTizenEnginePoolTest, AcquireRunsPrewarmedEngine) {
+  FlutterTizenEnginePool pool(*project_, 2);
+  MockEngines(&pool);
+  EnginePoolModifier(&pool).Fill();
+  EXPECT_EQ(pool.available(), 2u);
+  EXPECT_EQ(initialize_count_, 2);
+
+  std::unique_ptr<FlutterTizenEngine> engine = pool.Acquire();
+  ASSERT_NE(engine, nullptr);
+  EXPECT_EQ(pool.available(), 1u);
+
+  EXPECT_TRUE(engine->RunEngine());
+  EXPECT_EQ(run_initialized_count_, 1);
+  EXPECT_EQ(run_count_, 0);
+  EXPECT_FALSE(engine->PrewarmEngine());
+}
+
+TEST_F(FlutterTizenEnginePoolTest, AcquireFromEmptyPoolCreatesEngine) {
+  FlutterTizenEnginePool pool(*project_, 1);
+  MockEngines(&pool);
+  EXPECT_EQ(pool.available(), 0u);
+
+  std::unique_ptr<FlutterTizenEngine> engine = pool.Acquire();
+  ASSERT_NE(engine, nullptr);
+  EXPECT_EQ(initialize_count_, 0);
+
+  EXPECT_TRUE(engine->RunEngine());
+  EXPECT_EQ(run_initialized_count_, 0);
+  EXPECT_EQ(run_count_, 1);
+}
+
+TEST_F(FlutterTizenEnginePoolTest, FillStopsAtPoolSize) {
+  FlutterTizenEnginePool pool(*project_, 3);
+  MockEngines(&pool);
+  EnginePoolModifier(&pool).Fill();
+  EXPECT_EQ(pool.available(), 3u);
+
+  pool.Acquire();
+  EnginePoolModifier(&pool).Fill();
+  EXPECT_EQ(pool.available(), 3u);
+  EXPECT_EQ(initialize_count_, 4);
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -6,23 +6,157 @@
 
 #include <Ecore.h>
 
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
 #include "flutter/shell/platform/embedder/test_utils/proc_table_replacement.h"
+#include "flutter/shell/platform/tizen/flutter_tizen_view.h"
 #include "flutter/shell/platform/tizen/testing/engine_modifier.h"
 #include "gtest/gtest.h"
 
 namespace flutter {
 namespace testing {
 
+namespace {
+
+// A view without a platform window.
+class TestTizenView : public TizenViewBase {
+ public:
+  void* GetRenderTarget() override { return nullptr; }
+
+  void* GetNativeHandle() override { return nullptr; }
+
+  uintptr_t GetWindowId() override { return 0; }
+
+  TizenGeometry GetGeometry() override { return {10, 20, 320, 240}; }
+
+  bool SetGeometry(TizenGeometry geometry) override { return false; }
+
+  int32_t GetDpi() override { return 0; }
+
+  uint32_t GetResourceId() override { return 0; }
+
+  void UpdateFlutterCursor(const std::string& kind) override {}
+
+  void Show() override {}
+};
+
+// A renderer that draws nothing.
+class TestRenderer : public TizenRenderer {
+ public:
+  void ResizeSurface(int32_t width, int32_t height) override {}
+
+  FlutterRendererConfig GetRendererConfig() override { return {}; }
+
+  std::unique_ptr<ExternalTexture> CreateExternalTexture(
+      const FlutterDesktopTextureInfo* texture_info) override {
+    return nullptr;
+  }
+
+ protected:
+  bool CreateSurface(void* render_target,
+                     void* render_target_display,
+                     int32_t width,
+                     int32_t height) override {
+    return true;
+  }
+
+  void DestroySurface() override {}
+};
+
+class TestAccessibilitySettings : public AccessibilitySettings {
+ public:
+  TestAccessibilitySettings(FlutterTizenEngine* engine, bool enabled)
+      : AccessibilitySettings(engine), enabled_(enabled) {}
+
+  bool screen_reader_enabled() const override { return enabled_; }
+
+ private:
+  bool enabled_;
+};
+
+// A semantics update of a root node with a single child.
+class TestSemanticsUpdate {
+ public:
+  explicit TestSemanticsUpdate(int32_t child_id,
+                               FlutterSemanticsFlags child_flags = {})
+      : child_id_(child_id), child_flags_(child_flags) {
+    root_flags_.struct_size = sizeof(FlutterSemanticsFlags);
+    child_flags_.struct_size = sizeof(FlutterSemanticsFlags);
+    nodes_[0] = CreateNode(0, &root_flags_);
+    nodes_[0].child_count = 1;
+    nodes_[0].children_in_traversal_order = &child_id_;
+    nodes_[0].children_in_hit_test_order = &child_id_;
+    nodes_[1] = CreateNode(child_id, &child_flags_);
+    node_pointers_[0] = &nodes_[0];
+    node_pointers_[1] = &nodes_[1];
+    update_.struct_size = sizeof(FlutterSemanticsUpdate2);
+    update_.node_count = 2;
+    update_.nodes = node_pointers_;
+  }
+
+  // Prevent copying, since the update points into this object.
+  TestSemanticsUpdate(TestSemanticsUpdate const&) = delete;
+  TestSemanticsUpdate& operator=(TestSemanticsUpdate const&) = delete;
+
+  const FlutterSemanticsUpdate2* get() const { return &update_; }
+
+ private:
+  static FlutterSemanticsNode2 CreateNode(int32_t id,
+                                          FlutterSemanticsFlags* flags) {
+    FlutterSemanticsNode2 node = {};
+    node.struct_size = sizeof(FlutterSemanticsNode2);
+    node.id = id;
+    node.label = "";
+    node.hint = "";
+    node.value = "";
+    node.increased_value = "";
+    node.decreased_value = "";
+    node.tooltip = "";
+    node.rect = {0, 0, 100, 100};
+    node.transform = {1, 0, 0, 0, 1, 0, 0, 0, 1};
+    node.flags2 = flags;
+    return node;
+  }
+
+  int32_t child_id_;
+  FlutterSemanticsFlags root_flags_ = {};
+  FlutterSemanticsFlags child_flags_;
+  FlutterSemanticsNode2 nodes_[2];
+  FlutterSemanticsNode2* node_pointers_[2];
+  FlutterSemanticsUpdate2 update_ = {};
+};
+
+FlutterSemanticsFlags FocusedFlags() {
+  FlutterSemanticsFlags flags = {};
+  flags.is_focused = kFlutterTristateTrue;
+  return flags;
+}
+
+// The time without queries after which a lazily built tree is released.
+constexpr uint64_t kAccessibilityIdleTimeoutNanos = 60'000'000'000;
+
+}  // namespace
+
 class FlutterTizenEngineTest : public ::testing::Test {
  public:
   FlutterTizenEngineTest() { ecore_init(); }
 
  protected:
-  void SetUp() {
+  void SetUp() { CreateEngine({}); }
+
+  // Replaces |engine_| with an engine created with |switches|.
+  void CreateEngine(std::vector<const char*> switches) {
+    TearDown();
+
     FlutterDesktopEngineProperties engine_prop = {};
     engine_prop.assets_path = "/foo/flutter_assets";
     engine_prop.icu_data_path = "/foo/icudtl.dat";
     engine_prop.aot_library_path = "/foo/libapp.so";
+    engine_prop.switches = switches.data();
+    engine_prop.switches_count = switches.size();
 
     FlutterProjectBundle project(engine_prop);
     auto engine = std::make_unique<FlutterTizenEngine>(project);
@@ -34,6 +168,27 @@ class FlutterTizenEngineTest : public ::testing::Test {
     engine_ = engine.release();
   }
 
+  // Creates an engine in lazy accessibility mode with semantics enabled,
+  // whose clock reads |current_time_|.
+  void EnableLazyAccessibility(bool screen_reader_enabled) {
+    CreateEngine({"--tizen-lazy-accessibility"});
+    EngineModifier modifier(engine_);
+    modifier.embedder_api().UpdateSemanticsEnabled = [](auto engine,
+                                                        bool enabled) {
+      return kSuccess;
+    };
+    modifier.embedder_api().GetCurrentTime = MOCK_ENGINE_PROC(
+        GetCurrentTime, ([this]() { return current_time_; }));
+    modifier.SetAccessibilitySettings(
+        std::make_unique<TestAccessibilitySettings>(engine_,
+                                                    screen_reader_enabled));
+    engine_->SetSemanticsEnabled(true);
+  }
+
+  bool HasAccessibilityTree() {
+    return !engine_->accessibility_bridge().expired();
+  }
+
   void TearDown() {
     if (engine_) {
       delete engine_;
@@ -42,6 +197,7 @@ class FlutterTizenEngineTest : public ::testing::Test {
   }
 
   FlutterTizenEngine* engine_ = nullptr;
+  uint64_t current_time_ = 0;
 };
 
 TEST_F(FlutterTizenEngineTest, RunDoesExpectedInitialization) {
@@ -120,6 +276,44 @@ TEST_F(FlutterTizenEngineTest, RunDoesExpectedInitialization) {
   modifier.embedder_api().Shutdown = [](auto engine) { return kSuccess; };
 }
 
+TEST_F(FlutterTizenEngineTest, RunRecordsStartupTimings) {
+  EngineModifier modifier(engine_);
+  uint64_t current_time = 0;
+  modifier.embedder_api().GetCurrentTime =
+      MOCK_ENGINE_PROC(GetCurrentTime, ([&current_time]() {
+                         current_time += 1000;
+                         return current_time;
+                       }));
+  modifier.embedder_api().Run = MOCK_ENGINE_PROC(
+      Run, ([](size_t version, const FlutterRendererConfig* config,
+               const FlutterProjectArgs* args, void* user_data,
+               FLUTTER_API_SYMBOL(FlutterEngine) * engine_out) {
+        *engine_out = reinterpret_cast<FLUTTER_API_SYMBOL(FlutterEngine)>(1);
+        return kSuccess;
+      }));
+  modifier.embedder_api().NotifyDisplayUpdate =
+      [](auto engine, auto update_type, auto displays, auto display_count) {
+        return kSuccess;
+      };
+  modifier.embedder_api().UpdateLocales = [](auto engine, auto locales,
+                                             auto locales_count) {
+    return kSuccess;
+  };
+  modifier.embedder_api().SendPlatformMessage = [](auto engine, auto message) {
+    return kSuccess;
+  };
+
+  EXPECT_TRUE(engine_->RunEngine());
+
+  // No AOT data is loaded in JIT mode.
+  EXPECT_EQ(engine_->startup_timings().aot_data_load, 0u);
+  EXPECT_EQ(engine_->startup_timings().aot_data_wait, 0u);
+  EXPECT_GT(engine_->startup_timings().engine_run, 0u);
+  EXPECT_GT(engine_->startup_timings().post_run, 0u);
+
+  modifier.embedder_api().Shutdown = [](auto engine) { return kSuccess; };
+}
+
 TEST_F(FlutterTizenEngineTest, SendPlatformMessageWithoutResponse) {
   EngineModifier modifier(engine_);
 
@@ -203,6 +397,29 @@ TEST_F(FlutterTizenEngineTest, SendPlatformMessageWithResponse) {
   EXPECT_TRUE(send_message_called);
 }
 
+TEST_F(FlutterTizenEngineTest, DispatchAccessibilityAction) {
+  EngineModifier modifier(engine_);
+
+  const std::vector<uint8_t> test_data = {1, 2, 3};
+
+  bool called = false;
+  modifier.embedder_api().SendSemanticsAction = MOCK_ENGINE_PROC(
+      SendSemanticsAction, ([&called, test_data](auto engine, auto info) {
+        called = true;
+        EXPECT_EQ(info->view_id, 0);
+        EXPECT_EQ(info->node_id, 42u);
+        EXPECT_EQ(info->action, kFlutterSemanticsActionScrollUp);
+        EXPECT_EQ(info->data_length, test_data.size());
+        EXPECT_EQ(memcmp(info->data, test_data.data(), info->data_length), 0);
+        return kSuccess;
+      }));
+
+  engine_->DispatchAccessibilityAction(
+      0, 42, kFlutterSemanticsActionScrollUp,
+      fml::MallocMapping::Copy(test_data.data(), test_data.size()));
+  EXPECT_TRUE(called);
+}
+
 TEST_F(FlutterTizenEngineTest, AddPluginRegistrarDestructionCallback) {
   EngineModifier modifier(engine_);
   modifier.embedder_api().Run = MOCK_ENGINE_PROC(
@@ -255,5 +472,392 @@ TEST_F(FlutterTizenEngineTest, AddPluginRegistrarDestructionCallback) {
   EXPECT_EQ(result2, 2);
 }
 
+TEST_F(FlutterTizenEngineTest, AddView) {
+  EngineModifier modifier(engine_);
+  FlutterAddViewInfo received_info = {};
+  FlutterWindowMetricsEvent received_metrics = {};
+  modifier.embedder_api().AddView = MOCK_ENGINE_PROC(
+      AddView, ([&received_info, &received_metrics](auto engine, auto info) {
+        received_info = *info;
+        received_metrics = *info->view_metrics;
+        return kSuccess;
+      }));
+
+  FlutterViewId view_id = engine_->AllocateViewId();
+  FlutterTizenView view(view_id, std::make_unique<TestTizenView>(), engine_,
+                        2.0);
+  int callback_count = 0;
+  bool added = false;
+  EXPECT_TRUE(modifier.AddView(&view, std::make_unique<TestRenderer>(),
+                               [&callback_count, &added](bool result) {
+                                 callback_count++;
+                                 added = result;
+                               }));
+  EXPECT_EQ(received_info.view_id, view_id);
+  EXPECT_EQ(received_metrics.view_id, view_id);
+  EXPECT_EQ(received_metrics.left, 10u);
+  EXPECT_EQ(received_metrics.top, 20u);
+  EXPECT_EQ(received_metrics.width, 320u);
+  EXPECT_EQ(received_metrics.height, 240u);
+  EXPECT_EQ(received_metrics.pixel_ratio, 2.0);
+  // The view can be drawn before the engine has finished adding it.
+  EXPECT_EQ(engine_->GetView(view_id), &view);
+  EXPECT_NE(engine_->GetRenderer(view_id), nullptr);
+  EXPECT_EQ(callback_count, 0);
+
+  FlutterAddViewResult result = {};
+  result.struct_size = sizeof(FlutterAddViewResult);
+  result.added = true;
+  result.user_data = received_info.user_data;
+  received_info.add_view_callback(&result);
+  EXPECT_EQ(callback_count, 1);
+  EXPECT_TRUE(added);
+  EXPECT_EQ(engine_->GetView(view_id), &view);
+
+  // A view can't be added twice.
+  EXPECT_FALSE(modifier.AddView(&view, std::make_unique<TestRenderer>(),
+                                nullptr));
+  EXPECT_EQ(engine_->GetView(view_id), &view);
+
+  modifier.embedder_api().RemoveView =
+      MOCK_ENGINE_PROC(RemoveView, ([](auto engine, auto info) {
+                         FlutterRemoveViewResult result = {};
+                         result.struct_size = sizeof(FlutterRemoveViewResult);
+                         result.removed = true;
+                         result.user_data = info->user_data;
+                         info->remove_view_callback(&result);
+                         return kSuccess;
+                       }));
+}
+
+TEST_F(FlutterTizenEngineTest, AddViewFailure) {
+  EngineModifier modifier(engine_);
+  modifier.embedder_api().AddView =
+      MOCK_ENGINE_PROC(AddView, ([](auto engine, auto info) {
+                         FlutterAddViewResult result = {};
+                         result.struct_size = sizeof(FlutterAddViewResult);
+                         result.added = false;
+                         result.user_data = info->user_data;
+                         info->add_view_callback(&result);
+                         return kSuccess;
+                       }));
+
+  FlutterViewId view_id = engine_->AllocateViewId();
+  FlutterTizenView view(view_id, std::make_unique<TestTizenView>(), engine_,
+                        1.0);
+  int callback_count = 0;
+  bool added = true;
+  EXPECT_TRUE(modifier.AddView(&view, std::make_unique<TestRenderer>(),
+                               [&callback_count, &added](bool result) {
+                                 callback_count++;
+                                 added = result;
+                               }));
+  EXPECT_EQ(callback_count, 1);
+  EXPECT_FALSE(added);
+  EXPECT_EQ(engine_->GetView(view_id), nullptr);
+  EXPECT_EQ(engine_->GetRenderer(view_id), nullptr);
+
+  // The callback isn't called if the engine rejects the view right away.
+  modifier.embedder_api().AddView = MOCK_ENGINE_PROC(
+      AddView, ([](auto engine, auto info) { return kInvalidArguments; }));
+  EXPECT_FALSE(modifier.AddView(
+      &view, std::make_unique<TestRenderer>(),
+      [&callback_count](bool result) { callback_count++; }));
+  EXPECT_EQ(callback_count, 1);
+  EXPECT_EQ(engine_->GetView(view_id), nullptr);
+}
+
+TEST_F(FlutterTizenEngineTest, RemoveView) {
+  EngineModifier modifier(engine_);
+  modifier.embedder_api().AddView = MOCK_ENGINE_PROC(
+      AddView, ([](auto engine, auto info) { return kSuccess; }));
+  FlutterRemoveViewInfo received_info = {};
+  modifier.embedder_api().RemoveView = MOCK_ENGINE_PROC(
+      RemoveView, ([&received_info](auto engine, auto info) {
+        received_info = *info;
+        return kSuccess;
+      }));
+
+  FlutterViewId view_id = engine_->AllocateViewId();
+  FlutterTizenView view(view_id, std::make_unique<TestTizenView>(), engine_,
+                        1.0);
+  EXPECT_TRUE(
+      modifier.AddView(&view, std::make_unique<TestRenderer>(), nullptr));
+
+  int callback_count = 0;
+  bool removed = false;
+  EXPECT_TRUE(engine_->RemoveView(view_id,
+                                  [&callback_count, &removed](bool result) {
+                                    callback_count++;
+                                    removed = result;
+                                  }));
+  EXPECT_EQ(received_info.view_id, view_id);
+  // The renderer is destroyed right away, so that frames still in flight are
+  // dropped.
+  EXPECT_EQ(engine_->GetView(view_id), nullptr);
+  EXPECT_EQ(engine_->GetRenderer(view_id), nullptr);
+  EXPECT_EQ(callback_count, 0);
+
+  FlutterRemoveViewResult result = {};
+  result.struct_size = sizeof(FlutterRemoveViewResult);
+  result.removed = true;
+  result.user_data = received_info.user_data;
+  received_info.remove_view_callback(&result);
+  EXPECT_EQ(callback_count, 1);
+  EXPECT_TRUE(removed);
+
+  // The view has already been removed.
+  EXPECT_FALSE(engine_->RemoveView(
+      view_id, [&callback_count](bool result) { callback_count++; }));
+  EXPECT_EQ(callback_count, 1);
+}
+
+TEST_F(FlutterTizenEngineTest, RemoveViewFailure) {
+  EngineModifier modifier(engine_);
+  modifier.embedder_api().AddView = MOCK_ENGINE_PROC(
+      AddView, ([](auto engine, auto info) { return kSuccess; }));
+  modifier.embedder_api().RemoveView = MOCK_ENGINE_PROC(
+      RemoveView, ([](auto engine, auto info) { return kInvalidArguments; }));
+
+  FlutterViewId view_id = engine_->AllocateViewId();
+  FlutterTizenView view(view_id, std::make_unique<TestTizenView>(), engine_,
+                        1.0);
+  EXPECT_TRUE(
+      modifier.AddView(&view, std::make_unique<TestRenderer>(), nullptr));
+
+  int callback_count = 0;
+  bool removed = true;
+  EXPECT_TRUE(engine_->RemoveView(view_id,
+                                  [&callback_count, &removed](bool result) {
+                                    callback_count++;
+                                    removed = result;
+                                  }));
+  EXPECT_EQ(callback_count, 1);
+  EXPECT_FALSE(removed);
+  EXPECT_EQ(engine_->GetView(view_id), nullptr);
+}
+
+TEST_F(FlutterTizenEngineTest, SendViewFocusEvent) {
+  EngineModifier modifier(engine_);
+  std::vector<FlutterViewFocusEvent> events;
+  modifier.embedder_api().SendViewFocusEvent = MOCK_ENGINE_PROC(
+      SendViewFocusEvent, ([&events](auto engine, auto event) {
+        events.push_back(*event);
+        return kSuccess;
+      }));
+
+  engine_->SendViewFocusEvent(1, true);
+  engine_->SendViewFocusEvent(2, false);
+
+  ASSERT_EQ(events.size(), 2u);
+  EXPECT_EQ(events[0].struct_size, sizeof(FlutterViewFocusEvent));
+  EXPECT_EQ(events[0].view_id, 1);
+  EXPECT_EQ(events[0].state, FlutterViewFocusState::kFocused);
+  EXPECT_EQ(events[0].direction, FlutterViewFocusDirection::kUndefined);
+  EXPECT_EQ(events[1].view_id, 2);
+  EXPECT_EQ(events[1].state, FlutterViewFocusState::kUnfocused);
+  EXPECT_EQ(events[1].direction, FlutterViewFocusDirection::kUndefined);
+}
+
+TEST_F(FlutterTizenEngineTest, LazyAccessibilityBuildsTreeOnQuery) {
+  EnableLazyAccessibility(false);
+  EngineModifier modifier(engine_);
+
+  TestSemanticsUpdate update(1);
+  modifier.UpdateSemantics(update.get());
+  EXPECT_FALSE(HasAccessibilityTree());
+
+  // The tree is built from the buffered updates.
+  modifier.QueryAccessibility();
+  ASSERT_TRUE(HasAccessibilityTree());
+  EXPECT_FALSE(engine_->accessibility_bridge()
+                   .lock()
+                   ->GetFlutterPlatformNodeDelegateFromID(1)
+                   .expired());
+}
+
+TEST_F(FlutterTizenEngineTest, LazyAccessibilityReleasesIdleTree) {
+  EnableLazyAccessibility(false);
+  EngineModifier modifier(engine_);
+
+  TestSemanticsUpdate update(1);
+  modifier.UpdateSemantics(update.get());
+  modifier.QueryAccessibility();
+  ASSERT_TRUE(HasAccessibilityTree());
+
+  current_time_ += kAccessibilityIdleTimeoutNanos;
+  modifier.UpdateSemantics(update.get());
+  EXPECT_TRUE(HasAccessibilityTree());
+
+  current_time_ += 1;
+  modifier.UpdateSemantics(update.get());
+  EXPECT_FALSE(HasAccessibilityTree());
+
+  // The next query rebuilds the tree.
+  modifier.QueryAccessibility();
+  EXPECT_TRUE(HasAccessibilityTree());
+}
+
+TEST_F(FlutterTizenEngineTest, LazyAccessibilityKeepsTreeForScreenReader) {
+  EnableLazyAccessibility(true);
+  EngineModifier modifier(engine_);
+
+  TestSemanticsUpdate update(1);
+  modifier.UpdateSemantics(update.get());
+  modifier.QueryAccessibility();
+  ASSERT_TRUE(HasAccessibilityTree());
+
+  current_time_ += kAccessibilityIdleTimeoutNanos + 1;
+  modifier.UpdateSemantics(update.get());
+  EXPECT_TRUE(HasAccessibilityTree());
+}
+
+TEST_F(FlutterTizenEngineTest, LazyAccessibilityBuildsTreeOnFocusChange) {
+  EnableLazyAccessibility(false);
+  EngineModifier modifier(engine_);
+
+  // Focus changes are tracked while the screen reader is off.
+  TestSemanticsUpdate focused(1, FocusedFlags());
+  modifier.UpdateSemantics(focused.get());
+  EXPECT_FALSE(HasAccessibilityTree());
+
+  modifier.SetAccessibilitySettings(
+      std::make_unique<TestAccessibilitySettings>(engine_, true));
+
+  // A live region change alone doesn't build the tree.
+  FlutterSemanticsFlags live_region_flags = {};
+  live_region_flags.is_live_region = true;
+  TestSemanticsUpdate live_region(2, live_region_flags);
+  modifier.UpdateSemantics(live_region.get());
+  EXPECT_FALSE(HasAccessibilityTree());
+
+  // The focused node is unchanged.
+  modifier.UpdateSemantics(focused.get());
+  EXPECT_FALSE(HasAccessibilityTree());
+
+  TestSemanticsUpdate focus_moved(3, FocusedFlags());
+  modifier.UpdateSemantics(focus_moved.get());
+  ASSERT_TRUE(HasAccessibilityTree());
+  EXPECT_FALSE(engine_->accessibility_bridge()
+                   .lock()
+                   ->GetFlutterPlatformNodeDelegateFromID(3)
+                   .expired());
+}
+
+TEST_F(FlutterTizenEngineTest, AccessibilityLocationEventsAreOptIn) {
+  constexpr auto kLocationChanged =
+      ui::AXEventGenerator::Event::LOCATION_CHANGED;
+  for (bool location_events : {false, true}) {
+    if (location_events) {
+      CreateEngine({"--tizen-accessibility-location-events"});
+    }
+    EngineModifier modifier(engine_);
+    modifier.embedder_api().UpdateSemanticsEnabled = [](auto engine,
+                                                        bool enabled) {
+      return kSuccess;
+    };
+    engine_->SetSemanticsEnabled(true);
+
+    std::shared_ptr<AccessibilityBridge> bridge =
+        engine_->accessibility_bridge().lock();
+    ASSERT_TRUE(bridge);
+    EXPECT_EQ(bridge->IsEventEnabled(kLocationChanged), location_events);
+    EXPECT_TRUE(
+        bridge->IsEventEnabled(ui::AXEventGenerator::Event::FOCUS_CHANGED));
+  }
+}
+
+// Measures the time to commit a semantics update of a list whose rows have
+// three labeled cells, both for the initial update and for resending all the
+// nodes. Run with --gtest_also_run_disabled_tests on a target device.
+TEST_F(FlutterTizenEngineTest, DISABLED_SemanticsUpdateBenchmark) {
+  EngineModifier modifier(engine_);
+  modifier.embedder_api().UpdateSemanticsEnabled = [](auto engine,
+                                                      bool enabled) {
+    return kSuccess;
+  };
+  engine_->SetSemanticsEnabled(true);
+
+  for (size_t node_count : {1000, 10000, 50000}) {
+    size_t row_count = (node_count - 1) / 4;
+    std::vector<std::string> labels;
+    std::vector<std::vector<int32_t>> children(row_count + 1);
+    FlutterSemanticsFlags flags = {};
+    flags.struct_size = sizeof(FlutterSemanticsFlags);
+    std::vector<FlutterSemanticsNode2> nodes;
+    labels.reserve(row_count * 4 + 1);
+    nodes.reserve(row_count * 4 + 1);
+
+    auto add_node = [&](int32_t id, FlutterRect rect, double offset_y,
+                        const std::vector<int32_t>* child_ids) {
+      FlutterSemanticsNode2 node = {};
+      node.struct_size = sizeof(FlutterSemanticsNode2);
+      node.id = id;
+      labels.push_back("Node " + std::to_string(id));
+      node.label = labels.back().c_str();
+      node.hint = "";
+      node.value = "";
+      node.increased_value = "";
+      node.decreased_value = "";
+      node.tooltip = "";
+      node.rect = rect;
+      node.transform = {1, 0, 0, 0, 1, offset_y, 0, 0, 1};
+      if (child_ids) {
+        node.child_count = child_ids->size();
+        node.children_in_traversal_order = child_ids->data();
+        node.children_in_hit_test_order = child_ids->data();
+      }
+      node.flags2 = &flags;
+      nodes.push_back(node);
+    };
+
+    int32_t next_id = 1;
+    for (size_t row = 1; row <= row_count; row++) {
+      children[0].push_back(next_id++);
+      for (int cell = 0; cell < 3; cell++) {
+        children[row].push_back(next_id++);
+      }
+    }
+    add_node(0, {0, 0, 1920, 1080}, 0, &children[0]);
+    for (size_t row = 1; row <= row_count; row++) {
+      add_node(children[0][row - 1], {0, 0, 1920, 80}, 80.0 * row,
+               &children[row]);
+      for (int cell = 0; cell < 3; cell++) {
+        double left = 640.0 * cell;
+        add_node(children[row][cell], {left, 0, left + 640, 80}, 0, nullptr);
+      }
+    }
+
+    std::vector<FlutterSemanticsNode2*> node_pointers;
+    for (FlutterSemanticsNode2& node : nodes) {
+      node_pointers.push_back(&node);
+    }
+    FlutterSemanticsUpdate2 update = {};
+    update.struct_size = sizeof(FlutterSemanticsUpdate2);
+    update.node_count = node_pointers.size();
+    update.nodes = node_pointers.data();
+
+    auto measure = [&modifier, &update]() {
+      auto start = std::chrono::steady_clock::now();
+      modifier.UpdateSemantics(&update);
+      return std::chrono::duration_cast<std::chrono::microseconds>(
+                 std::chrono::steady_clock::now() - start)
+          .count();
+    };
+    int64_t initial = measure();
+    int64_t resend = measure();
+    size_t skipped =
+        engine_->accessibility_bridge().lock()->skipped_node_update_count();
+
+    std::cout << nodes.size() << " nodes: initial " << initial
+              << " us, resend " << resend << " us (" << skipped
+              << " unchanged nodes skipped)" << std::endl;
+
+    // Starts over with an empty tree.
+    engine_->SetSemanticsEnabled(false);
+    engine_->SetSemanticsEnabled(true);
+  }
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -4,8 +4,10 @@
 
 #include "flutter_tizen_texture_registrar.h"
 
+#include <chrono>
 #include <iostream>
 #include <mutex>
+#include <utility>
 
 #include "flutter/shell/platform/tizen/external_texture_pixel_egl.h"
 #include "flutter/shell/platform/tizen/external_texture_pixel_egl_impeller.h"
@@ -16,16 +18,31 @@
 #include "flutter/shell/platform/tizen/flutter_tizen_engine.h"
 #include "flutter/shell/platform/tizen/logger.h"
 #include "flutter/shell/platform/tizen/tizen_renderer_evas_gl.h"
+#include "flutter/shell/platform/tizen/tracer.h"
 
 namespace flutter {
 
+namespace {
+
+// Textures that haven't been populated for this long are considered idle.
+constexpr std::chrono::seconds kIdleTextureTimeout(1);
+
+int64_t GetSteadyTimeNanos() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+}  // namespace
+
 FlutterTizenTextureRegistrar::FlutterTizenTextureRegistrar(
     FlutterTizenEngine* engine)
-    : engine_(engine) {}
+    : engine_(engine), textures_(std::make_shared<TextureMap>()) {}
 
 int64_t FlutterTizenTextureRegistrar::RegisterTexture(
     const FlutterDesktopTextureInfo* texture_info) {
   if (texture_info->type != kFlutterDesktopPixelBufferTexture &&
+      texture_info->type != kFlutterDesktopPixelBufferDescriptorTexture &&
       texture_info->type != kFlutterDesktopGpuSurfaceTexture) {
     FT_LOG(Error) << "Attempted to register texture of unsupported type.";
     return -1;
@@ -38,6 +55,13 @@ int64_t FlutterTizenTextureRegistrar::RegisterTexture(
     }
   }
 
+  if (texture_info->type == kFlutterDesktopPixelBufferDescriptorTexture) {
+    if (!texture_info->pixel_buffer_descriptor_config.callback) {
+      FT_LOG(Error) << "Invalid pixel buffer descriptor texture callback.";
+      return -1;
+    }
+  }
+
   if (texture_info->type == kFlutterDesktopGpuSurfaceTexture) {
     if (!texture_info->gpu_surface_config.callback) {
       FT_LOG(Error) << "Invalid GPU surface texture callback.";
@@ -62,10 +86,14 @@ int64_t FlutterTizenTextureRegistrar::RegisterTexture(
     return -1;
   }
   int64_t texture_id = texture_gl->TextureId();
+  auto entry = std::make_shared<TextureEntry>();
+  entry->texture = std::move(texture_gl);
 
   {
-    std::lock_guard<std::mutex> lock(map_mutex_);
-    textures_[texture_id] = std::move(texture_gl);
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    auto textures = std::make_shared<TextureMap>(*textures_);
+    (*textures)[texture_id] = std::move(entry);
+    StoreTextures(std::move(textures));
   }
 
   engine_->RegisterExternalTexture(texture_id);
@@ -73,20 +101,39 @@ int64_t FlutterTizenTextureRegistrar::RegisterTexture(
 }
 
 bool FlutterTizenTextureRegistrar::UnregisterTexture(int64_t texture_id) {
+  std::shared_ptr<TextureEntry> texture;
   {
-    std::lock_guard<std::mutex> lock(map_mutex_);
-    auto iter = textures_.find(texture_id);
-    if (iter == textures_.end()) {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    auto iter = textures_->find(texture_id);
+    if (iter == textures_->end()) {
       return false;
     }
-    textures_.erase(iter);
+    texture = iter->second;
+    auto textures = std::make_shared<TextureMap>(*textures_);
+    textures->erase(texture_id);
+    StoreTextures(std::move(textures));
   }
-  return engine_->UnregisterExternalTexture(texture_id);
+  bool result = engine_->UnregisterExternalTexture(texture_id);
+  ReleaseTexture(std::move(texture));
+  return result;
 }
 
 bool FlutterTizenTextureRegistrar::MarkTextureFrameAvailable(
     int64_t texture_id) {
-  return engine_->MarkExternalTextureFrameAvailable(texture_id);
+  std::shared_ptr<TextureEntry> texture = FindTexture(texture_id);
+  if (!texture) {
+    return false;
+  }
+  texture->frame_available_count++;
+  if (texture->frame_pending.exchange(true)) {
+    texture->dropped_frame_count++;
+    return true;
+  }
+  if (!engine_->MarkExternalTextureFrameAvailable(texture_id)) {
+    texture->frame_pending = false;
+    return false;
+  }
+  return true;
 }
 
 bool FlutterTizenTextureRegistrar::PopulateTexture(
@@ -94,16 +141,116 @@ bool FlutterTizenTextureRegistrar::PopulateTexture(
     size_t width,
     size_t height,
     FlutterOpenGLTexture* opengl_texture) {
-  ExternalTexture* texture;
-  {
-    std::lock_guard<std::mutex> lock(map_mutex_);
-    auto iter = textures_.find(texture_id);
-    if (iter == textures_.end()) {
-      return false;
+  FT_TRACE_SCOPE("FlutterTizenTextureRegistrar::PopulateTexture");
+
+  // Hold a reference so that the texture is not destroyed while being
+  // populated, even if it is unregistered concurrently.
+  std::shared_ptr<TextureEntry> texture = FindTexture(texture_id);
+  if (!texture) {
+    return false;
+  }
+  // Frames marked available from now on need a new notification.
+  texture->frame_pending = false;
+  texture->populated_frame_count++;
+  texture->last_populated_time = GetSteadyTimeNanos();
+  return texture->texture->PopulateTexture(width, height, opengl_texture);
+}
+
+bool FlutterTizenTextureRegistrar::GetFrameStatistics(
+    int64_t texture_id,
+    FlutterDesktopTextureFrameStatistics* statistics) {
+  std::shared_ptr<TextureEntry> texture = FindTexture(texture_id);
+  if (!texture) {
+    return false;
+  }
+  statistics->frame_available_count = texture->frame_available_count;
+  statistics->dropped_frame_count = texture->dropped_frame_count;
+  statistics->populated_frame_count = texture->populated_frame_count;
+  return true;
+}
+
+void FlutterTizenTextureRegistrar::TrimMemory(
+    MemoryPressureLevel level,
+    std::function<void(size_t bytes)> on_released) {
+  struct TrimTask {
+    std::shared_ptr<const TextureMap> textures;
+    bool critical;
+    std::function<void(size_t bytes)> on_released;
+  };
+  auto* task = new TrimTask{LoadTextures(),
+                            level == MemoryPressureLevel::kCritical,
+                            std::move(on_released)};
+  bool posted = engine_->PostRenderThreadTask(
+      [](void* user_data) {
+        std::unique_ptr<TrimTask> task(static_cast<TrimTask*>(user_data));
+        int64_t idle_before =
+            GetSteadyTimeNanos() -
+            std::chrono::nanoseconds(kIdleTextureTimeout).count();
+        size_t released = 0;
+        for (const auto& [texture_id, entry] : *task->textures) {
+          bool idle = entry->last_populated_time < idle_before;
+          if (idle || task->critical) {
+            released += entry->texture->ReleaseCachedMemory();
+          }
+        }
+        if (task->on_released) {
+          task->on_released(released);
+        }
+      },
+      task);
+  if (!posted) {
+    // The engine is not running, so no texture has been populated.
+    delete task;
+  }
+}
+
+std::shared_ptr<FlutterTizenTextureRegistrar::TextureEntry>
+FlutterTizenTextureRegistrar::FindTexture(int64_t texture_id) const {
+  std::shared_ptr<const TextureMap> textures = LoadTextures();
+  auto iter = textures->find(texture_id);
+  if (iter == textures->end()) {
+    return nullptr;
+  }
+  return iter->second;
+}
+
+void FlutterTizenTextureRegistrar::ReleaseTexture(
+    std::shared_ptr<TextureEntry> texture) {
+  auto* baton = new std::shared_ptr<TextureEntry>(std::move(texture));
+  bool posted = engine_->PostRenderThreadTask(
+      [](void* user_data) {
+        delete static_cast<std::shared_ptr<TextureEntry>*>(user_data);
+      },
+      baton);
+  if (!posted) {
+    if ((*baton)->populated_frame_count == 0) {
+      // The texture has never been populated, so it owns no GL objects and
+      // can be released on this thread.
+      delete baton;
+    } else {
+      // The GL objects of the texture can only be deleted where the render
+      // context is current. Leaking them is safer than deleting them here.
+      FT_LOG(Warn) << "Leaking texture " << (*baton)->texture->TextureId()
+                   << ": no render thread to release it on.";
     }
-    texture = iter->second.get();
   }
-  return texture->PopulateTexture(width, height, opengl_texture);
+}
+
+std::shared_ptr<const FlutterTizenTextureRegistrar::TextureMap>
+FlutterTizenTextureRegistrar::LoadTextures() const {
+  std::lock_guard<std::mutex> lock(snapshot_mutex_);
+  return textures_;
+}
+
+void FlutterTizenTextureRegistrar::StoreTextures(
+    std::shared_ptr<const TextureMap> textures) {
+  std::shared_ptr<const TextureMap> old_textures;
+  {
+    std::lock_guard<std::mutex> lock(snapshot_mutex_);
+    old_textures = std::exchange(textures_, std::move(textures));
+  }
+  // |old_textures| may be the last reference to the previous snapshot, which
+  // is destroyed here outside of |snapshot_mutex_|.
 }
 
 }  // namespace flutter
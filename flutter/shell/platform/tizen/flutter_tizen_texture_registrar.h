@@ -5,11 +5,14 @@
 #ifndef EMBEDDER_FLUTTER_TIZEN_TEXTURE_REGISTRAR_H_
 #define EMBEDDER_FLUTTER_TIZEN_TEXTURE_REGISTRAR_H_
 
+#include <atomic>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
 
 #include "flutter/shell/platform/tizen/external_texture.h"
+#include "flutter/shell/platform/tizen/memory_pressure_monitor.h"
 #include "flutter/shell/platform/tizen/public/flutter_tizen.h"
 
 namespace flutter {
@@ -34,6 +37,10 @@ class FlutterTizenTextureRegistrar {
 
   // Notifies the engine about a new frame being available.
   //
+  // Notifications are coalesced: if the engine has not yet populated the
+  // texture since the last notification, the engine already has a frame
+  // scheduled for it and the new frame supersedes the pending one.
+  //
   // Returns true on success.
   bool MarkTextureFrameAvailable(int64_t texture_id);
 
@@ -46,12 +53,73 @@ class FlutterTizenTextureRegistrar {
                        size_t height,
                        FlutterOpenGLTexture* texture);
 
+  // Copies the frame counters of the texture identified by |texture_id| into
+  // |statistics|.
+  //
+  // Returns false if no such texture is registered.
+  bool GetFrameStatistics(int64_t texture_id,
+                          FlutterDesktopTextureFrameStatistics* statistics);
+
+  // Releases the scratch buffers of textures that haven't been populated for
+  // a while, and at critical |level| also those of all other textures. GL
+  // textures are kept, since a texture that is not being populated may still
+  // be on screen.
+  //
+  // The memory is released asynchronously on the render thread, where
+  // |on_released| is called with the number of bytes released.
+  void TrimMemory(MemoryPressureLevel level,
+                  std::function<void(size_t bytes)> on_released);
+
  private:
+  // A registered texture and its frame notification state.
+  struct TextureEntry {
+    std::unique_ptr<ExternalTexture> texture;
+
+    // Whether the engine has been notified of a frame that it hasn't
+    // populated yet.
+    std::atomic<bool> frame_pending = false;
+
+    std::atomic<uint64_t> frame_available_count = 0;
+    std::atomic<uint64_t> dropped_frame_count = 0;
+    std::atomic<uint64_t> populated_frame_count = 0;
+
+    // The steady clock time of the last PopulateTexture call in nanoseconds.
+    std::atomic<int64_t> last_populated_time = 0;
+  };
+
+  using TextureMap =
+      std::unordered_map<int64_t, std::shared_ptr<TextureEntry>>;
+
+  // Returns the texture identified by |texture_id| in the current snapshot,
+  // or nullptr if no such texture is registered.
+  std::shared_ptr<TextureEntry> FindTexture(int64_t texture_id) const;
+
+  // Releases |texture| on the render thread, where its GL objects can be
+  // deleted. The texture may outlive this call if it is being populated.
+  void ReleaseTexture(std::shared_ptr<TextureEntry> texture);
+
   FlutterTizenEngine* engine_ = nullptr;
 
-  // All registered textures, keyed by their IDs.
-  std::unordered_map<int64_t, std::unique_ptr<ExternalTexture>> textures_;
-  std::mutex map_mutex_;
+  // Returns the current snapshot of |textures_|.
+  std::shared_ptr<const TextureMap> LoadTextures() const;
+
+  // Replaces the current snapshot of |textures_|. Must be called with
+  // |write_mutex_| held.
+  void StoreTextures(std::shared_ptr<const TextureMap> textures);
+
+  // An immutable snapshot of all registered textures, keyed by their IDs.
+  //
+  // Lookups on the render thread only hold |snapshot_mutex_| long enough to
+  // copy the snapshot pointer, and keep the texture alive while populating
+  // it. Writers replace the snapshot with a modified copy, so the render
+  // thread never waits for a map to be copied.
+  std::shared_ptr<const TextureMap> textures_;
+
+  // Guards the |textures_| pointer itself.
+  mutable std::mutex snapshot_mutex_;
+
+  // Serializes writers of |textures_|.
+  std::mutex write_mutex_;
 };
 
 }  // namespace flutter
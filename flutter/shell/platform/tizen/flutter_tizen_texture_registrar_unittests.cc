@@ -6,7 +6,10 @@
 
 #include <Ecore.h>
 
+#include <atomic>
 #include <iostream>
+#include <thread>
+#include <vector>
 
 #include "flutter/shell/platform/embedder/test_utils/proc_table_replacement.h"
 #include "flutter/shell/platform/tizen/flutter_tizen_engine.h"
@@ -122,5 +125,123 @@ TEST_F(FlutterTizenTextureRegistrarTest, PopulateInvalidTexture) {
   EXPECT_FALSE(result);
 }
 
+TEST_F(FlutterTizenTextureRegistrarTest, CoalesceFrameAvailableNotifications) {
+  EngineModifier modifier(engine_);
+  modifier.embedder_api().RegisterExternalTexture =
+      [](auto engine, auto texture_id) { return kSuccess; };
+  modifier.embedder_api().UnregisterExternalTexture =
+      [](auto engine, auto texture_id) { return kSuccess; };
+  int mark_frame_available_calls = 0;
+  modifier.embedder_api().MarkExternalTextureFrameAvailable = MOCK_ENGINE_PROC(
+      MarkExternalTextureFrameAvailable,
+      ([&mark_frame_available_calls](auto engine, auto texture_id) {
+        mark_frame_available_calls++;
+        return kSuccess;
+      }));
+  // The populated texture can only be released on the render thread.
+  modifier.embedder_api().PostRenderThreadTask =
+      [](auto engine, VoidCallback callback, void* user_data) {
+        callback(user_data);
+        return kSuccess;
+      };
+
+  FlutterTizenTextureRegistrar registrar(engine_);
+
+  FlutterDesktopTextureInfo texture_info = {};
+  texture_info.type = kFlutterDesktopGpuSurfaceTexture;
+  texture_info.gpu_surface_config.callback =
+      [](size_t width, size_t height,
+         void* user_data) -> const FlutterDesktopGpuSurfaceDescriptor* {
+    return nullptr;
+  };
+  int64_t texture_id = registrar.RegisterTexture(&texture_info);
+  ASSERT_NE(texture_id, -1);
+
+  // Only the first of several notifications within a frame reaches the
+  // engine.
+  for (int i = 0; i < 3; i++) {
+    EXPECT_TRUE(registrar.MarkTextureFrameAvailable(texture_id));
+  }
+  EXPECT_EQ(mark_frame_available_calls, 1);
+
+  // Once the engine has populated the texture, the engine is notified again.
+  FlutterOpenGLTexture texture = {};
+  registrar.PopulateTexture(texture_id, 640, 480, &texture);
+  EXPECT_TRUE(registrar.MarkTextureFrameAvailable(texture_id));
+  EXPECT_EQ(mark_frame_available_calls, 2);
+
+  FlutterDesktopTextureFrameStatistics statistics = {};
+  ASSERT_TRUE(registrar.GetFrameStatistics(texture_id, &statistics));
+  EXPECT_EQ(statistics.frame_available_count, 4u);
+  EXPECT_EQ(statistics.dropped_frame_count, 2u);
+  EXPECT_EQ(statistics.populated_frame_count, 1u);
+
+  EXPECT_TRUE(registrar.UnregisterTexture(texture_id));
+  EXPECT_FALSE(registrar.MarkTextureFrameAvailable(texture_id));
+  EXPECT_FALSE(registrar.GetFrameStatistics(texture_id, &statistics));
+}
+
+TEST_F(FlutterTizenTextureRegistrarTest, ConcurrentRegisterAndPopulate) {
+  constexpr int kIterations = 2000;
+  constexpr int kPopulateThreads = 3;
+
+  EngineModifier modifier(engine_);
+  modifier.embedder_api().RegisterExternalTexture =
+      [](auto engine, auto texture_id) { return kSuccess; };
+  modifier.embedder_api().UnregisterExternalTexture =
+      [](auto engine, auto texture_id) { return kSuccess; };
+
+  // Run render thread tasks inline.
+  static std::atomic<int> render_thread_tasks;
+  render_thread_tasks = 0;
+  modifier.embedder_api().PostRenderThreadTask =
+      [](auto engine, VoidCallback callback, void* user_data) {
+        render_thread_tasks++;
+        callback(user_data);
+        return kSuccess;
+      };
+
+  FlutterTizenTextureRegistrar registrar(engine_);
+
+  std::atomic<int> populate_calls = 0;
+  FlutterDesktopTextureInfo texture_info = {};
+  texture_info.type = kFlutterDesktopGpuSurfaceTexture;
+  texture_info.gpu_surface_config.user_data = &populate_calls;
+  texture_info.gpu_surface_config.callback =
+      [](size_t width, size_t height,
+         void* user_data) -> const FlutterDesktopGpuSurfaceDescriptor* {
+    (*static_cast<std::atomic<int>*>(user_data))++;
+    return nullptr;
+  };
+
+  std::atomic<int64_t> latest_texture_id = -1;
+  std::atomic<bool> done = false;
+  std::vector<std::thread> populate_threads;
+  for (int i = 0; i < kPopulateThreads; i++) {
+    populate_threads.emplace_back([&registrar, &latest_texture_id, &done]() {
+      while (!done) {
+        FlutterOpenGLTexture texture = {};
+        registrar.PopulateTexture(latest_texture_id, 640, 480, &texture);
+      }
+    });
+  }
+
+  for (int i = 0; i < kIterations; i++) {
+    int64_t texture_id = registrar.RegisterTexture(&texture_info);
+    ASSERT_NE(texture_id, -1);
+    latest_texture_id = texture_id;
+    std::this_thread::yield();
+    EXPECT_TRUE(registrar.UnregisterTexture(texture_id));
+  }
+  done = true;
+  for (std::thread& thread : populate_threads) {
+    thread.join();
+  }
+
+  // Every unregistered texture was released on the render thread.
+  EXPECT_EQ(render_thread_tasks, kIterations);
+  EXPECT_FALSE(registrar.PopulateTexture(latest_texture_id, 640, 480, nullptr));
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -49,7 +49,8 @@ FlutterTizenView::FlutterTizenView(FlutterViewId view_id,
                                    double user_pixel_ratio)
     : view_id_(view_id),
       tizen_view_(std::move(tizen_view)),
-      engine_(std::move(engine)),
+      owned_engine_(std::move(engine)),
+      engine_(owned_engine_.get()),
       user_pixel_ratio_(user_pixel_ratio) {
   tizen_view_->SetView(this);
   engine_->SetView(this, renderer_type);
@@ -60,12 +61,32 @@ FlutterTizenView::FlutterTizenView(FlutterViewId view_id,
   }
 }
 
+FlutterTizenView::FlutterTizenView(FlutterViewId view_id,
+                                   std::unique_ptr<TizenViewBase> tizen_view,
+                                   FlutterTizenEngine* engine,
+                                   double user_pixel_ratio)
+    : view_id_(view_id),
+      tizen_view_(std::move(tizen_view)),
+      engine_(engine),
+      user_pixel_ratio_(user_pixel_ratio) {
+  tizen_view_->SetView(this);
+
+  if (auto* window = dynamic_cast<TizenWindow*>(tizen_view_.get())) {
+    window->BindKeys(kBindableSystemKeys);
+  }
+}
+
 FlutterTizenView::~FlutterTizenView() {
-  if (engine_) {
+  if (resize_animator_) {
+    ecore_animator_del(resize_animator_);
+  }
+  if (owned_engine_) {
     if (platform_view_channel_) {
       platform_view_channel_->Dispose();
     }
-    engine_->StopEngine();
+    owned_engine_->StopEngine();
+  } else if (engine_) {
+    engine_->RemoveView(view_id_);
   }
 }
 
@@ -81,14 +102,8 @@ void FlutterTizenView::SetupChannels() {
   platform_channel_ =
       std::make_unique<PlatformChannel>(messenger, tizen_view_.get());
 
-  double pixel_ratio;
-  if (user_pixel_ratio_ == 0.0) {
-    pixel_ratio = ComputePixelRatio(tizen_view_->GetDpi());
-  } else {
-    pixel_ratio = user_pixel_ratio_;
-  }
   platform_view_channel_ =
-      std::make_unique<PlatformViewChannel>(messenger, pixel_ratio);
+      std::make_unique<PlatformViewChannel>(messenger, GetPixelRatio());
   mouse_cursor_channel_ =
       std::make_unique<MouseCursorChannel>(messenger, tizen_view_.get());
   text_input_channel_ = std::make_unique<TextInputChannel>(
@@ -98,6 +113,18 @@ void FlutterTizenView::SetupChannels() {
   input_device_channel_ = std::make_unique<InputDeviceChannel>(messenger);
 }
 
+void FlutterTizenView::DetachEngine() {
+  FT_ASSERT(!owned_engine_);
+  engine_ = nullptr;
+}
+
+double FlutterTizenView::GetPixelRatio() {
+  if (user_pixel_ratio_ == 0.0) {
+    return ComputePixelRatio(tizen_view_->GetDpi());
+  }
+  return user_pixel_ratio_;
+}
+
 void FlutterTizenView::Resize(int32_t width, int32_t height) {
   TizenGeometry geometry = tizen_view_->GetGeometry();
   geometry.width = width;
@@ -109,20 +136,43 @@ void FlutterTizenView::OnResize(int32_t left,
                                 int32_t top,
                                 int32_t width,
                                 int32_t height) {
-  if (rotation_degree_ == 90 || rotation_degree_ == 270) {
-    std::swap(width, height);
-  }
+  resize_coordinator_.RequestResize({left, top, width, height});
+}
 
-  engine_->renderer()->ResizeSurface(width, height);
+void FlutterTizenView::OnRotate(int32_t degree) {
+  // The window acknowledges the rotation to the window manager as soon as this
+  // returns, so the rotated geometry is applied right away rather than on the
+  // next frame.
+  if (resize_animator_) {
+    ecore_animator_del(resize_animator_);
+    resize_animator_ = nullptr;
+  }
+  resize_coordinator_.RequestRotation(degree, tizen_view_->GetGeometry());
+  resize_coordinator_.Flush();
+}
 
-  SendWindowMetrics(left, top, width, height, 0.0);
+void FlutterTizenView::ScheduleResizeFlush() {
+  if (resize_animator_) {
+    return;
+  }
+  // Animators run once per frame, in sync with the display.
+  resize_animator_ = ecore_animator_add(
+      [](void* data) -> Eina_Bool {
+        auto* self = static_cast<FlutterTizenView*>(data);
+        self->resize_animator_ = nullptr;
+        self->resize_coordinator_.Flush();
+        return ECORE_CALLBACK_CANCEL;
+      },
+      this);
 }
 
-void FlutterTizenView::OnRotate(int32_t degree) {
-  TizenGeometry geometry = tizen_view_->GetGeometry();
+void FlutterTizenView::ApplyGeometry(const TizenGeometry& geometry,
+                                     int32_t degree,
+                                     int32_t* frame_width,
+                                     int32_t* frame_height) {
   int32_t width = geometry.width;
   int32_t height = geometry.height;
-  if (dynamic_cast<TizenRendererEgl*>(engine_->renderer())) {
+  if (dynamic_cast<TizenRendererEgl*>(renderer())) {
     rotation_degree_ = degree;
     // Compute renderer transformation based on the angle of rotation.
     double rad = (360 - rotation_degree_) * M_PI / 180;
@@ -141,17 +191,23 @@ void FlutterTizenView::OnRotate(int32_t degree) {
         sin(rad), cos(rad),  trans_y,  // y
         0.0,      0.0,       1.0       // perspective
     };
-
-    if (rotation_degree_ == 90 || rotation_degree_ == 270) {
-      std::swap(width, height);
-    }
+  }
+  if (rotation_degree_ == 90 || rotation_degree_ == 270) {
+    std::swap(width, height);
   }
 
-  engine_->renderer()->ResizeSurface(width, height);
+  if (auto* window = dynamic_cast<TizenWindow*>(tizen_view_.get())) {
+    window->ResizeRenderTarget(geometry);
+  }
+  if (TizenRenderer* renderer = this->renderer()) {
+    renderer->ResizeSurface(width, height);
+  }
 
   // Window position does not change on rotation regardless of its
   // orientation.
   SendWindowMetrics(geometry.left, geometry.top, width, height, 0.0);
+  *frame_width = width;
+  *frame_height = height;
 }
 
 FlutterTizenView::PointerState* FlutterTizenView::GetOrCreatePointerState(
@@ -277,11 +333,11 @@ void FlutterTizenView::OnKey(const char* key,
     }
   }
 
-  if (engine_->keyboard_channel()) {
+  if (engine_ && engine_->keyboard_channel()) {
     bool& backkey_handled = backkey_handled_;
     engine_->keyboard_channel()->SendKey(
         key, string, compose, modifiers, scan_code, is_down,
-        [engine = engine_.get(), symbol = std::string(key), is_down,
+        [engine = engine_, symbol = std::string(key), is_down,
          &backkey_handled](bool handled) {
           // If System's back key is handled in key-down, it should be
           // handled so that "popRoute" is not called in key-up.
@@ -308,29 +364,45 @@ void FlutterTizenView::OnKey(const char* key,
 }
 
 void FlutterTizenView::OnComposeBegin() {
-  text_input_channel_->OnComposeBegin();
+  if (text_input_channel_) {
+    text_input_channel_->OnComposeBegin();
+  }
 }
 
 void FlutterTizenView::OnComposeChange(const std::string& str, int cursor_pos) {
-  text_input_channel_->OnComposeChange(str, cursor_pos);
+  if (text_input_channel_) {
+    text_input_channel_->OnComposeChange(str, cursor_pos);
+  }
 }
 
 void FlutterTizenView::OnComposeEnd() {
-  text_input_channel_->OnComposeEnd();
+  if (text_input_channel_) {
+    text_input_channel_->OnComposeEnd();
+  }
 }
 
 void FlutterTizenView::OnCommit(const std::string& str) {
-  text_input_channel_->OnCommit(str);
+  if (text_input_channel_) {
+    text_input_channel_->OnCommit(str);
+  }
+}
+
+void FlutterTizenView::OnFocusChange(bool focused) {
+  if (engine_) {
+    engine_->SendViewFocusEvent(view_id_, focused);
+  }
 }
 
 void FlutterTizenView::SendInitialGeometry() {
+  int32_t degree = 0;
   if (auto* window = dynamic_cast<TizenWindow*>(tizen_view_.get())) {
-    OnRotate(window->GetRotation());
-  } else {
-    TizenGeometry geometry = tizen_view_->GetGeometry();
-    SendWindowMetrics(geometry.left, geometry.top, geometry.width,
-                      geometry.height, 0.0);
+    degree = window->GetRotation();
   }
+  // The engine has no metrics yet, so they are sent even if the geometry has
+  // been applied before.
+  resize_coordinator_.Reset();
+  resize_coordinator_.RequestRotation(degree, tizen_view_->GetGeometry());
+  resize_coordinator_.Flush();
 }
 
 void FlutterTizenView::SendWindowMetrics(int32_t left,
@@ -338,15 +410,14 @@ void FlutterTizenView::SendWindowMetrics(int32_t left,
                                          int32_t width,
                                          int32_t height,
                                          double pixel_ratio) {
+  if (!engine_) {
+    return;
+  }
   if (pixel_ratio == 0.0) {
-    if (user_pixel_ratio_ == 0.0) {
-      pixel_ratio = ComputePixelRatio(tizen_view_->GetDpi());
-    } else {
-      pixel_ratio = user_pixel_ratio_;
-    }
+    pixel_ratio = GetPixelRatio();
   }
 
-  engine_->SendWindowMetrics(left, top, width, height, pixel_ratio);
+  engine_->SendWindowMetrics(view_id_, left, top, width, height, pixel_ratio);
 }
 
 void FlutterTizenView::SendFlutterPointerEvent(FlutterPointerPhase phase,
@@ -356,6 +427,9 @@ void FlutterTizenView::SendFlutterPointerEvent(FlutterPointerPhase phase,
                                                double delta_y,
                                                size_t timestamp,
                                                PointerState* state) {
+  if (!engine_) {
+    return;
+  }
   TizenGeometry geometry = tizen_view_->GetGeometry();
   double new_x = x, new_y = y;
 
@@ -6,6 +6,8 @@
 #ifndef EMBEDDER_FLUTTER_TIZEN_VIEW_H_
 #define EMBEDDER_FLUTTER_TIZEN_VIEW_H_
 
+#include <Ecore.h>
+
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -18,6 +20,7 @@
 #include "flutter/shell/platform/tizen/channels/text_input_channel.h"
 #include "flutter/shell/platform/tizen/channels/window_channel.h"
 #include "flutter/shell/platform/tizen/flutter_tizen_engine.h"
+#include "flutter/shell/platform/tizen/resize_coordinator.h"
 #include "flutter/shell/platform/tizen/tizen_view_base.h"
 #include "flutter/shell/platform/tizen/tizen_view_event_handler_delegate.h"
 
@@ -31,6 +34,16 @@ class FlutterTizenView : public TizenViewEventHandlerDelegate {
                    FlutterDesktopRendererType renderer_type,
                    double user_pixel_ratio = 0);
 
+  // Creates an additional view of |engine|, which must already be running
+  // with a view created by the constructor above.
+  //
+  // The view must be added to the engine with FlutterTizenEngine::AddView
+  // before use. It shares the channels of the view that owns |engine|.
+  FlutterTizenView(FlutterViewId view_id,
+                   std::unique_ptr<TizenViewBase> tizen_view,
+                   FlutterTizenEngine* engine,
+                   double user_pixel_ratio = 0);
+
   virtual ~FlutterTizenView();
 
   // Get the view's unique identifier.
@@ -39,10 +52,24 @@ class FlutterTizenView : public TizenViewEventHandlerDelegate {
   // Set up window dependent channels.
   void SetupChannels();
 
-  FlutterTizenEngine* engine() { return engine_.get(); }
+  FlutterTizenEngine* engine() { return engine_; }
 
   TizenViewBase* tizen_view() { return tizen_view_.get(); }
 
+  // The renderer drawing this view, or nullptr if the view is detached.
+  TizenRenderer* renderer() {
+    return engine_ ? engine_->GetRenderer(view_id_) : nullptr;
+  }
+
+  // Called by the engine on an additional view when the engine stops before
+  // the view is destroyed. The view ignores input and displays nothing from
+  // then on.
+  void DetachEngine();
+
+  // The pixel ratio of this view, either given by the user or computed from
+  // the screen DPI.
+  double GetPixelRatio();
+
   void Resize(int32_t width, int32_t height);
 
   void OnResize(int32_t left,
@@ -96,12 +123,20 @@ class FlutterTizenView : public TizenViewEventHandlerDelegate {
 
   void OnCommit(const std::string& str) override;
 
+  void OnFocusChange(bool focused) override;
+
   FlutterTransformation GetFlutterTransformation() {
     return flutter_transformation_;
   }
 
   void SendInitialGeometry();
 
+  // Whether a frame of |width| x |height| matches the current window metrics
+  // and may be presented. Called on the raster thread.
+  bool ShouldPresentFrame(size_t width, size_t height) {
+    return resize_coordinator_.ShouldPresentFrame(width, height);
+  }
+
   PlatformViewChannel* platform_view_channel() {
     return platform_view_channel_.get();
   }
@@ -138,6 +173,16 @@ class FlutterTizenView : public TizenViewEventHandlerDelegate {
   // Returns a FlutterPointerPhase corresponding to the current pointer state.
   FlutterPointerPhase GetPointerPhaseFromState(const PointerState* state) const;
 
+  // Flushes |resize_coordinator_| on the next frame.
+  void ScheduleResizeFlush();
+
+  // Resizes the surface to |geometry| rotated by |degree| and sends the window
+  // metrics. Called by |resize_coordinator_|.
+  void ApplyGeometry(const TizenGeometry& geometry,
+                     int32_t degree,
+                     int32_t* frame_width,
+                     int32_t* frame_height);
+
   // Sends a window metrics update to the Flutter engine using current window
   // dimensions in physical.
   void SendWindowMetrics(int32_t left,
@@ -161,8 +206,11 @@ class FlutterTizenView : public TizenViewEventHandlerDelegate {
   // The platform view associated with this Flutter view.
   std::unique_ptr<TizenViewBase> tizen_view_;
 
+  // The engine owned by this view, if this view is the implicit view.
+  std::unique_ptr<FlutterTizenEngine> owned_engine_;
+
   // The engine associated with this view.
-  std::unique_ptr<FlutterTizenEngine> engine_;
+  FlutterTizenEngine* engine_ = nullptr;
 
   // Keeps track of pointer states.
   std::unordered_map<int32_t, std::unique_ptr<PointerState>> pointer_states_;
@@ -188,6 +236,18 @@ class FlutterTizenView : public TizenViewEventHandlerDelegate {
   // A plugin to report input device information.
   std::unique_ptr<InputDeviceChannel> input_device_channel_;
 
+  // Coalesces resize and rotation events to at most one per frame.
+  ResizeCoordinator resize_coordinator_{
+      [this](const TizenGeometry& geometry, int32_t degree,
+             int32_t* frame_width, int32_t* frame_height) {
+        ApplyGeometry(geometry, degree, frame_width, frame_height);
+      },
+      [this]() { ScheduleResizeFlush(); }};
+
+  // The animator that flushes |resize_coordinator_| on the next frame, if
+  // scheduled.
+  Ecore_Animator* resize_animator_ = nullptr;
+
   // The current view rotation degree.
   int32_t rotation_degree_ = 0;
 
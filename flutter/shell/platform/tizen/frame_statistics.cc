@@ -0,0 +1,185 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "frame_statistics.h"
+
+#include <algorithm>
+
+namespace flutter {
+
+namespace {
+
+constexpr uint64_t kNanosPerMilli = 1000000;
+
+// The upper bounds of the histogram buckets in milliseconds. The last bucket
+// has no upper bound.
+constexpr uint64_t kBucketUpperBoundsMillis[] = {4,  8,  12, 16,  20, 25,
+                                                 33, 50, 67, 100, 200};
+
+static_assert(sizeof(kBucketUpperBoundsMillis) / sizeof(uint64_t) ==
+                  FLUTTER_DESKTOP_FRAME_HISTOGRAM_SIZE - 1,
+              "The number of histogram buckets does not match.");
+
+}  // namespace
+
+FrameStatistics::FrameStatistics(
+    FlutterEngineGetCurrentTimeFnPtr get_current_time)
+    : get_current_time_(get_current_time) {}
+
+void FrameStatistics::SetEnabled(bool enabled) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (enabled && frame_timings_.empty()) {
+    frame_timings_.resize(kMaxFrameTimings);
+  }
+  // Do not attribute a frame that was in flight while toggling.
+  current_frame_ = {};
+  enabled_ = enabled;
+}
+
+void FrameStatistics::OnVsync(uint64_t frame_start_time_nanos,
+                              uint64_t frame_target_time_nanos) {
+  if (!IsEnabled()) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  pending_vsync_time_ = frame_start_time_nanos;
+  pending_target_time_ = frame_target_time_nanos;
+}
+
+void FrameStatistics::OnMakeCurrent() {
+  if (!IsEnabled()) {
+    return;
+  }
+  uint64_t now = get_current_time_();
+  std::lock_guard<std::mutex> lock(mutex_);
+  pending_make_current_time_ = now;
+}
+
+void FrameStatistics::OnFrameBegin() {
+  if (!IsEnabled()) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  current_frame_ = {};
+  current_frame_.vsync_time = pending_vsync_time_;
+  current_frame_.target_time = pending_target_time_;
+  current_frame_.make_current_time = pending_make_current_time_;
+  pending_vsync_time_ = 0;
+  pending_target_time_ = 0;
+}
+
+void FrameStatistics::OnPresentBegin() {
+  if (!IsEnabled()) {
+    return;
+  }
+  uint64_t now = get_current_time_();
+  std::lock_guard<std::mutex> lock(mutex_);
+  current_frame_.present_begin_time = now;
+}
+
+void FrameStatistics::OnPresentEnd() {
+  if (!IsEnabled()) {
+    return;
+  }
+  uint64_t now = get_current_time_();
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (current_frame_.present_begin_time == 0) {
+    return;
+  }
+  current_frame_.present_end_time = now;
+  RecordFrame(current_frame_);
+  current_frame_ = {};
+}
+
+FlutterDesktopFrameStatistics FrameStatistics::GetStatistics() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  FlutterDesktopFrameStatistics statistics = statistics_;
+  if (present_latency_count_ > 0) {
+    statistics.average_present_latency_nanos =
+        total_present_latency_ / present_latency_count_;
+  }
+  if (statistics.frame_count > 0) {
+    statistics.average_swap_duration_nanos =
+        total_swap_duration_ / statistics.frame_count;
+  }
+  return statistics;
+}
+
+size_t FrameStatistics::GetFrameTimings(FlutterDesktopFrameTiming* timings,
+                                        size_t max_count) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t available = static_cast<size_t>(
+      std::min<uint64_t>(statistics_.frame_count, frame_timings_.size()));
+  size_t count = std::min(available, max_count);
+  if (count == 0) {
+    return 0;
+  }
+  // The oldest of the |count| most recent entries.
+  size_t index = (next_frame_timing_ + frame_timings_.size() - count) %
+                 frame_timings_.size();
+  for (size_t i = 0; i < count; i++) {
+    timings[i] = frame_timings_[index];
+    index = (index + 1) % frame_timings_.size();
+  }
+  return count;
+}
+
+void FrameStatistics::Reset() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  pending_vsync_time_ = 0;
+  pending_target_time_ = 0;
+  pending_make_current_time_ = 0;
+  current_frame_ = {};
+  statistics_ = {};
+  total_present_latency_ = 0;
+  present_latency_count_ = 0;
+  total_swap_duration_ = 0;
+  next_frame_timing_ = 0;
+}
+
+size_t FrameStatistics::GetBucketIndex(uint64_t duration_nanos) {
+  size_t index = 0;
+  for (uint64_t bound : kBucketUpperBoundsMillis) {
+    if (duration_nanos <= bound * kNanosPerMilli) {
+      return index;
+    }
+    index++;
+  }
+  return index;
+}
+
+void FrameStatistics::RecordFrame(const FlutterDesktopFrameTiming& timing) {
+  statistics_.frame_count++;
+
+  uint64_t swap_duration = timing.present_end_time - timing.present_begin_time;
+  total_swap_duration_ += swap_duration;
+  statistics_.max_swap_duration_nanos =
+      std::max(statistics_.max_swap_duration_nanos, swap_duration);
+  statistics_.swap_duration_histogram[GetBucketIndex(swap_duration)]++;
+
+  // Latency and missed vblanks can only be computed for vsync driven frames.
+  if (timing.vsync_time != 0 && timing.present_end_time > timing.vsync_time) {
+    uint64_t latency = timing.present_end_time - timing.vsync_time;
+    total_present_latency_ += latency;
+    present_latency_count_++;
+    statistics_.max_present_latency_nanos =
+        std::max(statistics_.max_present_latency_nanos, latency);
+    statistics_.present_latency_histogram[GetBucketIndex(latency)]++;
+
+    if (timing.target_time > timing.vsync_time &&
+        timing.present_end_time > timing.target_time) {
+      uint64_t interval = timing.target_time - timing.vsync_time;
+      statistics_.janky_frame_count++;
+      statistics_.missed_vblank_count +=
+          (timing.present_end_time - timing.target_time) / interval + 1;
+    }
+  }
+
+  if (!frame_timings_.empty()) {
+    frame_timings_[next_frame_timing_] = timing;
+    next_frame_timing_ = (next_frame_timing_ + 1) % frame_timings_.size();
+  }
+}
+
+}  // namespace flutter
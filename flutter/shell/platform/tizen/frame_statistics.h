@@ -0,0 +1,106 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef EMBEDDER_FRAME_STATISTICS_H_
+#define EMBEDDER_FRAME_STATISTICS_H_
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "flutter/shell/platform/embedder/embedder.h"
+#include "flutter/shell/platform/tizen/public/flutter_tizen.h"
+
+namespace flutter {
+
+// Collects per-frame timestamps between vblank delivery, raster make_current
+// and buffer presentation, and aggregates them into latency histograms.
+//
+// OnVsync is called on the vblank thread, OnMakeCurrent/OnFrameBegin/
+// OnPresent* on the raster thread, and the remaining methods on the platform thread. All
+// recording methods return immediately while the collector is disabled.
+class FrameStatistics {
+ public:
+  // The number of most recent frames whose timings are retained.
+  static constexpr size_t kMaxFrameTimings = 240;
+
+  explicit FrameStatistics(FlutterEngineGetCurrentTimeFnPtr get_current_time);
+
+  // Prevent copying.
+  FrameStatistics(FrameStatistics const&) = delete;
+  FrameStatistics& operator=(FrameStatistics const&) = delete;
+
+  bool IsEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+  // Starts or stops collecting. Collected data is kept until Reset().
+  void SetEnabled(bool enabled);
+
+  // Called when a vblank has been delivered to the engine.
+  void OnVsync(uint64_t frame_start_time_nanos,
+               uint64_t frame_target_time_nanos);
+
+  // Called when the raster thread makes the onscreen context current. This
+  // also happens outside of frames, e.g. for texture uploads, so the time is
+  // only kept until OnFrameBegin().
+  void OnMakeCurrent();
+
+  // Called when the raster thread acquires the onscreen framebuffer for a
+  // frame. Starts the frame at the preceding OnMakeCurrent() time.
+  void OnFrameBegin();
+
+  // Called right before and after the rendered buffer is presented.
+  void OnPresentBegin();
+  void OnPresentEnd();
+
+  // Returns the aggregated statistics of all frames since the last reset.
+  FlutterDesktopFrameStatistics GetStatistics();
+
+  // Copies up to |max_count| most recent frame timings into |timings| in
+  // chronological order and returns the number of copied entries.
+  size_t GetFrameTimings(FlutterDesktopFrameTiming* timings, size_t max_count);
+
+  // Discards all collected data.
+  void Reset();
+
+ private:
+  // Returns the index of the histogram bucket for |duration_nanos|.
+  static size_t GetBucketIndex(uint64_t duration_nanos);
+
+  // Adds a completed frame to the aggregated statistics.
+  void RecordFrame(const FlutterDesktopFrameTiming& timing);
+
+  FlutterEngineGetCurrentTimeFnPtr get_current_time_;
+
+  std::atomic_bool enabled_ = false;
+
+  std::mutex mutex_;
+
+  // The most recent vblank that has not been consumed by a frame yet.
+  uint64_t pending_vsync_time_ = 0;
+  uint64_t pending_target_time_ = 0;
+
+  // The most recent time the onscreen context was made current.
+  uint64_t pending_make_current_time_ = 0;
+
+  // The frame currently being rasterized.
+  FlutterDesktopFrameTiming current_frame_ = {};
+
+  FlutterDesktopFrameStatistics statistics_ = {};
+
+  // The sum of present latencies, used to compute the average.
+  uint64_t total_present_latency_ = 0;
+  size_t present_latency_count_ = 0;
+
+  // The sum of swap durations, used to compute the average.
+  uint64_t total_swap_duration_ = 0;
+
+  // A ring buffer of the most recent frame timings.
+  std::vector<FlutterDesktopFrameTiming> frame_timings_;
+  size_t next_frame_timing_ = 0;
+};
+
+}  // namespace flutter
+
+#endif  // EMBEDDER_FRAME_STATISTICS_H_
@@ -0,0 +1,173 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/tizen/frame_statistics.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+constexpr uint64_t kMillis = 1000000;
+constexpr uint64_t kFrameInterval = 16 * kMillis;
+
+uint64_t current_time = 0;
+
+uint64_t GetCurrentTime() {
+  return current_time;
+}
+
+// Simulates a single frame driven by the vblank at |vsync_time| whose
+// rasterization and presentation take the given durations.
+void RunFrame(FrameStatistics& statistics,
+              uint64_t vsync_time,
+              uint64_t raster_duration,
+              uint64_t swap_duration) {
+  current_time = vsync_time;
+  statistics.OnVsync(vsync_time, vsync_time + kFrameInterval);
+  statistics.OnMakeCurrent();
+  statistics.OnFrameBegin();
+  current_time += raster_duration;
+  statistics.OnPresentBegin();
+  current_time += swap_duration;
+  statistics.OnPresentEnd();
+}
+
+}  // namespace
+
+class FrameStatisticsTest : public ::testing::Test {
+ protected:
+  void SetUp() { current_time = 1000 * kMillis; }
+};
+
+TEST_F(FrameStatisticsTest, DisabledByDefault) {
+  FrameStatistics statistics(GetCurrentTime);
+  EXPECT_FALSE(statistics.IsEnabled());
+
+  RunFrame(statistics, current_time, 4 * kMillis, 1 * kMillis);
+
+  FlutterDesktopFrameStatistics result = statistics.GetStatistics();
+  EXPECT_EQ(result.frame_count, 0u);
+  FlutterDesktopFrameTiming timing = {};
+  EXPECT_EQ(statistics.GetFrameTimings(&timing, 1), 0u);
+}
+
+TEST_F(FrameStatisticsTest, RecordsFrameTimings) {
+  FrameStatistics statistics(GetCurrentTime);
+  statistics.SetEnabled(true);
+
+  uint64_t vsync_time = current_time;
+  RunFrame(statistics, vsync_time, 4 * kMillis, 2 * kMillis);
+
+  FlutterDesktopFrameTiming timing = {};
+  ASSERT_EQ(statistics.GetFrameTimings(&timing, 1), 1u);
+  EXPECT_EQ(timing.vsync_time, vsync_time);
+  EXPECT_EQ(timing.target_time, vsync_time + kFrameInterval);
+  EXPECT_EQ(timing.make_current_time, vsync_time);
+  EXPECT_EQ(timing.present_begin_time, vsync_time + 4 * kMillis);
+  EXPECT_EQ(timing.present_end_time, vsync_time + 6 * kMillis);
+
+  FlutterDesktopFrameStatistics result = statistics.GetStatistics();
+  EXPECT_EQ(result.frame_count, 1u);
+  EXPECT_EQ(result.janky_frame_count, 0u);
+  EXPECT_EQ(result.missed_vblank_count, 0u);
+  EXPECT_EQ(result.average_present_latency_nanos, 6 * kMillis);
+  EXPECT_EQ(result.average_swap_duration_nanos, 2 * kMillis);
+  // 6 ms falls into the (4, 8] bucket and 2 ms into the [0, 4] bucket.
+  EXPECT_EQ(result.present_latency_histogram[1], 1u);
+  EXPECT_EQ(result.swap_duration_histogram[0], 1u);
+}
+
+TEST_F(FrameStatisticsTest, CountsMissedVblanks) {
+  FrameStatistics statistics(GetCurrentTime);
+  statistics.SetEnabled(true);
+
+  // Presented 1 ms after the target time: one missed vblank.
+  RunFrame(statistics, current_time, 15 * kMillis, 2 * kMillis);
+  // Presented 17 ms after the target time: two missed vblanks.
+  RunFrame(statistics, current_time, 30 * kMillis, 3 * kMillis);
+  // Presented in time.
+  RunFrame(statistics, current_time, 8 * kMillis, 1 * kMillis);
+
+  FlutterDesktopFrameStatistics result = statistics.GetStatistics();
+  EXPECT_EQ(result.frame_count, 3u);
+  EXPECT_EQ(result.janky_frame_count, 2u);
+  EXPECT_EQ(result.missed_vblank_count, 3u);
+  EXPECT_EQ(result.max_present_latency_nanos, 33 * kMillis);
+  EXPECT_EQ(result.max_swap_duration_nanos, 3 * kMillis);
+  EXPECT_EQ(result.present_latency_histogram[4], 1u);
+  EXPECT_EQ(result.present_latency_histogram[6], 1u);
+}
+
+TEST_F(FrameStatisticsTest, FramesWithoutVsync) {
+  FrameStatistics statistics(GetCurrentTime);
+  statistics.SetEnabled(true);
+
+  statistics.OnMakeCurrent();
+  statistics.OnFrameBegin();
+  current_time += 5 * kMillis;
+  statistics.OnPresentBegin();
+  current_time += 1 * kMillis;
+  statistics.OnPresentEnd();
+
+  FlutterDesktopFrameStatistics result = statistics.GetStatistics();
+  EXPECT_EQ(result.frame_count, 1u);
+  EXPECT_EQ(result.average_present_latency_nanos, 0u);
+  EXPECT_EQ(result.average_swap_duration_nanos, 1 * kMillis);
+  EXPECT_EQ(result.missed_vblank_count, 0u);
+}
+
+TEST_F(FrameStatisticsTest, IgnoresMakeCurrentOutsideFrames) {
+  FrameStatistics statistics(GetCurrentTime);
+  statistics.SetEnabled(true);
+
+  uint64_t vsync_time = current_time;
+  statistics.OnVsync(vsync_time, vsync_time + kFrameInterval);
+  statistics.OnMakeCurrent();
+  statistics.OnFrameBegin();
+  // A texture upload while the frame is being rasterized.
+  current_time += 2 * kMillis;
+  statistics.OnMakeCurrent();
+  current_time += 2 * kMillis;
+  statistics.OnPresentBegin();
+  current_time += 1 * kMillis;
+  statistics.OnPresentEnd();
+  // A texture upload between frames.
+  statistics.OnMakeCurrent();
+
+  FlutterDesktopFrameTiming timing = {};
+  ASSERT_EQ(statistics.GetFrameTimings(&timing, 1), 1u);
+  EXPECT_EQ(timing.make_current_time, vsync_time);
+  EXPECT_EQ(statistics.GetStatistics().frame_count, 1u);
+}
+
+TEST_F(FrameStatisticsTest, KeepsMostRecentTimings) {
+  FrameStatistics statistics(GetCurrentTime);
+  statistics.SetEnabled(true);
+
+  size_t frame_count = FrameStatistics::kMaxFrameTimings + 10;
+  for (size_t i = 0; i < frame_count; i++) {
+    RunFrame(statistics, current_time + kFrameInterval, 4 * kMillis,
+             1 * kMillis);
+  }
+
+  std::vector<FlutterDesktopFrameTiming> timings(frame_count);
+  size_t count = statistics.GetFrameTimings(timings.data(), timings.size());
+  EXPECT_EQ(count, FrameStatistics::kMaxFrameTimings);
+  for (size_t i = 1; i < count; i++) {
+    EXPECT_LT(timings[i - 1].vsync_time, timings[i].vsync_time);
+  }
+  EXPECT_EQ(timings[count - 1].present_end_time, current_time);
+
+  statistics.Reset();
+  EXPECT_EQ(statistics.GetStatistics().frame_count, 0u);
+  EXPECT_EQ(statistics.GetFrameTimings(timings.data(), timings.size()), 0u);
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -14,6 +14,8 @@
 #include <cstdlib>
 #include <iostream>
 
+#include "flutter/shell/platform/tizen/thread_policy.h"
+
 namespace {
 
 constexpr char kLogTag[] = "ConsoleMessage";
@@ -53,6 +55,7 @@ log_priority LevelToPriority(int level) {
 namespace flutter {
 
 void* Logger::Redirect(void* arg) {
+  ApplyThreadPolicy(kBackground);
   int* pipe = static_cast<int*>(arg);
   ssize_t size;
   char buffer[4096];
@@ -66,6 +69,7 @@ void* Logger::Redirect(void* arg) {
 }
 
 void* Logger::Forward(void* arg) {
+  ApplyThreadPolicy(kBackground);
   if (logging_port_ == 0) {
     return nullptr;
   }
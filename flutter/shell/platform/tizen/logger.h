@@ -24,6 +24,7 @@ class Logger {
  public:
   static void Start();
   static void Stop();
+  static bool IsRunning() { return is_running_; }
 
   static int GetLoggingLevel() { return logging_level_; }
   static void SetLoggingLevel(int level) { logging_level_ = level; }
@@ -0,0 +1,158 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "memory_pressure_monitor.h"
+
+#include <vconf.h>
+
+#include <algorithm>
+
+#include "flutter/shell/platform/tizen/logger.h"
+
+namespace flutter {
+
+namespace {
+
+constexpr char kLowMemoryVconfKey[] = "memory/sysman/low_memory";
+
+// The values of kLowMemoryVconfKey.
+constexpr int kLowMemorySoftWarning = 0x02;
+constexpr int kLowMemoryHardWarning = 0x04;
+
+// Notifications of the same level within this interval are duplicates.
+constexpr std::chrono::seconds kDuplicateInterval(1);
+
+MemoryPressureLevel ToMemoryPressureLevel(int low_memory) {
+  switch (low_memory) {
+    case kLowMemorySoftWarning:
+      return MemoryPressureLevel::kModerate;
+    case kLowMemoryHardWarning:
+      return MemoryPressureLevel::kCritical;
+    default:
+      return MemoryPressureLevel::kNormal;
+  }
+}
+
+const char* GetLevelName(MemoryPressureLevel level) {
+  switch (level) {
+    case MemoryPressureLevel::kNormal:
+      return "normal";
+    case MemoryPressureLevel::kModerate:
+      return "moderate";
+    case MemoryPressureLevel::kCritical:
+      return "critical";
+  }
+  return "unknown";
+}
+
+// The callbacks of all started sources. A single vconf callback is shared by
+// all engines in the process, since vconf cannot tell apart callbacks
+// registered with the same function when removing them.
+std::vector<MemoryPressureSource::LevelCallback*> low_memory_callbacks;
+
+void OnLowMemoryChanged(keynode_t* node, void* user_data) {
+  MemoryPressureLevel level =
+      ToMemoryPressureLevel(vconf_keynode_get_int(node));
+  // Copied since a callback may stop its source.
+  std::vector<MemoryPressureSource::LevelCallback*> callbacks =
+      low_memory_callbacks;
+  for (MemoryPressureSource::LevelCallback* callback : callbacks) {
+    if (std::find(low_memory_callbacks.begin(), low_memory_callbacks.end(),
+                  callback) != low_memory_callbacks.end()) {
+      (*callback)(level);
+    }
+  }
+}
+
+}  // namespace
+
+VconfMemoryPressureSource::~VconfMemoryPressureSource() {
+  Stop();
+}
+
+bool VconfMemoryPressureSource::Start(LevelCallback callback) {
+  if (started_) {
+    Stop();
+  }
+  if (low_memory_callbacks.empty() &&
+      vconf_notify_key_changed(kLowMemoryVconfKey, OnLowMemoryChanged,
+                               nullptr) != 0) {
+    FT_LOG(Error) << "Failed to monitor " << kLowMemoryVconfKey << ".";
+    return false;
+  }
+  callback_ = std::move(callback);
+  low_memory_callbacks.push_back(&callback_);
+  started_ = true;
+  return true;
+}
+
+void VconfMemoryPressureSource::Stop() {
+  if (!started_) {
+    return;
+  }
+  low_memory_callbacks.erase(std::find(low_memory_callbacks.begin(),
+                                       low_memory_callbacks.end(), &callback_));
+  if (low_memory_callbacks.empty()) {
+    vconf_ignore_key_changed(kLowMemoryVconfKey, OnLowMemoryChanged);
+  }
+  started_ = false;
+}
+
+MemoryPressureMonitor::MemoryPressureMonitor(
+    std::unique_ptr<MemoryPressureSource> source,
+    WarningCallback on_warning)
+    : source_(std::move(source)), on_warning_(std::move(on_warning)) {
+  if (source_ &&
+      !source_->Start([this](MemoryPressureLevel level) {
+        OnMemoryPressure(level);
+      })) {
+    source_.reset();
+  }
+}
+
+MemoryPressureMonitor::~MemoryPressureMonitor() {
+  if (source_) {
+    source_->Stop();
+  }
+}
+
+void MemoryPressureMonitor::AddTrimmer(const std::string& name,
+                                       Trimmer trimmer) {
+  trimmers_.push_back({name, std::move(trimmer)});
+}
+
+size_t MemoryPressureMonitor::OnMemoryPressure(MemoryPressureLevel level) {
+  MemoryPressureLevel previous_level = level_;
+  level_ = level;
+  if (level == MemoryPressureLevel::kNormal) {
+    return 0;
+  }
+  auto now = std::chrono::steady_clock::now();
+  if (level == previous_level &&
+      now - last_warning_time_ < kDuplicateInterval) {
+    return 0;
+  }
+  last_warning_time_ = now;
+
+  if (on_warning_) {
+    on_warning_(level);
+  }
+  size_t total = 0;
+  for (const NamedTrimmer& entry : trimmers_) {
+    size_t bytes = entry.trimmer(level);
+    FT_LOG(Debug) << "Trimmed " << entry.name << ": " << bytes << " bytes.";
+    total += bytes;
+  }
+  released_bytes_ += total;
+  FT_LOG(Info) << "Released " << total << " bytes on " << GetLevelName(level)
+               << " memory pressure.";
+  return total;
+}
+
+void MemoryPressureMonitor::AddReleasedBytes(size_t bytes) {
+  released_bytes_ += bytes;
+  FT_LOG(Info) << "Released " << bytes << " bytes asynchronously.";
+}
+
+}  // namespace flutter
@@ -0,0 +1,129 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef EMBEDDER_MEMORY_PRESSURE_MONITOR_H_
+#define EMBEDDER_MEMORY_PRESSURE_MONITOR_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace flutter {
+
+enum class MemoryPressureLevel {
+  // The system has enough free memory.
+  kNormal,
+  // The system is running low on memory. Caches that are cheap to rebuild
+  // should be released.
+  kModerate,
+  // The system is about to kill processes to reclaim memory. Everything that
+  // can be rebuilt should be released.
+  kCritical,
+};
+
+// A source of memory pressure level changes.
+class MemoryPressureSource {
+ public:
+  using LevelCallback = std::function<void(MemoryPressureLevel level)>;
+
+  virtual ~MemoryPressureSource() = default;
+
+  // Starts calling |callback| on the platform thread whenever the memory
+  // pressure level changes.
+  //
+  // Returns false if the level cannot be monitored.
+  virtual bool Start(LevelCallback callback) = 0;
+
+  // Stops calling the callback passed to Start.
+  virtual void Stop() = 0;
+};
+
+// Reports the low memory levels of the system memory manager, which are
+// published as the memory/sysman/low_memory vconf key.
+class VconfMemoryPressureSource : public MemoryPressureSource {
+ public:
+  VconfMemoryPressureSource() = default;
+  virtual ~VconfMemoryPressureSource();
+
+  bool Start(LevelCallback callback) override;
+
+  void Stop() override;
+
+ private:
+  LevelCallback callback_;
+  bool started_ = false;
+};
+
+// Reacts to memory pressure by notifying the engine and releasing memory
+// held by the embedder.
+//
+// Pressure is reported either by a MemoryPressureSource or explicitly with
+// OnMemoryPressure. Both may report the same platform event, so a
+// notification with the same level as the previous one is ignored if it
+// arrives within a second.
+//
+// All methods except AddReleasedBytes must be called on the platform thread.
+class MemoryPressureMonitor {
+ public:
+  // Releases memory for |level| and returns the number of bytes released.
+  // Memory released asynchronously is reported with AddReleasedBytes instead.
+  using Trimmer = std::function<size_t(MemoryPressureLevel level)>;
+
+  // Called for every level other than kNormal, before the trimmers.
+  using WarningCallback = std::function<void(MemoryPressureLevel level)>;
+
+  // Starts monitoring |source|, which may be nullptr if memory pressure is
+  // only reported explicitly.
+  MemoryPressureMonitor(std::unique_ptr<MemoryPressureSource> source,
+                        WarningCallback on_warning);
+
+  ~MemoryPressureMonitor();
+
+  // Prevent copying.
+  MemoryPressureMonitor(MemoryPressureMonitor const&) = delete;
+  MemoryPressureMonitor& operator=(MemoryPressureMonitor const&) = delete;
+
+  // Registers |trimmer| to be called on memory pressure. |name| is used for
+  // logging only.
+  void AddTrimmer(const std::string& name, Trimmer trimmer);
+
+  // Handles a change of the memory pressure level to |level|.
+  //
+  // Returns the number of bytes released synchronously.
+  size_t OnMemoryPressure(MemoryPressureLevel level);
+
+  // Adds |bytes| released asynchronously by a trimmer to the total. May be
+  // called on any thread.
+  void AddReleasedBytes(size_t bytes);
+
+  // The current memory pressure level.
+  MemoryPressureLevel level() const { return level_; }
+
+  // The total number of bytes released so far, including the bytes added
+  // with AddReleasedBytes.
+  size_t released_bytes() const { return released_bytes_; }
+
+ private:
+  struct NamedTrimmer {
+    std::string name;
+    Trimmer trimmer;
+  };
+
+  std::unique_ptr<MemoryPressureSource> source_;
+  WarningCallback on_warning_;
+  std::vector<NamedTrimmer> trimmers_;
+
+  MemoryPressureLevel level_ = MemoryPressureLevel::kNormal;
+  std::chrono::steady_clock::time_point last_warning_time_;
+
+  std::atomic<size_t> released_bytes_ = 0;
+};
+
+}  // namespace flutter
+
+#endif  // EMBEDDER_MEMORY_PRESSURE_MONITOR_H_
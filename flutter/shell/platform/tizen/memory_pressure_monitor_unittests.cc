@@ -0,0 +1,113 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/tizen/memory_pressure_monitor.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+// A source whose level is changed by the test.
+class FakeMemoryPressureSource : public MemoryPressureSource {
+ public:
+  explicit FakeMemoryPressureSource(bool* started) : started_(started) {}
+
+  bool Start(LevelCallback callback) override {
+    callback_ = std::move(callback);
+    *started_ = true;
+    return true;
+  }
+
+  void Stop() override { *started_ = false; }
+
+  void SetLevel(MemoryPressureLevel level) {
+    if (*started_) {
+      callback_(level);
+    }
+  }
+
+ private:
+  bool* started_;
+  LevelCallback callback_;
+};
+
+}  // namespace
+
+TEST(MemoryPressureMonitorTest, ForwardsWarningsAndTrims) {
+  bool started = false;
+  auto source = std::make_unique<FakeMemoryPressureSource>(&started);
+  FakeMemoryPressureSource* fake_source = source.get();
+  std::vector<MemoryPressureLevel> warnings;
+  std::vector<MemoryPressureLevel> trims;
+  {
+    MemoryPressureMonitor monitor(
+        std::move(source),
+        [&warnings](MemoryPressureLevel level) { warnings.push_back(level); });
+    EXPECT_TRUE(started);
+    monitor.AddTrimmer("cache", [&trims](MemoryPressureLevel level) {
+      trims.push_back(level);
+      return level == MemoryPressureLevel::kCritical ? 300 : 100;
+    });
+    monitor.AddTrimmer("scratch",
+                       [](MemoryPressureLevel level) -> size_t { return 20; });
+
+    fake_source->SetLevel(MemoryPressureLevel::kModerate);
+    EXPECT_EQ(monitor.level(), MemoryPressureLevel::kModerate);
+    EXPECT_EQ(monitor.released_bytes(), 120u);
+
+    fake_source->SetLevel(MemoryPressureLevel::kCritical);
+    EXPECT_EQ(monitor.released_bytes(), 440u);
+
+    fake_source->SetLevel(MemoryPressureLevel::kNormal);
+    EXPECT_EQ(monitor.level(), MemoryPressureLevel::kNormal);
+    EXPECT_EQ(monitor.released_bytes(), 440u);
+  }
+  EXPECT_FALSE(started);
+
+  std::vector<MemoryPressureLevel> expected = {
+      MemoryPressureLevel::kModerate, MemoryPressureLevel::kCritical};
+  EXPECT_EQ(warnings, expected);
+  EXPECT_EQ(trims, expected);
+}
+
+TEST(MemoryPressureMonitorTest, IgnoresDuplicateNotifications) {
+  bool started = false;
+  auto source = std::make_unique<FakeMemoryPressureSource>(&started);
+  FakeMemoryPressureSource* fake_source = source.get();
+  size_t warning_count = 0;
+  MemoryPressureMonitor monitor(
+      std::move(source),
+      [&warning_count](MemoryPressureLevel level) { warning_count++; });
+  monitor.AddTrimmer("cache",
+                     [](MemoryPressureLevel level) -> size_t { return 10; });
+
+  // The app reports the same platform event as the source.
+  fake_source->SetLevel(MemoryPressureLevel::kModerate);
+  EXPECT_EQ(monitor.OnMemoryPressure(MemoryPressureLevel::kModerate), 0u);
+  EXPECT_EQ(warning_count, 1u);
+
+  // A higher level is handled.
+  EXPECT_EQ(monitor.OnMemoryPressure(MemoryPressureLevel::kCritical), 10u);
+  EXPECT_EQ(warning_count, 2u);
+  EXPECT_EQ(monitor.released_bytes(), 20u);
+}
+
+TEST(MemoryPressureMonitorTest, CountsAsynchronouslyReleasedBytes) {
+  MemoryPressureMonitor monitor(nullptr, nullptr);
+  monitor.AddTrimmer("async", [&monitor](MemoryPressureLevel level) -> size_t {
+    monitor.AddReleasedBytes(64);
+    return 0;
+  });
+
+  EXPECT_EQ(monitor.OnMemoryPressure(MemoryPressureLevel::kCritical), 0u);
+  EXPECT_EQ(monitor.released_bytes(), 64u);
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -0,0 +1,235 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "offscreen_surface.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#include "flutter/shell/platform/tizen/logger.h"
+#include "flutter/shell/platform/tizen/pixel_format_converter.h"
+
+namespace flutter {
+
+namespace {
+
+constexpr size_t kBytesPerPixel = 4;
+
+// The maximum length of a stored (uncompressed) deflate block.
+constexpr size_t kMaxStoredBlockLength = 65535;
+
+void AppendUint32(std::vector<uint8_t>& data, uint32_t value) {
+  data.push_back(static_cast<uint8_t>(value >> 24));
+  data.push_back(static_cast<uint8_t>(value >> 16));
+  data.push_back(static_cast<uint8_t>(value >> 8));
+  data.push_back(static_cast<uint8_t>(value));
+}
+
+uint32_t Crc32(const uint8_t* data, size_t length) {
+  static uint32_t table[256] = {};
+  static bool initialized = [] {
+    for (uint32_t i = 0; i < 256; i++) {
+      uint32_t c = i;
+      for (int k = 0; k < 8; k++) {
+        c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+      }
+      table[i] = c;
+    }
+    return true;
+  }();
+  (void)initialized;
+
+  uint32_t crc = 0xFFFFFFFFu;
+  for (size_t i = 0; i < length; i++) {
+    crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+  }
+  return crc ^ 0xFFFFFFFFu;
+}
+
+void AppendChunk(std::vector<uint8_t>& png,
+                 const char type[4],
+                 const std::vector<uint8_t>& payload) {
+  AppendUint32(png, static_cast<uint32_t>(payload.size()));
+  size_t start = png.size();
+  png.insert(png.end(), type, type + 4);
+  png.insert(png.end(), payload.begin(), payload.end());
+  AppendUint32(png, Crc32(png.data() + start, png.size() - start));
+}
+
+}  // namespace
+
+void OffscreenSurface::SetDumpDirectory(const std::string& directory,
+                                        DumpFormat format) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  dump_directory_ = directory;
+  dump_format_ = format;
+}
+
+void OffscreenSurface::SetSize(size_t width, size_t height) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  configured_width_ = width;
+  configured_height_ = height;
+}
+
+bool OffscreenSurface::Present(const void* allocation,
+                               size_t row_bytes,
+                               size_t height) {
+  if (!allocation || height == 0) {
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t width = configured_width_;
+  size_t packed_row_bytes = width * kBytesPerPixel;
+  if (width == 0 || height != configured_height_ ||
+      row_bytes < packed_row_bytes) {
+    // A frame rendered for the previous size.
+    return true;
+  }
+  frame_.resize(packed_row_bytes * height);
+  const uint8_t* source = static_cast<const uint8_t*>(allocation);
+  if (row_bytes == packed_row_bytes) {
+    memcpy(frame_.data(), source, frame_.size());
+  } else {
+    for (size_t row = 0; row < height; row++) {
+      memcpy(frame_.data() + row * packed_row_bytes, source + row * row_bytes,
+             packed_row_bytes);
+    }
+  }
+  width_ = width;
+  height_ = height;
+  frame_count_++;
+
+  if (!dump_directory_.empty()) {
+    dump_pixels_.resize(frame_.size());
+    ConvertFrame(dump_pixels_.data());
+    DumpFrame(dump_pixels_.data());
+  }
+  return true;
+}
+
+bool OffscreenSurface::CopyFrame(uint8_t* buffer,
+                                 size_t buffer_size,
+                                 size_t* width,
+                                 size_t* height) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (frame_count_ == 0) {
+    return false;
+  }
+  if (width) {
+    *width = width_;
+  }
+  if (height) {
+    *height = height_;
+  }
+  if (!buffer) {
+    return true;
+  }
+  if (buffer_size < frame_.size()) {
+    return false;
+  }
+  return ConvertFrame(buffer);
+}
+
+bool OffscreenSurface::ConvertFrame(uint8_t* buffer) const {
+  FlutterDesktopPixelBufferDescriptor descriptor = {};
+  descriptor.struct_size = sizeof(FlutterDesktopPixelBufferDescriptor);
+  descriptor.format = kFlutterDesktopPixelFormatBGRA8888;
+  descriptor.planes[0] = frame_.data();
+  descriptor.width = width_;
+  descriptor.height = height_;
+  return ConvertToRGBA(descriptor, buffer);
+}
+
+uint64_t OffscreenSurface::frame_count() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return frame_count_;
+}
+
+size_t OffscreenSurface::ReleaseCachedMemory() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t released = dump_pixels_.capacity();
+  std::vector<uint8_t>().swap(dump_pixels_);
+  return released;
+}
+
+void OffscreenSurface::DumpFrame(const uint8_t* pixels) {
+  char name[32];
+  snprintf(name, sizeof(name), "frame_%06llu.%s",
+           static_cast<unsigned long long>(frame_count_),
+           dump_format_ == DumpFormat::kPng ? "png" : "rgba");
+  std::string path = dump_directory_ + "/" + name;
+
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  if (!file.is_open()) {
+    FT_LOG(Error) << "Could not open " << path << " for writing.";
+    return;
+  }
+  if (dump_format_ == DumpFormat::kPng) {
+    std::vector<uint8_t> png = EncodePng(pixels, width_, height_);
+    file.write(reinterpret_cast<const char*>(png.data()), png.size());
+  } else {
+    file.write(reinterpret_cast<const char*>(pixels),
+               width_ * height_ * kBytesPerPixel);
+  }
+}
+
+std::vector<uint8_t> OffscreenSurface::EncodePng(const uint8_t* pixels,
+                                                 size_t width,
+                                                 size_t height) {
+  static const uint8_t kSignature[] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A,
+                                       '\n'};
+  std::vector<uint8_t> png(kSignature, kSignature + sizeof(kSignature));
+
+  std::vector<uint8_t> header;
+  AppendUint32(header, static_cast<uint32_t>(width));
+  AppendUint32(header, static_cast<uint32_t>(height));
+  header.push_back(8);  // Bit depth
+  header.push_back(6);  // Color type: RGBA
+  header.push_back(0);  // Compression method
+  header.push_back(0);  // Filter method
+  header.push_back(0);  // Interlace method
+  AppendChunk(png, "IHDR", header);
+
+  // Each scanline is preceded by a filter type byte (none).
+  size_t row_bytes = width * kBytesPerPixel;
+  std::vector<uint8_t> scanlines;
+  scanlines.reserve((row_bytes + 1) * height);
+  for (size_t row = 0; row < height; row++) {
+    scanlines.push_back(0);
+    const uint8_t* row_pixels = pixels + row * row_bytes;
+    scanlines.insert(scanlines.end(), row_pixels, row_pixels + row_bytes);
+  }
+
+  // A zlib stream of stored deflate blocks.
+  std::vector<uint8_t> data = {0x78, 0x01};
+  size_t offset = 0;
+  do {
+    size_t length = std::min(kMaxStoredBlockLength, scanlines.size() - offset);
+    bool final_block = offset + length == scanlines.size();
+    data.push_back(final_block ? 1 : 0);
+    data.push_back(static_cast<uint8_t>(length));
+    data.push_back(static_cast<uint8_t>(length >> 8));
+    data.push_back(static_cast<uint8_t>(~length));
+    data.push_back(static_cast<uint8_t>(~length >> 8));
+    data.insert(data.end(), scanlines.begin() + offset,
+                scanlines.begin() + offset + length);
+    offset += length;
+  } while (offset < scanlines.size());
+
+  uint32_t a = 1;
+  uint32_t b = 0;
+  for (uint8_t byte : scanlines) {
+    a = (a + byte) % 65521;
+    b = (b + a) % 65521;
+  }
+  AppendUint32(data, (b << 16) | a);
+  AppendChunk(png, "IDAT", data);
+  AppendChunk(png, "IEND", {});
+  return png;
+}
+
+}  // namespace flutter
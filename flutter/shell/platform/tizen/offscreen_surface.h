@@ -0,0 +1,105 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef EMBEDDER_OFFSCREEN_SURFACE_H_
+#define EMBEDDER_OFFSCREEN_SURFACE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace flutter {
+
+// The render target of a headless engine.
+//
+// Keeps a copy of the last frame presented by the engine's software
+// rasterizer, so that it can be read back on demand, and optionally writes
+// every frame to a file for golden tests.
+class OffscreenSurface {
+ public:
+  enum class DumpFormat {
+    // Files named frame_<number>.png.
+    kPng,
+    // Files named frame_<number>.rgba with tightly packed, premultiplied
+    // RGBA8888 pixels and no header.
+    kRaw,
+  };
+
+  OffscreenSurface() = default;
+
+  // Prevent copying.
+  OffscreenSurface(OffscreenSurface const&) = delete;
+  OffscreenSurface& operator=(OffscreenSurface const&) = delete;
+
+  // Writes every presented frame to |directory| in |format|. An empty
+  // |directory| disables dumping.
+  void SetDumpDirectory(const std::string& directory, DumpFormat format);
+
+  // Sets the size in pixels of the frames that the engine renders. Rows of
+  // presented frames may be padded beyond |width| pixels.
+  void SetSize(size_t width, size_t height);
+
+  // Stores a frame of |height| rows of |row_bytes| bytes in the native 32-bit
+  // premultiplied BGRA format of the software rasterizer. Only the first
+  // |width| pixels of each row, as set by SetSize(), are kept. A frame
+  // rendered for a previous size is dropped. Called on the raster thread.
+  bool Present(const void* allocation, size_t row_bytes, size_t height);
+
+  // Copies the last presented frame into |buffer| as premultiplied RGBA8888
+  // pixels with |width| * 4 bytes per row, and stores its size in |width|
+  // and |height|. If |buffer| is nullptr, only the size is returned.
+  //
+  // Returns false if no frame has been presented yet or |buffer_size| is too
+  // small.
+  bool CopyFrame(uint8_t* buffer,
+                 size_t buffer_size,
+                 size_t* width,
+                 size_t* height) const;
+
+  // The number of frames presented so far.
+  uint64_t frame_count() const;
+
+  // Releases the scratch memory used for dumping frames, which is reallocated
+  // by the next dumped frame. The last frame is kept.
+  //
+  // Returns the number of bytes released.
+  size_t ReleaseCachedMemory();
+
+  // Encodes tightly packed RGBA8888 pixels as an uncompressed PNG image.
+  static std::vector<uint8_t> EncodePng(const uint8_t* pixels,
+                                        size_t width,
+                                        size_t height);
+
+ private:
+  // Converts the last presented frame to RGBA8888 pixels in |buffer|. Called
+  // with |mutex_| held.
+  bool ConvertFrame(uint8_t* buffer) const;
+
+  // Writes |pixels| to the next dump file. Called with |mutex_| held.
+  void DumpFrame(const uint8_t* pixels);
+
+  mutable std::mutex mutex_;
+
+  // The size set by SetSize().
+  size_t configured_width_ = 0;
+  size_t configured_height_ = 0;
+
+  // The last presented frame in BGRA format, reused across frames.
+  std::vector<uint8_t> frame_;
+  size_t width_ = 0;
+  size_t height_ = 0;
+  uint64_t frame_count_ = 0;
+
+  std::string dump_directory_;
+  DumpFormat dump_format_ = DumpFormat::kPng;
+
+  // Scratch memory for converting frames to be dumped.
+  std::vector<uint8_t> dump_pixels_;
+};
+
+}  // namespace flutter
+
+#endif  // EMBEDDER_OFFSCREEN_SURFACE_H_
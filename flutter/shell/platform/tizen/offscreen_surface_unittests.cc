@@ -0,0 +1,160 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/tizen/offscreen_surface.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+constexpr size_t kWidth = 5;
+constexpr size_t kHeight = 3;
+
+std::vector<uint8_t> CreateFrame(size_t row_bytes, uint8_t seed) {
+  std::vector<uint8_t> frame(row_bytes * kHeight);
+  for (size_t i = 0; i < frame.size(); i++) {
+    frame[i] = static_cast<uint8_t>(seed + i * 3);
+  }
+  return frame;
+}
+
+std::vector<uint8_t> ReadFile(const std::string& path) {
+  std::ifstream file(path, std::ios::binary);
+  return std::vector<uint8_t>(std::istreambuf_iterator<char>(file),
+                              std::istreambuf_iterator<char>());
+}
+
+}  // namespace
+
+TEST(OffscreenSurfaceTest, NoFrameBeforePresent) {
+  OffscreenSurface surface;
+  size_t width = 0;
+  size_t height = 0;
+  EXPECT_FALSE(surface.CopyFrame(nullptr, 0, &width, &height));
+  EXPECT_EQ(surface.frame_count(), 0u);
+}
+
+TEST(OffscreenSurfaceTest, CopiesLastFrameAsRGBA) {
+  OffscreenSurface surface;
+  surface.SetSize(kWidth, kHeight);
+  size_t row_bytes = kWidth * 4 + 8;
+  std::vector<uint8_t> frame = CreateFrame(row_bytes, 1);
+  ASSERT_TRUE(surface.Present(frame.data(), row_bytes, kHeight));
+
+  size_t width = 0;
+  size_t height = 0;
+  ASSERT_TRUE(surface.CopyFrame(nullptr, 0, &width, &height));
+  EXPECT_EQ(width, kWidth);
+  EXPECT_EQ(height, kHeight);
+
+  std::vector<uint8_t> output(width * height * 4);
+  EXPECT_FALSE(surface.CopyFrame(output.data(), output.size() - 1, nullptr,
+                                 nullptr));
+  ASSERT_TRUE(
+      surface.CopyFrame(output.data(), output.size(), nullptr, nullptr));
+  // The row padding is not copied.
+  for (size_t row = 0; row < height; row++) {
+    for (size_t column = 0; column < width; column++) {
+      const uint8_t* pixel = &output[(row * width + column) * 4];
+      const uint8_t* source = &frame[row * row_bytes + column * 4];
+      EXPECT_EQ(pixel[0], source[2]);
+      EXPECT_EQ(pixel[1], source[1]);
+      EXPECT_EQ(pixel[2], source[0]);
+      EXPECT_EQ(pixel[3], source[3]);
+    }
+  }
+}
+
+TEST(OffscreenSurfaceTest, DropsFramesOfPreviousSize) {
+  OffscreenSurface surface;
+  std::vector<uint8_t> frame = CreateFrame(kWidth * 4, 1);
+  // No size has been set yet.
+  EXPECT_TRUE(surface.Present(frame.data(), kWidth * 4, kHeight));
+  EXPECT_EQ(surface.frame_count(), 0u);
+
+  surface.SetSize(kWidth, kHeight);
+  ASSERT_TRUE(surface.Present(frame.data(), kWidth * 4, kHeight));
+  EXPECT_EQ(surface.frame_count(), 1u);
+
+  // Frames rendered before the resize took effect.
+  surface.SetSize(kWidth + 1, kHeight);
+  EXPECT_TRUE(surface.Present(frame.data(), kWidth * 4, kHeight));
+  surface.SetSize(kWidth, kHeight + 1);
+  EXPECT_TRUE(surface.Present(frame.data(), kWidth * 4, kHeight));
+  EXPECT_EQ(surface.frame_count(), 1u);
+
+  size_t width = 0;
+  size_t height = 0;
+  ASSERT_TRUE(surface.CopyFrame(nullptr, 0, &width, &height));
+  EXPECT_EQ(width, kWidth);
+  EXPECT_EQ(height, kHeight);
+}
+
+TEST(OffscreenSurfaceTest, KeepsOnlyLatestFrame) {
+  OffscreenSurface surface;
+  surface.SetSize(kWidth, kHeight);
+  std::vector<uint8_t> first = CreateFrame(kWidth * 4, 1);
+  std::vector<uint8_t> second = CreateFrame(kWidth * 4, 100);
+  ASSERT_TRUE(surface.Present(first.data(), kWidth * 4, kHeight));
+  ASSERT_TRUE(surface.Present(second.data(), kWidth * 4, kHeight));
+  EXPECT_EQ(surface.frame_count(), 2u);
+
+  std::vector<uint8_t> output(kWidth * kHeight * 4);
+  ASSERT_TRUE(
+      surface.CopyFrame(output.data(), output.size(), nullptr, nullptr));
+  EXPECT_EQ(output[0], second[2]);
+  EXPECT_EQ(output[3], second[3]);
+}
+
+TEST(OffscreenSurfaceTest, EncodesPng) {
+  std::vector<uint8_t> pixels = CreateFrame(kWidth * 4, 7);
+  std::vector<uint8_t> png =
+      OffscreenSurface::EncodePng(pixels.data(), kWidth, kHeight);
+
+  const uint8_t kSignature[] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+  ASSERT_GT(png.size(), sizeof(kSignature) + 12);
+  EXPECT_TRUE(std::equal(kSignature, kSignature + sizeof(kSignature),
+                         png.begin()));
+  EXPECT_EQ(std::string(png.begin() + 12, png.begin() + 16), "IHDR");
+  EXPECT_EQ(png[19], kWidth);
+  EXPECT_EQ(png[23], kHeight);
+
+  // The IEND chunk and its well-known CRC.
+  const uint8_t kEnd[] = {0,   0,   0,   0,    'I',  'E',
+                          'N', 'D', 0xAE, 0x42, 0x60, 0x82};
+  EXPECT_TRUE(std::equal(kEnd, kEnd + sizeof(kEnd), png.end() - sizeof(kEnd)));
+}
+
+TEST(OffscreenSurfaceTest, DumpsRawFrames) {
+  char directory[] = "/tmp/offscreen_surface_XXXXXX";
+  ASSERT_NE(mkdtemp(directory), nullptr);
+
+  OffscreenSurface surface;
+  surface.SetSize(kWidth, kHeight);
+  surface.SetDumpDirectory(directory, OffscreenSurface::DumpFormat::kRaw);
+  std::vector<uint8_t> frame = CreateFrame(kWidth * 4, 1);
+  ASSERT_TRUE(surface.Present(frame.data(), kWidth * 4, kHeight));
+
+  std::string path = std::string(directory) + "/frame_000001.rgba";
+  std::vector<uint8_t> dumped = ReadFile(path);
+  std::vector<uint8_t> expected(kWidth * kHeight * 4);
+  ASSERT_TRUE(
+      surface.CopyFrame(expected.data(), expected.size(), nullptr, nullptr));
+  EXPECT_EQ(dumped, expected);
+
+  std::remove(path.c_str());
+  std::remove(directory);
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -0,0 +1,254 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "pixel_format_converter.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace flutter {
+
+namespace {
+
+// Generic vector types that are lowered to NEON on ARM and SSE on x86.
+typedef uint32_t U32x4 __attribute__((vector_size(16)));
+typedef int32_t I32x4 __attribute__((vector_size(16)));
+
+constexpr size_t kBytesPerPixel = 4;
+
+inline I32x4 Clamp(I32x4 value) {
+  value &= ~(value < 0);
+  I32x4 overflow = value > 255;
+  return (value & ~overflow) | (overflow & 255);
+}
+
+inline uint8_t Clamp(int32_t value) {
+  return static_cast<uint8_t>(value < 0 ? 0 : (value > 255 ? 255 : value));
+}
+
+// Converts a row of |width| YUV pixels to RGBA. The chroma samples of pixel x
+// are u_row[x / 2 * uv_step] and v_row[x / 2 * uv_step].
+//
+// BT.601 limited range in 8-bit fixed point:
+//   R = 1.164 (Y - 16) + 1.596 (V - 128)
+//   G = 1.164 (Y - 16) - 0.391 (U - 128) - 0.813 (V - 128)
+//   B = 1.164 (Y - 16) + 2.018 (U - 128)
+void ConvertYuvRow(const uint8_t* y_row,
+                   const uint8_t* u_row,
+                   const uint8_t* v_row,
+                   size_t uv_step,
+                   uint8_t* dst,
+                   size_t width) {
+  size_t x = 0;
+  for (; x + 4 <= width; x += 4) {
+    I32x4 y, u, v;
+    for (size_t i = 0; i < 4; i++) {
+      size_t uv_offset = (x + i) / 2 * uv_step;
+      y[i] = y_row[x + i];
+      u[i] = u_row[uv_offset];
+      v[i] = v_row[uv_offset];
+    }
+    y = (y - 16) * 298 + 128;
+    u -= 128;
+    v -= 128;
+    I32x4 r = Clamp((y + 409 * v) >> 8);
+    I32x4 g = Clamp((y - 100 * u - 208 * v) >> 8);
+    I32x4 b = Clamp((y + 516 * u) >> 8);
+    U32x4 pixels = (U32x4)r | ((U32x4)g << 8) | ((U32x4)b << 16) | 0xFF000000u;
+    memcpy(dst + x * kBytesPerPixel, &pixels, sizeof(pixels));
+  }
+  for (; x < width; x++) {
+    size_t uv_offset = x / 2 * uv_step;
+    int32_t y = (y_row[x] - 16) * 298 + 128;
+    int32_t u = u_row[uv_offset] - 128;
+    int32_t v = v_row[uv_offset] - 128;
+    uint8_t* d = dst + x * kBytesPerPixel;
+    d[0] = Clamp((y + 409 * v) >> 8);
+    d[1] = Clamp((y - 100 * u - 208 * v) >> 8);
+    d[2] = Clamp((y + 516 * u) >> 8);
+    d[3] = 255;
+  }
+}
+
+}  // namespace
+
+size_t GetPlaneCount(FlutterDesktopPixelFormat format) {
+  switch (format) {
+    case kFlutterDesktopPixelFormatRGBA8888:
+    case kFlutterDesktopPixelFormatBGRA8888:
+      return 1;
+    case kFlutterDesktopPixelFormatNV12:
+      return 2;
+    case kFlutterDesktopPixelFormatI420:
+      return 3;
+    default:
+      return 0;
+  }
+}
+
+size_t GetPlaneStride(const FlutterDesktopPixelBufferDescriptor& buffer,
+                      size_t plane) {
+  if (plane >= FLUTTER_DESKTOP_PIXEL_BUFFER_MAX_PLANES) {
+    return 0;
+  }
+  if (buffer.strides[plane] != 0) {
+    return buffer.strides[plane];
+  }
+  size_t chroma_width = (buffer.width + 1) / 2;
+  switch (buffer.format) {
+    case kFlutterDesktopPixelFormatRGBA8888:
+    case kFlutterDesktopPixelFormatBGRA8888:
+      return buffer.width * kBytesPerPixel;
+    case kFlutterDesktopPixelFormatNV12:
+      return plane == 0 ? buffer.width : chroma_width * 2;
+    case kFlutterDesktopPixelFormatI420:
+      return plane == 0 ? buffer.width : chroma_width;
+    default:
+      return 0;
+  }
+}
+
+bool IsValidPixelBuffer(const FlutterDesktopPixelBufferDescriptor& buffer) {
+  if (buffer.struct_size < sizeof(FlutterDesktopPixelBufferDescriptor) ||
+      buffer.width == 0 || buffer.height == 0) {
+    return false;
+  }
+  size_t plane_count = GetPlaneCount(buffer.format);
+  if (plane_count == 0) {
+    return false;
+  }
+  FlutterDesktopPixelBufferDescriptor packed = buffer;
+  for (size_t plane = 0; plane < plane_count; plane++) {
+    packed.strides[plane] = 0;
+    if (!buffer.planes[plane] ||
+        GetPlaneStride(buffer, plane) < GetPlaneStride(packed, plane)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool ObtainPixelBuffer(
+    FlutterDesktopPixelBufferTextureCallback callback,
+    FlutterDesktopPixelBufferDescriptorTextureCallback descriptor_callback,
+    void* user_data,
+    size_t width,
+    size_t height,
+    FlutterDesktopPixelBufferDescriptor* buffer) {
+  if (descriptor_callback) {
+    const FlutterDesktopPixelBufferDescriptor* descriptor =
+        descriptor_callback(width, height, user_data);
+    if (!descriptor) {
+      return false;
+    }
+    // The descriptor may have been built against an older, smaller version
+    // of the struct, so never read past the size it reports.
+    *buffer = {};
+    std::memcpy(buffer, descriptor,
+                std::min(descriptor->struct_size, sizeof(*buffer)));
+  } else if (callback) {
+    const FlutterDesktopPixelBuffer* pixel_buffer =
+        callback(width, height, user_data);
+    if (!pixel_buffer) {
+      return false;
+    }
+    *buffer = {};
+    buffer->struct_size = sizeof(FlutterDesktopPixelBufferDescriptor);
+    buffer->format = kFlutterDesktopPixelFormatRGBA8888;
+    buffer->planes[0] = pixel_buffer->buffer;
+    buffer->width = pixel_buffer->width;
+    buffer->height = pixel_buffer->height;
+    buffer->release_callback = pixel_buffer->release_callback;
+    buffer->release_context = pixel_buffer->release_context;
+  } else {
+    return false;
+  }
+  if (!IsValidPixelBuffer(*buffer)) {
+    if (buffer->release_callback) {
+      buffer->release_callback(buffer->release_context);
+    }
+    return false;
+  }
+  return true;
+}
+
+bool ConvertToRGBA(const FlutterDesktopPixelBufferDescriptor& buffer,
+                   uint8_t* output) {
+  if (!output || !IsValidPixelBuffer(buffer)) {
+    return false;
+  }
+  size_t width = buffer.width;
+  size_t height = buffer.height;
+  size_t output_stride = width * kBytesPerPixel;
+
+  switch (buffer.format) {
+    case kFlutterDesktopPixelFormatRGBA8888: {
+      size_t stride = GetPlaneStride(buffer, 0);
+      if (stride == output_stride) {
+        memcpy(output, buffer.planes[0], output_stride * height);
+        break;
+      }
+      for (size_t row = 0; row < height; row++) {
+        memcpy(output + row * output_stride, buffer.planes[0] + row * stride,
+               output_stride);
+      }
+      break;
+    }
+    case kFlutterDesktopPixelFormatBGRA8888: {
+      size_t stride = GetPlaneStride(buffer, 0);
+      for (size_t row = 0; row < height; row++) {
+        SwizzleRow(buffer.planes[0] + row * stride,
+                   output + row * output_stride, width);
+      }
+      break;
+    }
+    case kFlutterDesktopPixelFormatNV12: {
+      size_t y_stride = GetPlaneStride(buffer, 0);
+      size_t uv_stride = GetPlaneStride(buffer, 1);
+      for (size_t row = 0; row < height; row++) {
+        const uint8_t* uv_row = buffer.planes[1] + row / 2 * uv_stride;
+        ConvertYuvRow(buffer.planes[0] + row * y_stride, uv_row, uv_row + 1, 2,
+                      output + row * output_stride, width);
+      }
+      break;
+    }
+    case kFlutterDesktopPixelFormatI420: {
+      size_t y_stride = GetPlaneStride(buffer, 0);
+      size_t u_stride = GetPlaneStride(buffer, 1);
+      size_t v_stride = GetPlaneStride(buffer, 2);
+      for (size_t row = 0; row < height; row++) {
+        ConvertYuvRow(buffer.planes[0] + row * y_stride,
+                      buffer.planes[1] + row / 2 * u_stride,
+                      buffer.planes[2] + row / 2 * v_stride, 1,
+                      output + row * output_stride, width);
+      }
+      break;
+    }
+    default:
+      return false;
+  }
+  return true;
+}
+
+// Pixels are loaded as little-endian 32-bit words.
+void SwizzleRow(const uint8_t* src, uint8_t* dst, size_t width) {
+  size_t x = 0;
+  for (; x + 4 <= width; x += 4) {
+    U32x4 pixels;
+    memcpy(&pixels, src + x * kBytesPerPixel, sizeof(pixels));
+    pixels = (pixels & 0xFF00FF00u) | ((pixels >> 16) & 0xFFu) |
+             ((pixels & 0xFFu) << 16);
+    memcpy(dst + x * kBytesPerPixel, &pixels, sizeof(pixels));
+  }
+  for (; x < width; x++) {
+    const uint8_t* s = src + x * kBytesPerPixel;
+    uint8_t* d = dst + x * kBytesPerPixel;
+    d[0] = s[2];
+    d[1] = s[1];
+    d[2] = s[0];
+    d[3] = s[3];
+  }
+}
+
+}  // namespace flutter
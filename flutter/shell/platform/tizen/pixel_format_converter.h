@@ -0,0 +1,54 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef EMBEDDER_PIXEL_FORMAT_CONVERTER_H_
+#define EMBEDDER_PIXEL_FORMAT_CONVERTER_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "flutter/shell/platform/common/public/flutter_texture_registrar.h"
+
+namespace flutter {
+
+// Returns the number of planes of a buffer in |format|.
+size_t GetPlaneCount(FlutterDesktopPixelFormat format);
+
+// Returns the number of bytes between two rows of |plane| of |buffer|,
+// resolving a zero stride to the tightly packed stride.
+size_t GetPlaneStride(const FlutterDesktopPixelBufferDescriptor& buffer,
+                      size_t plane);
+
+// Whether |buffer| has a supported format, non-empty size, and planes and
+// strides that are large enough for its size.
+bool IsValidPixelBuffer(const FlutterDesktopPixelBufferDescriptor& buffer);
+
+// Obtains the pixel buffer of a texture frame of |width| x |height| from
+// |descriptor_callback| if set, or otherwise from |callback|, in which case the
+// buffer is described as tightly packed RGBA8888.
+//
+// Returns false if no valid buffer could be obtained. An invalid buffer is
+// released before returning.
+bool ObtainPixelBuffer(
+    FlutterDesktopPixelBufferTextureCallback callback,
+    FlutterDesktopPixelBufferDescriptorTextureCallback descriptor_callback,
+    void* user_data,
+    size_t width,
+    size_t height,
+    FlutterDesktopPixelBufferDescriptor* buffer);
+
+// Converts |buffer| to tightly packed RGBA8888 pixels. |output| must be at
+// least |width| * |height| * 4 bytes.
+//
+// YUV buffers are converted using BT.601 limited range coefficients.
+bool ConvertToRGBA(const FlutterDesktopPixelBufferDescriptor& buffer,
+                   uint8_t* output);
+
+// Swaps the red and blue channels of |width| 32-bit pixels, converting
+// between BGRA8888 and RGBA8888.
+void SwizzleRow(const uint8_t* src, uint8_t* dst, size_t width);
+
+}  // namespace flutter
+
+#endif  // EMBEDDER_PIXEL_FORMAT_CONVERTER_H_
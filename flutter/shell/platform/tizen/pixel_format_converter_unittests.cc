@@ -0,0 +1,262 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/tizen/pixel_format_converter.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+// Wide enough to cover both the vectorized and the scalar code paths.
+constexpr size_t kWidth = 13;
+constexpr size_t kHeight = 5;
+
+FlutterDesktopPixelBufferDescriptor CreateDescriptor(
+    FlutterDesktopPixelFormat format) {
+  FlutterDesktopPixelBufferDescriptor buffer = {};
+  buffer.struct_size = sizeof(FlutterDesktopPixelBufferDescriptor);
+  buffer.format = format;
+  buffer.width = kWidth;
+  buffer.height = kHeight;
+  return buffer;
+}
+
+std::vector<uint8_t> CreatePlane(size_t stride, size_t rows, uint8_t seed) {
+  std::vector<uint8_t> plane(stride * rows);
+  for (size_t i = 0; i < plane.size(); i++) {
+    plane[i] = static_cast<uint8_t>(seed + i * 7);
+  }
+  return plane;
+}
+
+// Floating-point BT.601 limited range reference.
+void ReferenceYuvToRgb(uint8_t y, uint8_t u, uint8_t v, double rgb[3]) {
+  double c = 1.164 * (y - 16);
+  rgb[0] = c + 1.596 * (v - 128);
+  rgb[1] = c - 0.391 * (u - 128) - 0.813 * (v - 128);
+  rgb[2] = c + 2.018 * (u - 128);
+  for (int i = 0; i < 3; i++) {
+    rgb[i] = std::fmin(std::fmax(rgb[i], 0.0), 255.0);
+  }
+}
+
+}  // namespace
+
+TEST(PixelFormatConverterTest, PlaneStrides) {
+  FlutterDesktopPixelBufferDescriptor buffer =
+      CreateDescriptor(kFlutterDesktopPixelFormatI420);
+  EXPECT_EQ(GetPlaneCount(buffer.format), 3u);
+  EXPECT_EQ(GetPlaneStride(buffer, 0), kWidth);
+  EXPECT_EQ(GetPlaneStride(buffer, 1), (kWidth + 1) / 2);
+
+  buffer.format = kFlutterDesktopPixelFormatNV12;
+  EXPECT_EQ(GetPlaneCount(buffer.format), 2u);
+  EXPECT_EQ(GetPlaneStride(buffer, 1), kWidth + 1);
+
+  buffer.format = kFlutterDesktopPixelFormatBGRA8888;
+  buffer.strides[0] = 64;
+  EXPECT_EQ(GetPlaneCount(buffer.format), 1u);
+  EXPECT_EQ(GetPlaneStride(buffer, 0), 64u);
+}
+
+TEST(PixelFormatConverterTest, RejectsInvalidBuffers) {
+  std::vector<uint8_t> plane(kWidth * kHeight * 4);
+  std::vector<uint8_t> output(kWidth * kHeight * 4);
+
+  FlutterDesktopPixelBufferDescriptor buffer =
+      CreateDescriptor(kFlutterDesktopPixelFormatRGBA8888);
+  buffer.planes[0] = plane.data();
+  EXPECT_TRUE(IsValidPixelBuffer(buffer));
+
+  // Stride smaller than a row.
+  buffer.strides[0] = kWidth * 4 - 1;
+  EXPECT_FALSE(IsValidPixelBuffer(buffer));
+  EXPECT_FALSE(ConvertToRGBA(buffer, output.data()));
+  buffer.strides[0] = 0;
+
+  buffer.struct_size = 0;
+  EXPECT_FALSE(IsValidPixelBuffer(buffer));
+  buffer.struct_size = sizeof(FlutterDesktopPixelBufferDescriptor);
+
+  // Missing chroma plane.
+  buffer.format = kFlutterDesktopPixelFormatNV12;
+  EXPECT_FALSE(IsValidPixelBuffer(buffer));
+
+  buffer.format = static_cast<FlutterDesktopPixelFormat>(100);
+  EXPECT_FALSE(IsValidPixelBuffer(buffer));
+}
+
+TEST(PixelFormatConverterTest, ConvertsStridedRGBA) {
+  size_t stride = kWidth * 4 + 12;
+  std::vector<uint8_t> plane = CreatePlane(stride, kHeight, 1);
+  FlutterDesktopPixelBufferDescriptor buffer =
+      CreateDescriptor(kFlutterDesktopPixelFormatRGBA8888);
+  buffer.planes[0] = plane.data();
+  buffer.strides[0] = stride;
+
+  std::vector<uint8_t> output(kWidth * kHeight * 4);
+  ASSERT_TRUE(ConvertToRGBA(buffer, output.data()));
+  for (size_t row = 0; row < kHeight; row++) {
+    for (size_t i = 0; i < kWidth * 4; i++) {
+      EXPECT_EQ(output[row * kWidth * 4 + i], plane[row * stride + i]);
+    }
+  }
+}
+
+TEST(PixelFormatConverterTest, ConvertsStridedBGRA) {
+  size_t stride = kWidth * 4 + 4;
+  std::vector<uint8_t> plane = CreatePlane(stride, kHeight, 3);
+  FlutterDesktopPixelBufferDescriptor buffer =
+      CreateDescriptor(kFlutterDesktopPixelFormatBGRA8888);
+  buffer.planes[0] = plane.data();
+  buffer.strides[0] = stride;
+
+  std::vector<uint8_t> output(kWidth * kHeight * 4);
+  ASSERT_TRUE(ConvertToRGBA(buffer, output.data()));
+  for (size_t row = 0; row < kHeight; row++) {
+    for (size_t x = 0; x < kWidth; x++) {
+      const uint8_t* src = &plane[row * stride + x * 4];
+      const uint8_t* dst = &output[(row * kWidth + x) * 4];
+      EXPECT_EQ(dst[0], src[2]);
+      EXPECT_EQ(dst[1], src[1]);
+      EXPECT_EQ(dst[2], src[0]);
+      EXPECT_EQ(dst[3], src[3]);
+    }
+  }
+}
+
+TEST(PixelFormatConverterTest, ConvertsNV12) {
+  size_t y_stride = kWidth + 3;
+  size_t uv_stride = kWidth + 5;
+  size_t chroma_height = (kHeight + 1) / 2;
+  std::vector<uint8_t> y_plane = CreatePlane(y_stride, kHeight, 10);
+  std::vector<uint8_t> uv_plane = CreatePlane(uv_stride, chroma_height, 90);
+  FlutterDesktopPixelBufferDescriptor buffer =
+      CreateDescriptor(kFlutterDesktopPixelFormatNV12);
+  buffer.planes[0] = y_plane.data();
+  buffer.planes[1] = uv_plane.data();
+  buffer.strides[0] = y_stride;
+  buffer.strides[1] = uv_stride;
+
+  std::vector<uint8_t> output(kWidth * kHeight * 4);
+  ASSERT_TRUE(ConvertToRGBA(buffer, output.data()));
+  for (size_t row = 0; row < kHeight; row++) {
+    for (size_t x = 0; x < kWidth; x++) {
+      const uint8_t* uv = &uv_plane[row / 2 * uv_stride + x / 2 * 2];
+      double expected[3];
+      ReferenceYuvToRgb(y_plane[row * y_stride + x], uv[0], uv[1], expected);
+      const uint8_t* pixel = &output[(row * kWidth + x) * 4];
+      for (int c = 0; c < 3; c++) {
+        EXPECT_NEAR(pixel[c], expected[c], 2.0);
+      }
+      EXPECT_EQ(pixel[3], 255);
+    }
+  }
+}
+
+TEST(PixelFormatConverterTest, I420MatchesNV12) {
+  size_t chroma_width = (kWidth + 1) / 2;
+  size_t chroma_height = (kHeight + 1) / 2;
+  std::vector<uint8_t> y_plane = CreatePlane(kWidth, kHeight, 20);
+  std::vector<uint8_t> u_plane = CreatePlane(chroma_width, chroma_height, 40);
+  std::vector<uint8_t> v_plane = CreatePlane(chroma_width, chroma_height, 200);
+  std::vector<uint8_t> uv_plane(chroma_width * 2 * chroma_height);
+  for (size_t i = 0; i < u_plane.size(); i++) {
+    uv_plane[i * 2] = u_plane[i];
+    uv_plane[i * 2 + 1] = v_plane[i];
+  }
+
+  FlutterDesktopPixelBufferDescriptor i420 =
+      CreateDescriptor(kFlutterDesktopPixelFormatI420);
+  i420.planes[0] = y_plane.data();
+  i420.planes[1] = u_plane.data();
+  i420.planes[2] = v_plane.data();
+  FlutterDesktopPixelBufferDescriptor nv12 =
+      CreateDescriptor(kFlutterDesktopPixelFormatNV12);
+  nv12.planes[0] = y_plane.data();
+  nv12.planes[1] = uv_plane.data();
+
+  std::vector<uint8_t> i420_output(kWidth * kHeight * 4);
+  std::vector<uint8_t> nv12_output(kWidth * kHeight * 4);
+  ASSERT_TRUE(ConvertToRGBA(i420, i420_output.data()));
+  ASSERT_TRUE(ConvertToRGBA(nv12, nv12_output.data()));
+  EXPECT_EQ(i420_output, nv12_output);
+}
+
+TEST(PixelFormatConverterTest, ObtainPixelBuffer) {
+  std::vector<uint8_t> plane(kWidth * kHeight * 4);
+  FlutterDesktopPixelBuffer legacy = {};
+  legacy.buffer = plane.data();
+  legacy.width = kWidth;
+  legacy.height = kHeight;
+
+  FlutterDesktopPixelBufferDescriptor buffer;
+  ASSERT_TRUE(ObtainPixelBuffer(
+      [](size_t width, size_t height, void* user_data) {
+        return static_cast<const FlutterDesktopPixelBuffer*>(user_data);
+      },
+      nullptr, &legacy, 0, 0, &buffer));
+  EXPECT_EQ(buffer.format, kFlutterDesktopPixelFormatRGBA8888);
+  EXPECT_EQ(buffer.planes[0], plane.data());
+  EXPECT_EQ(buffer.width, kWidth);
+  EXPECT_EQ(buffer.height, kHeight);
+
+  // An invalid descriptor is released.
+  struct Context {
+    FlutterDesktopPixelBufferDescriptor descriptor;
+    bool released = false;
+  } context;
+  context.descriptor = CreateDescriptor(kFlutterDesktopPixelFormatNV12);
+  context.descriptor.planes[0] = plane.data();
+  context.descriptor.release_callback = [](void* release_context) {
+    static_cast<Context*>(release_context)->released = true;
+  };
+  context.descriptor.release_context = &context;
+  EXPECT_FALSE(ObtainPixelBuffer(
+      nullptr,
+      [](size_t width, size_t height,
+         void* user_data) -> const FlutterDesktopPixelBufferDescriptor* {
+        return &static_cast<Context*>(user_data)->descriptor;
+      },
+      &context, 0, 0, &buffer));
+  EXPECT_TRUE(context.released);
+}
+
+TEST(PixelFormatConverterTest, ObtainPixelBufferWithShortDescriptor) {
+  // Only the fields up to |planes| are readable. Anything past them must not
+  // be copied.
+  constexpr size_t kShortSize =
+      offsetof(FlutterDesktopPixelBufferDescriptor, strides);
+  alignas(FlutterDesktopPixelBufferDescriptor) uint8_t
+      storage[sizeof(FlutterDesktopPixelBufferDescriptor)];
+  std::memset(storage, 0xff, sizeof(storage));
+  FlutterDesktopPixelBufferDescriptor descriptor =
+      CreateDescriptor(kFlutterDesktopPixelFormatRGBA8888);
+  descriptor.struct_size = kShortSize;
+  std::memcpy(storage, &descriptor, kShortSize);
+
+  FlutterDesktopPixelBufferDescriptor buffer;
+  EXPECT_FALSE(ObtainPixelBuffer(
+      nullptr,
+      [](size_t width, size_t height,
+         void* user_data) -> const FlutterDesktopPixelBufferDescriptor* {
+        return static_cast<const FlutterDesktopPixelBufferDescriptor*>(
+            user_data);
+      },
+      storage, 0, 0, &buffer));
+  EXPECT_EQ(buffer.struct_size, kShortSize);
+  EXPECT_EQ(buffer.width, 0u);
+  EXPECT_EQ(buffer.release_callback, nullptr);
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -21,6 +21,10 @@ extern "C" {
 struct FlutterDesktopEngine;
 typedef struct FlutterDesktopEngine* FlutterDesktopEngineRef;
 
+// Opaque reference to a pool of prewarmed Flutter engine instances.
+struct FlutterDesktopEnginePool;
+typedef struct FlutterDesktopEnginePool* FlutterDesktopEnginePoolRef;
+
 // Opaque reference to a Flutter view instance.
 struct FlutterDesktopView;
 typedef struct FlutterDesktopView* FlutterDesktopViewRef;
@@ -30,6 +34,10 @@ typedef enum {
   kEvasGL,
   // The renderer based on EGL.
   kEGL,
+  // The renderer that rasterizes on the CPU, for devices without usable GL.
+  // Requires an Elementary window or view. External textures are not
+  // supported.
+  kCPU,
 } FlutterDesktopRendererType;
 
 typedef enum {
@@ -45,6 +53,17 @@ typedef enum {
   kHDMI,
 } FlutterDesktopExternalOutputType;
 
+typedef enum {
+  // The system has enough free memory.
+  kFlutterDesktopMemoryPressureNormal,
+  // The system is running low on memory, such as on APP_EVENT_LOW_MEMORY with
+  // APP_EVENT_LOW_MEMORY_SOFT_WARNING.
+  kFlutterDesktopMemoryPressureModerate,
+  // The system is about to kill processes to reclaim memory, such as on
+  // APP_EVENT_LOW_MEMORY with APP_EVENT_LOW_MEMORY_HARD_WARNING.
+  kFlutterDesktopMemoryPressureCritical,
+} FlutterDesktopMemoryPressureLevel;
+
 // Properties for configuring the initial settings of a Flutter window.
 typedef struct {
   // The x-coordinate of the top left corner of the window.
@@ -106,6 +125,67 @@ typedef struct {
   const char** dart_entrypoint_argv;
 } FlutterDesktopEngineProperties;
 
+// The number of buckets in the frame statistics histograms.
+#define FLUTTER_DESKTOP_FRAME_HISTOGRAM_SIZE 12
+
+// Timestamps of a single presented frame, in nanoseconds in the engine's time
+// base (see FlutterEngineGetCurrentTime).
+typedef struct {
+  // The start time of the vblank the frame was produced for, or zero if the
+  // renderer is not driven by the embedder's vsync waiter.
+  uint64_t vsync_time;
+  // The time by which the frame was expected to be presented.
+  uint64_t target_time;
+  // The time the raster thread made the onscreen context current for the
+  // frame.
+  uint64_t make_current_time;
+  // The time right before the buffer was presented (e.g. eglSwapBuffers).
+  uint64_t present_begin_time;
+  // The time right after the buffer was presented.
+  uint64_t present_end_time;
+} FlutterDesktopFrameTiming;
+
+// Aggregated frame statistics of an engine instance.
+//
+// The histogram buckets have the upper bounds (in milliseconds) of
+// 4, 8, 12, 16, 20, 25, 33, 50, 67, 100 and 200, and the last bucket counts
+// all remaining samples.
+typedef struct {
+  // The number of presented frames.
+  uint64_t frame_count;
+  // The number of frames that were presented after their target time.
+  uint64_t janky_frame_count;
+  // The total number of vblanks missed by late frames.
+  uint64_t missed_vblank_count;
+  // The average and maximum time from vblank to the end of presentation.
+  uint64_t average_present_latency_nanos;
+  uint64_t max_present_latency_nanos;
+  // The average and maximum time spent presenting a buffer.
+  uint64_t average_swap_duration_nanos;
+  uint64_t max_swap_duration_nanos;
+  // The distribution of present latencies.
+  uint64_t present_latency_histogram[FLUTTER_DESKTOP_FRAME_HISTOGRAM_SIZE];
+  // The distribution of swap durations.
+  uint64_t swap_duration_histogram[FLUTTER_DESKTOP_FRAME_HISTOGRAM_SIZE];
+} FlutterDesktopFrameStatistics;
+
+// Frame counters of an external texture.
+typedef struct {
+  // The number of times a new frame was marked available by the producer.
+  uint64_t frame_available_count;
+  // The number of frames that were superseded by a newer frame before the
+  // engine populated the texture.
+  uint64_t dropped_frame_count;
+  // The number of times the engine populated the texture.
+  uint64_t populated_frame_count;
+} FlutterDesktopTextureFrameStatistics;
+
+// Called on the platform thread once an additional view has been added to its
+// engine, with whether it was added.
+typedef void (*FlutterDesktopViewAddedCallback)(FlutterDesktopViewRef view,
+                                                bool added,
+                                                void* user_data);
+
 // ========== Engine ==========
 
 // Creates a Flutter engine with the given properties.
@@ -124,6 +204,26 @@ FLUTTER_EXPORT bool FlutterDesktopEngineRun(
 FLUTTER_EXPORT void FlutterDesktopEngineShutdown(
     FlutterDesktopEngineRef engine);
 
+// Creates a pool that keeps up to |size| engines with the given properties
+// initialized in advance. Engines are prewarmed while the main loop is idle
+// and share the same AOT data.
+FLUTTER_EXPORT FlutterDesktopEnginePoolRef FlutterDesktopEnginePoolCreate(
+    const FlutterDesktopEngineProperties& engine_properties,
+    size_t size);
+
+// Takes an engine out of the pool, creating a new one if none is available.
+//
+// The returned engine is owned by the caller and must be shut down with
+// FlutterDesktopEngineShutdown. It must be used with a view, and only views
+// using the EGL renderer benefit from prewarming.
+FLUTTER_EXPORT FlutterDesktopEngineRef
+FlutterDesktopEnginePoolAcquire(FlutterDesktopEnginePoolRef pool);
+
+// Destroys the pool and the engines remaining in it. Engines acquired from
+// the pool are not affected.
+FLUTTER_EXPORT void FlutterDesktopEnginePoolDestroy(
+    FlutterDesktopEnginePoolRef pool);
+
 // Returns the plugin registrar handle for the plugin with the given name.
 //
 // The name must be unique across the application.
@@ -144,10 +244,87 @@ FLUTTER_EXPORT void FlutterDesktopEngineNotifyAppControl(
 FLUTTER_EXPORT void FlutterDesktopEngineNotifyLocaleChange(
     FlutterDesktopEngineRef engine);
 
-// Posts a low memory notification to the engine instance.
+// Posts a low memory notification to the engine instance, and releases
+// memory held by the embedder as on critical memory pressure.
 FLUTTER_EXPORT void FlutterDesktopEngineNotifyLowMemoryWarning(
     FlutterDesktopEngineRef engine);
 
+// Notifies the engine instance of a change of the memory pressure level.
+//
+// The engine also monitors the low memory level of the system by itself, so
+// this is only needed for pressure the system doesn't report. Releases caches
+// of the engine and the embedder, such as the scratch buffers of idle textures,
+// and returns the number of bytes released by the embedder synchronously.
+// Texture buffers are released later on the render thread, so they are only
+// counted by FlutterDesktopEngineGetReleasedMemoryBytes.
+FLUTTER_EXPORT size_t FlutterDesktopEngineNotifyMemoryPressure(
+    FlutterDesktopEngineRef engine,
+    FlutterDesktopMemoryPressureLevel level);
+
+// Returns the total number of bytes released by the embedder on memory
+// pressure since the engine was run, including the texture buffers released
+// on the render thread.
+FLUTTER_EXPORT size_t FlutterDesktopEngineGetReleasedMemoryBytes(
+    FlutterDesktopEngineRef engine);
+
+// Starts or stops collecting frame statistics for the engine instance.
+//
+// Collection is disabled by default and has negligible overhead while
+// disabled.
+FLUTTER_EXPORT void FlutterDesktopEngineSetFrameStatisticsEnabled(
+    FlutterDesktopEngineRef engine,
+    bool enabled);
+
+// Retrieves the frame statistics collected since the last reset.
+//
+// Returns false if the statistics are not available.
+FLUTTER_EXPORT bool FlutterDesktopEngineGetFrameStatistics(
+    FlutterDesktopEngineRef engine,
+    FlutterDesktopFrameStatistics* statistics);
+
+// Copies up to |max_count| most recent frame timings into |timings| in
+// chronological order.
+//
+// Returns the number of copied entries.
+FLUTTER_EXPORT size_t
+FlutterDesktopEngineGetFrameTimings(FlutterDesktopEngineRef engine,
+                                    FlutterDesktopFrameTiming* timings,
+                                    size_t max_count);
+
+// Discards the frame statistics collected so far.
+FLUTTER_EXPORT void FlutterDesktopEngineResetFrameStatistics(
+    FlutterDesktopEngineRef engine);
+
+// Sets the size of the offscreen surface that a headless engine renders to,
+// in physical pixels. The engine does not render any frame until a size is
+// set.
+//
+// The engine must be running in headless mode.
+FLUTTER_EXPORT void FlutterDesktopEngineSetOffscreenSize(
+    FlutterDesktopEngineRef engine,
+    int32_t width,
+    int32_t height,
+    double pixel_ratio);
+
+// Copies the last frame rendered by a headless engine into |buffer| as
+// tightly packed RGBA8888 pixels with premultiplied alpha, and stores its
+// size in |width| and |height|, which is the size set by
+// FlutterDesktopEngineSetOffscreenSize. If |buffer| is null, only the size is retrieved, so that a buffer
+// of |width| * |height| * 4 bytes can be allocated.
+//
+// Returns false if the engine is not headless, no frame has been rendered yet
+// or |buffer_size| is too small.
+//
+// The engine can also dump every frame to a directory given by the
+// --tizen-offscreen-dump-dir engine switch, in the format given by
+// --tizen-offscreen-dump-format (png, the default, or raw).
+FLUTTER_EXPORT bool FlutterDesktopEngineCopyOffscreenFrame(
+    FlutterDesktopEngineRef engine,
+    uint8_t* buffer,
+    size_t buffer_size,
+    size_t* width,
+    size_t* height);
+
 // Notifies the engine that the app is in an inactive state and not receiving
 // user input.
 FLUTTER_EXPORT void FlutterDesktopEngineNotifyAppIsInactive(
@@ -194,12 +371,43 @@ FLUTTER_EXPORT FlutterDesktopViewRef FlutterDesktopViewCreateFromImageView(
     void* native_image_queue,
     int32_t default_window_id);
 
+// Creates an additional view that displays the given engine instance in a new
+// window, next to the view the engine was created with.
+//
+// The engine must be running with a view that uses the software or the EGL
+// renderer, and |window_properties| must specify the same renderer type. For
+// the EGL renderer, the engine must have been run with the
+// --tizen-multi-view argument, which makes it render through textures that
+// are drawn into the window of each view.
+//
+// The view is added to the engine asynchronously, and |callback| is called
+// with |user_data| once it is. If it couldn't be added, the view displays
+// nothing and must be destroyed.
+//
+// The engine is not owned by the returned view. If the view owning the engine
+// is destroyed first, the returned view stops displaying and handling input,
+// and must still be destroyed with FlutterDesktopViewDestroy.
+//
+// Returns nullptr if the view cannot be added to the engine, in which case
+// |callback| is not called.
+// @warning This API is a work-in-progress and may change.
+FLUTTER_EXPORT FlutterDesktopViewRef
+FlutterDesktopViewCreateAdditionalFromNewWindow(
+    const FlutterDesktopWindowProperties& window_properties,
+    FlutterDesktopEngineRef engine,
+    FlutterDesktopViewAddedCallback callback,
+    void* user_data);
+
 // Destroys the view.
 //
-// The engine owned by the view will also be shut down implicitly.
+// The engine owned by the view will also be shut down implicitly. An
+// additional view is removed from its engine instead.
 // @warning This API is a work-in-progress and may change.
 FLUTTER_EXPORT void FlutterDesktopViewDestroy(FlutterDesktopViewRef view);
 
+// Returns the ID of the view, which identifies the view in the framework.
+FLUTTER_EXPORT int64_t FlutterDesktopViewGetId(FlutterDesktopViewRef view);
+
 // Returns a native UI toolkit handle for manipulation in host application.
 //
 // Cast the returned void*
@@ -250,6 +458,17 @@ FLUTTER_EXPORT bool FlutterDesktopViewIsFocused(FlutterDesktopViewRef view);
 FLUTTER_EXPORT FlutterDesktopViewRef FlutterDesktopPluginRegistrarGetView(
     FlutterDesktopPluginRegistrarRef registrar);
 
+// ========== Texture Registrar (extensions) ==========
+
+// Copies the frame counters of the texture identified by |texture_id| into
+// |statistics|.
+//
+// Returns false if no such texture is registered.
+FLUTTER_EXPORT bool FlutterDesktopTextureRegistrarGetFrameStatistics(
+    FlutterDesktopTextureRegistrarRef texture_registrar,
+    int64_t texture_id,
+    FlutterDesktopTextureFrameStatistics* statistics);
+
 #if defined(__cplusplus)
 }  // extern "C"
 #endif
@@ -0,0 +1,85 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "resize_coordinator.h"
+
+#include <utility>
+
+namespace flutter {
+
+namespace {
+
+// Stale frames are dropped at most this many times per resize, in case the
+// engine never renders a frame of the expected size.
+constexpr int kMaxDroppedFrames = 3;
+
+uint64_t PackSize(uint64_t width, uint64_t height) {
+  return (width << 32) | (height & 0xffffffff);
+}
+
+bool operator==(const TizenGeometry& a, const TizenGeometry& b) {
+  return a.left == b.left && a.top == b.top && a.width == b.width &&
+         a.height == b.height;
+}
+
+}  // namespace
+
+ResizeCoordinator::ResizeCoordinator(ApplyCallback apply,
+                                     ScheduleCallback schedule)
+    : apply_(std::move(apply)), schedule_(std::move(schedule)) {}
+
+void ResizeCoordinator::RequestResize(const TizenGeometry& geometry) {
+  pending_geometry_ = geometry;
+  ScheduleFlush();
+}
+
+void ResizeCoordinator::RequestRotation(int32_t degree,
+                                        const TizenGeometry& geometry) {
+  pending_degree_ = degree;
+  pending_geometry_ = geometry;
+  ScheduleFlush();
+}
+
+void ResizeCoordinator::Flush() {
+  flush_scheduled_ = false;
+  if (applied_ && pending_geometry_ == applied_geometry_ &&
+      pending_degree_ == applied_degree_) {
+    return;
+  }
+  applied_ = true;
+  applied_geometry_ = pending_geometry_;
+  applied_degree_ = pending_degree_;
+
+  int32_t frame_width = pending_geometry_.width;
+  int32_t frame_height = pending_geometry_.height;
+  apply_(applied_geometry_, applied_degree_, &frame_width, &frame_height);
+  dropped_frames_ = 0;
+  frame_size_ = PackSize(frame_width, frame_height);
+}
+
+bool ResizeCoordinator::ShouldPresentFrame(size_t width, size_t height) {
+  uint64_t frame_size = frame_size_;
+  if (frame_size == 0) {
+    return true;
+  }
+  if (frame_size == PackSize(width, height) ||
+      ++dropped_frames_ > kMaxDroppedFrames) {
+    // Frames are rendered in order, so no stale frame follows.
+    frame_size_.compare_exchange_strong(frame_size, 0);
+    return true;
+  }
+  return false;
+}
+
+void ResizeCoordinator::ScheduleFlush() {
+  if (flush_scheduled_) {
+    return;
+  }
+  flush_scheduled_ = true;
+  if (schedule_) {
+    schedule_();
+  }
+}
+
+}  // namespace flutter
@@ -0,0 +1,99 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef EMBEDDER_RESIZE_COORDINATOR_H_
+#define EMBEDDER_RESIZE_COORDINATOR_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "flutter/shell/platform/tizen/tizen_view_base.h"
+
+namespace flutter {
+
+// Coalesces the resize and rotation events of a view so that the surface is
+// resized and the window metrics are sent at most once per frame.
+//
+// Window managers send a burst of configure events during animated window
+// transitions. Each request only updates the pending geometry, which is
+// applied when the flush scheduled by the first request runs. A flush whose
+// geometry and rotation are unchanged does nothing, so the surface is reused.
+//
+// Frames rendered for a previous size are still in the pipeline when the new
+// metrics are sent. ShouldPresentFrame filters them out so that a stale-sized
+// frame is never presented on the resized surface.
+class ResizeCoordinator {
+ public:
+  // Resizes the surface to |geometry| rotated by |degree| and sends the
+  // window metrics. Returns the size of the frames expected from the engine,
+  // in physical pixels.
+  using ApplyCallback =
+      std::function<void(const TizenGeometry& geometry,
+                         int32_t degree,
+                         int32_t* frame_width,
+                         int32_t* frame_height)>;
+
+  // Arranges for Flush to be called on the platform thread before the next
+  // frame, typically on the next vsync.
+  using ScheduleCallback = std::function<void()>;
+
+  ResizeCoordinator(ApplyCallback apply, ScheduleCallback schedule);
+
+  // Prevent copying.
+  ResizeCoordinator(ResizeCoordinator const&) = delete;
+  ResizeCoordinator& operator=(ResizeCoordinator const&) = delete;
+
+  // Requests the surface to be resized to |geometry|.
+  void RequestResize(const TizenGeometry& geometry);
+
+  // Requests the surface to be rotated by |degree|. |geometry| is the
+  // geometry of the view when rotated.
+  void RequestRotation(int32_t degree, const TizenGeometry& geometry);
+
+  // Applies the pending geometry, if changed. Called by the scheduled flush,
+  // or directly when the metrics must be sent synchronously.
+  void Flush();
+
+  // Forgets the applied geometry so that the next flush applies the pending
+  // geometry even if unchanged.
+  void Reset() { applied_ = false; }
+
+  // Whether a flush has been scheduled but not run yet.
+  bool flush_scheduled() const { return flush_scheduled_; }
+
+  // Whether a frame of |width| x |height| may be presented. Frames whose size
+  // doesn't match the last applied geometry are dropped until the first frame
+  // of the new size arrives, or too many frames have been dropped.
+  //
+  // Called on the raster thread.
+  bool ShouldPresentFrame(size_t width, size_t height);
+
+ private:
+  void ScheduleFlush();
+
+  ApplyCallback apply_;
+  ScheduleCallback schedule_;
+
+  TizenGeometry pending_geometry_;
+  int32_t pending_degree_ = 0;
+
+  bool applied_ = false;
+  TizenGeometry applied_geometry_;
+  int32_t applied_degree_ = 0;
+
+  bool flush_scheduled_ = false;
+
+  // The expected frame width and height packed into 64 bits so that they are
+  // updated atomically. Zero if any frame may be presented.
+  std::atomic<uint64_t> frame_size_ = 0;
+
+  // The number of frames dropped since the last geometry was applied.
+  std::atomic<int> dropped_frames_ = 0;
+};
+
+}  // namespace flutter
+
+#endif  // EMBEDDER_RESIZE_COORDINATOR_H_
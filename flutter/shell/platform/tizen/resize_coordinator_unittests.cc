@@ -0,0 +1,106 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/tizen/resize_coordinator.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+struct AppliedGeometry {
+  TizenGeometry geometry;
+  int32_t degree;
+};
+
+}  // namespace
+
+class ResizeCoordinatorTest : public ::testing::Test {
+ protected:
+  ResizeCoordinator coordinator_{
+      [this](const TizenGeometry& geometry, int32_t degree,
+             int32_t* frame_width, int32_t* frame_height) {
+        applied_.push_back({geometry, degree});
+        if (degree == 90 || degree == 270) {
+          std::swap(*frame_width, *frame_height);
+        }
+      },
+      [this]() { schedule_count_++; }};
+
+  std::vector<AppliedGeometry> applied_;
+  size_t schedule_count_ = 0;
+};
+
+TEST_F(ResizeCoordinatorTest, CoalescesRequestsUntilFlush) {
+  coordinator_.RequestResize({0, 0, 100, 200});
+  coordinator_.RequestResize({0, 0, 110, 210});
+  coordinator_.RequestRotation(90, {0, 0, 120, 220});
+  EXPECT_EQ(schedule_count_, 1u);
+  EXPECT_TRUE(coordinator_.flush_scheduled());
+  EXPECT_TRUE(applied_.empty());
+
+  coordinator_.Flush();
+  EXPECT_FALSE(coordinator_.flush_scheduled());
+  ASSERT_EQ(applied_.size(), 1u);
+  EXPECT_EQ(applied_[0].geometry.width, 120);
+  EXPECT_EQ(applied_[0].geometry.height, 220);
+  EXPECT_EQ(applied_[0].degree, 90);
+
+  // A new request schedules another flush.
+  coordinator_.RequestResize({0, 0, 130, 230});
+  EXPECT_EQ(schedule_count_, 2u);
+}
+
+TEST_F(ResizeCoordinatorTest, SkipsUnchangedGeometry) {
+  coordinator_.RequestResize({0, 0, 100, 200});
+  coordinator_.Flush();
+  ASSERT_EQ(applied_.size(), 1u);
+
+  // Resized back and forth within a frame.
+  coordinator_.RequestResize({0, 0, 150, 200});
+  coordinator_.RequestResize({0, 0, 100, 200});
+  coordinator_.Flush();
+  EXPECT_EQ(applied_.size(), 1u);
+
+  coordinator_.Reset();
+  coordinator_.Flush();
+  EXPECT_EQ(applied_.size(), 2u);
+}
+
+TEST_F(ResizeCoordinatorTest, DropsStaleFrames) {
+  // Any frame is presented before the first geometry is applied.
+  EXPECT_TRUE(coordinator_.ShouldPresentFrame(10, 10));
+
+  coordinator_.RequestResize({0, 0, 100, 200});
+  coordinator_.Flush();
+  EXPECT_FALSE(coordinator_.ShouldPresentFrame(10, 10));
+  EXPECT_TRUE(coordinator_.ShouldPresentFrame(100, 200));
+  // Frames are no longer filtered once the expected frame has arrived.
+  EXPECT_TRUE(coordinator_.ShouldPresentFrame(10, 10));
+
+  // The frame size is given by the apply callback.
+  coordinator_.RequestRotation(270, {0, 0, 100, 200});
+  coordinator_.Flush();
+  EXPECT_FALSE(coordinator_.ShouldPresentFrame(100, 200));
+  EXPECT_TRUE(coordinator_.ShouldPresentFrame(200, 100));
+}
+
+TEST_F(ResizeCoordinatorTest, StopsDroppingFramesAfterLimit) {
+  coordinator_.RequestResize({0, 0, 100, 200});
+  coordinator_.Flush();
+  size_t dropped = 0;
+  while (!coordinator_.ShouldPresentFrame(10, 10)) {
+    dropped++;
+    ASSERT_LT(dropped, 10u);
+  }
+  EXPECT_GT(dropped, 0u);
+  EXPECT_TRUE(coordinator_.ShouldPresentFrame(10, 10));
+}
+
+}  // namespace testing
+}  // namespace flutter
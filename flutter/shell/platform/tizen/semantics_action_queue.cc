@@ -0,0 +1,60 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/tizen/semantics_action_queue.h"
+
+#include <vector>
+
+namespace flutter {
+
+SemanticsActionQueue::SemanticsActionQueue(DispatchCallback dispatch)
+    : dispatch_(std::move(dispatch)) {}
+
+void SemanticsActionQueue::Dispatch(uint64_t target,
+                                    FlutterSemanticsAction action,
+                                    fml::MallocMapping data) {
+  if (!IsRepeatable(action)) {
+    dispatch_(target, action, std::move(data));
+    return;
+  }
+  auto [iter, inserted] = in_flight_.try_emplace({target, action}, 0);
+  if (inserted) {
+    dispatch_(target, action, std::move(data));
+  } else if (iter->second < kMaxHeldActions) {
+    iter->second++;
+  }
+}
+
+void SemanticsActionQueue::Flush() {
+  // Sending an action may re-enter |Dispatch|, so collect them first.
+  std::vector<std::pair<uint64_t, FlutterSemanticsAction>> actions;
+  for (auto iter = in_flight_.begin(); iter != in_flight_.end();) {
+    if (iter->second == 0) {
+      iter = in_flight_.erase(iter);
+      continue;
+    }
+    iter->second--;
+    actions.push_back(iter->first);
+    ++iter;
+  }
+  for (const auto& [target, action] : actions) {
+    dispatch_(target, action, fml::MallocMapping());
+  }
+}
+
+bool SemanticsActionQueue::IsRepeatable(FlutterSemanticsAction action) {
+  switch (action) {
+    case kFlutterSemanticsActionScrollLeft:
+    case kFlutterSemanticsActionScrollRight:
+    case kFlutterSemanticsActionScrollUp:
+    case kFlutterSemanticsActionScrollDown:
+    case kFlutterSemanticsActionIncrease:
+    case kFlutterSemanticsActionDecrease:
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace flutter
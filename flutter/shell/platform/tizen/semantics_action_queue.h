@@ -0,0 +1,66 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef EMBEDDER_SEMANTICS_ACTION_QUEUE_H_
+#define EMBEDDER_SEMANTICS_ACTION_QUEUE_H_
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <utility>
+
+#include "flutter/fml/mapping.h"
+#include "flutter/shell/platform/embedder/embedder.h"
+
+namespace flutter {
+
+// Paces the semantics actions sent to the framework.
+//
+// Holding a remote key repeats an action such as scrolling many times per
+// second, faster than the framework can apply it. The framework's actions
+// take no count, so repeats can't be merged into a single action. Instead,
+// only one repeatable action per node is sent at a time and the repeats that
+// arrive before the next |Flush| are held, up to |kMaxHeldActions|. Any other
+// action is sent right away.
+class SemanticsActionQueue {
+ public:
+  using DispatchCallback = std::function<
+      void(uint64_t target, FlutterSemanticsAction, fml::MallocMapping data)>;
+
+  // The maximum number of repeats held for a node and action. Further repeats
+  // are dropped so that the framework stops soon after the key is released.
+  static constexpr size_t kMaxHeldActions = 2;
+
+  explicit SemanticsActionQueue(DispatchCallback dispatch);
+
+  // Prevent copying.
+  SemanticsActionQueue(SemanticsActionQueue const&) = delete;
+  SemanticsActionQueue& operator=(SemanticsActionQueue const&) = delete;
+
+  // Sends |action| to the node |target|, or holds it if the same action is
+  // already in flight for the node.
+  void Dispatch(uint64_t target,
+                FlutterSemanticsAction action,
+                fml::MallocMapping data);
+
+  // Sends one held repeat of every action in flight. Called when the
+  // framework has had a chance to apply the actions sent so far.
+  void Flush();
+
+  // Whether any action is in flight, so that |Flush| has to be called again.
+  bool HasPendingActions() const { return !in_flight_.empty(); }
+
+ private:
+  static bool IsRepeatable(FlutterSemanticsAction action);
+
+  DispatchCallback dispatch_;
+
+  // The number of held repeats of each repeatable action in flight. Repeats
+  // carry no data.
+  std::map<std::pair<uint64_t, FlutterSemanticsAction>, size_t> in_flight_;
+};
+
+}  // namespace flutter
+
+#endif  // EMBEDDER_SEMANTICS_ACTION_QUEUE_H_
@@ -0,0 +1,89 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/tizen/semantics_action_queue.h"
+
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+using Action = std::pair<uint64_t, FlutterSemanticsAction>;
+
+}  // namespace
+
+TEST(SemanticsActionQueueTest, SendsOtherActionsRightAway) {
+  std::vector<Action> sent;
+  SemanticsActionQueue queue(
+      [&sent](uint64_t target, FlutterSemanticsAction action,
+              fml::MallocMapping data) { sent.emplace_back(target, action); });
+
+  queue.Dispatch(1, kFlutterSemanticsActionTap, fml::MallocMapping());
+  queue.Dispatch(1, kFlutterSemanticsActionTap, fml::MallocMapping());
+  EXPECT_EQ(sent.size(), 2u);
+  EXPECT_FALSE(queue.HasPendingActions());
+}
+
+TEST(SemanticsActionQueueTest, HoldsRepeatsUntilFlushed) {
+  std::vector<Action> sent;
+  SemanticsActionQueue queue(
+      [&sent](uint64_t target, FlutterSemanticsAction action,
+              fml::MallocMapping data) { sent.emplace_back(target, action); });
+
+  for (int i = 0; i < 10; i++) {
+    queue.Dispatch(1, kFlutterSemanticsActionScrollUp, fml::MallocMapping());
+  }
+  // The same action on another node is not held back.
+  queue.Dispatch(2, kFlutterSemanticsActionScrollUp, fml::MallocMapping());
+  ASSERT_EQ(sent.size(), 2u);
+  EXPECT_EQ(sent[0], Action(1, kFlutterSemanticsActionScrollUp));
+  EXPECT_EQ(sent[1], Action(2, kFlutterSemanticsActionScrollUp));
+
+  // Only up to kMaxHeldActions repeats are kept.
+  for (size_t i = 0; i < SemanticsActionQueue::kMaxHeldActions; i++) {
+    queue.Flush();
+  }
+  EXPECT_EQ(sent.size(), 2u + SemanticsActionQueue::kMaxHeldActions);
+  EXPECT_TRUE(queue.HasPendingActions());
+
+  queue.Flush();
+  EXPECT_EQ(sent.size(), 2u + SemanticsActionQueue::kMaxHeldActions);
+  EXPECT_FALSE(queue.HasPendingActions());
+
+  // Once flushed, the action is sent right away again.
+  queue.Dispatch(1, kFlutterSemanticsActionScrollUp, fml::MallocMapping());
+  EXPECT_EQ(sent.size(), 3u + SemanticsActionQueue::kMaxHeldActions);
+}
+
+TEST(SemanticsActionQueueTest, DispatchDuringFlush) {
+  SemanticsActionQueue* queue_ptr = nullptr;
+  size_t sent_count = 0;
+  SemanticsActionQueue queue([&](uint64_t target, FlutterSemanticsAction action,
+                                 fml::MallocMapping data) {
+    sent_count++;
+    if (target == 1) {
+      queue_ptr->Dispatch(2, kFlutterSemanticsActionIncrease,
+                          fml::MallocMapping());
+    }
+  });
+  queue_ptr = &queue;
+
+  queue.Dispatch(1, kFlutterSemanticsActionDecrease, fml::MallocMapping());
+  queue.Dispatch(1, kFlutterSemanticsActionDecrease, fml::MallocMapping());
+  EXPECT_EQ(sent_count, 2u);
+
+  // The held decrease is sent and the increase it triggers isn't in flight
+  // anymore.
+  queue.Flush();
+  EXPECT_EQ(sent_count, 4u);
+  EXPECT_TRUE(queue.HasPendingActions());
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -0,0 +1,166 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/tizen/semantics_update_buffer.h"
+
+#include <unordered_set>
+
+#include "flutter/shell/platform/common/accessibility_bridge.h"
+
+namespace flutter {
+
+namespace {
+
+// The id of the root node of the semantics tree.
+constexpr int32_t kRootNodeId = 0;
+
+// The buffer is never pruned while it holds fewer nodes than this.
+constexpr size_t kMinNodeCountToPrune = 256;
+
+void AssignString(const char* source, std::string& target) {
+  if (source) {
+    target.assign(source);
+  } else {
+    target.clear();
+  }
+}
+
+void AssignIds(const int32_t* source,
+               size_t count,
+               std::vector<int32_t>& target) {
+  if (source) {
+    target.assign(source, source + count);
+  } else {
+    target.clear();
+  }
+}
+
+}  // namespace
+
+void SemanticsUpdateBuffer::AddUpdate(const FlutterSemanticsUpdate2& update) {
+  for (size_t i = 0; i < update.node_count; i++) {
+    const FlutterSemanticsNode2* node = update.nodes[i];
+    CopyNode(*node, nodes_[node->id]);
+  }
+
+  for (size_t i = 0; i < update.custom_action_count; i++) {
+    const FlutterSemanticsCustomAction2* action = update.custom_actions[i];
+    CustomAction& target = custom_actions_[action->id];
+    target.action = *action;
+    AssignString(action->label, target.label);
+    AssignString(action->hint, target.hint);
+  }
+
+  if (nodes_.size() > kMinNodeCountToPrune &&
+      nodes_.size() > 2 * reachable_node_count_) {
+    Prune();
+  }
+}
+
+void SemanticsUpdateBuffer::Replay(AccessibilityBridge& bridge) const {
+  // The buffered nodes point into strings and lists that may have moved since
+  // they were copied, so the pointers are only set up here.
+  VisitReachableNodes([&bridge](const Node& source) {
+    FlutterSemanticsNode2 node = source.node;
+    node.flags2 = const_cast<FlutterSemanticsFlags*>(&source.flags);
+    node.label = source.label.c_str();
+    node.hint = source.hint.c_str();
+    node.value = source.value.c_str();
+    node.increased_value = source.increased_value.c_str();
+    node.decreased_value = source.decreased_value.c_str();
+    node.tooltip = source.tooltip.c_str();
+    node.child_count = source.children_in_traversal_order.size();
+    node.children_in_traversal_order =
+        source.children_in_traversal_order.data();
+    node.children_in_hit_test_order = source.children_in_hit_test_order.data();
+    node.custom_accessibility_actions_count =
+        source.custom_accessibility_actions.size();
+    node.custom_accessibility_actions =
+        source.custom_accessibility_actions.data();
+    bridge.AddFlutterSemanticsNodeUpdate(node);
+  });
+
+  for (const auto& [id, source] : custom_actions_) {
+    FlutterSemanticsCustomAction2 action = source.action;
+    action.label = source.label.c_str();
+    action.hint = source.hint.c_str();
+    bridge.AddFlutterSemanticsCustomActionUpdate(action);
+  }
+}
+
+void SemanticsUpdateBuffer::Clear() {
+  nodes_.clear();
+  custom_actions_.clear();
+  reachable_node_count_ = 0;
+}
+
+void SemanticsUpdateBuffer::CopyNode(const FlutterSemanticsNode2& source,
+                                     Node& target) {
+  target.node = source;
+  if (source.flags2) {
+    target.flags = *source.flags2;
+  } else {
+    target.flags = {};
+    target.flags.struct_size = sizeof(FlutterSemanticsFlags);
+  }
+  AssignString(source.label, target.label);
+  AssignString(source.hint, target.hint);
+  AssignString(source.value, target.value);
+  AssignString(source.increased_value, target.increased_value);
+  AssignString(source.decreased_value, target.decreased_value);
+  AssignString(source.tooltip, target.tooltip);
+  AssignIds(source.children_in_traversal_order, source.child_count,
+            target.children_in_traversal_order);
+  AssignIds(source.children_in_hit_test_order, source.child_count,
+            target.children_in_hit_test_order);
+  AssignIds(source.custom_accessibility_actions,
+            source.custom_accessibility_actions_count,
+            target.custom_accessibility_actions);
+
+  // The bridge doesn't read string attributes, which would otherwise have to
+  // be deep copied as well.
+  target.node.label_attribute_count = 0;
+  target.node.label_attributes = nullptr;
+  target.node.hint_attribute_count = 0;
+  target.node.hint_attributes = nullptr;
+  target.node.value_attribute_count = 0;
+  target.node.value_attributes = nullptr;
+  target.node.increased_value_attribute_count = 0;
+  target.node.increased_value_attributes = nullptr;
+  target.node.decreased_value_attribute_count = 0;
+  target.node.decreased_value_attributes = nullptr;
+}
+
+template <typename Callback>
+void SemanticsUpdateBuffer::VisitReachableNodes(Callback callback) const {
+  std::vector<int32_t> stack = {kRootNodeId};
+  while (!stack.empty()) {
+    auto iter = nodes_.find(stack.back());
+    stack.pop_back();
+    if (iter == nodes_.end()) {
+      continue;
+    }
+    const Node& node = iter->second;
+    callback(node);
+    stack.insert(stack.end(), node.children_in_traversal_order.rbegin(),
+                 node.children_in_traversal_order.rend());
+  }
+}
+
+void SemanticsUpdateBuffer::Prune() {
+  std::unordered_set<int32_t> reachable_ids;
+  VisitReachableNodes([&reachable_ids](const Node& node) {
+    reachable_ids.insert(node.node.id);
+  });
+  for (auto iter = nodes_.begin(); iter != nodes_.end();) {
+    if (reachable_ids.count(iter->first) == 0) {
+      iter = nodes_.erase(iter);
+    } else {
+      ++iter;
+    }
+  }
+  reachable_node_count_ = nodes_.size();
+}
+
+}  // namespace flutter
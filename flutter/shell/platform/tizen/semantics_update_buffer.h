@@ -0,0 +1,86 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef EMBEDDER_SEMANTICS_UPDATE_BUFFER_H_
+#define EMBEDDER_SEMANTICS_UPDATE_BUFFER_H_
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "flutter/shell/platform/embedder/embedder.h"
+
+namespace flutter {
+
+class AccessibilityBridge;
+
+// Keeps the latest version of every semantics node and custom action sent by
+// the engine, so that an accessibility tree can be built on demand without
+// asking the framework to resend the semantics tree.
+//
+// Buffering an update only copies the raw node data. Nodes that are no
+// longer part of the tree are dropped once they outnumber the live nodes.
+class SemanticsUpdateBuffer {
+ public:
+  SemanticsUpdateBuffer() = default;
+
+  // Prevent copying.
+  SemanticsUpdateBuffer(SemanticsUpdateBuffer const&) = delete;
+  SemanticsUpdateBuffer& operator=(SemanticsUpdateBuffer const&) = delete;
+
+  // Merges |update| into the buffer.
+  void AddUpdate(const FlutterSemanticsUpdate2& update);
+
+  // Adds every buffered node reachable from the root and every custom action
+  // to |bridge| as pending updates. The caller commits them.
+  void Replay(AccessibilityBridge& bridge) const;
+
+  void Clear();
+
+  // The number of buffered nodes, including nodes that may have been removed
+  // from the tree since the last pruning.
+  size_t node_count() const { return nodes_.size(); }
+
+ private:
+  // A copy of a FlutterSemanticsNode2 that owns the data it points to.
+  struct Node {
+    FlutterSemanticsNode2 node;
+    FlutterSemanticsFlags flags;
+    std::string label;
+    std::string hint;
+    std::string value;
+    std::string increased_value;
+    std::string decreased_value;
+    std::string tooltip;
+    std::vector<int32_t> children_in_traversal_order;
+    std::vector<int32_t> children_in_hit_test_order;
+    std::vector<int32_t> custom_accessibility_actions;
+  };
+
+  struct CustomAction {
+    FlutterSemanticsCustomAction2 action;
+    std::string label;
+    std::string hint;
+  };
+
+  static void CopyNode(const FlutterSemanticsNode2& source, Node& target);
+
+  // Calls |callback| with every node reachable from the root, parents first.
+  template <typename Callback>
+  void VisitReachableNodes(Callback callback) const;
+
+  // Drops the nodes that can't be reached from the root.
+  void Prune();
+
+  std::unordered_map<int32_t, Node> nodes_;
+  std::unordered_map<int32_t, CustomAction> custom_actions_;
+
+  // The number of reachable nodes at the last pruning.
+  size_t reachable_node_count_ = 0;
+};
+
+}  // namespace flutter
+
+#endif  // EMBEDDER_SEMANTICS_UPDATE_BUFFER_H_
@@ -0,0 +1,171 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/tizen/semantics_update_buffer.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "flutter/shell/platform/common/accessibility_bridge.h"
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+class TestBridge : public AccessibilityBridge {
+ public:
+  void DispatchAccessibilityAction(AccessibilityNodeId target,
+                                   FlutterSemanticsAction action,
+                                   fml::MallocMapping data) override {}
+
+ protected:
+  void OnAccessibilityEvent(
+      ui::AXEventGenerator::TargetedEvent targeted_event) override {}
+
+  std::shared_ptr<FlutterPlatformNodeDelegate>
+  CreateFlutterPlatformNodeDelegate() override {
+    return std::make_shared<FlutterPlatformNodeDelegate>();
+  }
+};
+
+// Builds semantics updates whose nodes and strings only live as long as the
+// builder.
+class UpdateBuilder {
+ public:
+  UpdateBuilder() {
+    flags_.struct_size = sizeof(FlutterSemanticsFlags);
+    // Keep the pointers into the lists valid.
+    nodes_.reserve(64);
+    labels_.reserve(64);
+    children_.reserve(64);
+  }
+
+  UpdateBuilder& AddNode(int32_t id,
+                         const std::string& label,
+                         std::vector<int32_t> children = {}) {
+    labels_.push_back(label);
+    children_.push_back(std::move(children));
+    FlutterSemanticsNode2 node = {};
+    node.struct_size = sizeof(FlutterSemanticsNode2);
+    node.id = id;
+    node.label = labels_.back().c_str();
+    node.rect = {0, 0, 100, 100};
+    node.transform = {1, 0, 0, 0, 1, 0, 0, 0, 1};
+    node.child_count = children_.back().size();
+    node.children_in_traversal_order = children_.back().data();
+    node.children_in_hit_test_order = children_.back().data();
+    node.flags2 = &flags_;
+    nodes_.push_back(node);
+    return *this;
+  }
+
+  FlutterSemanticsUpdate2 Build() {
+    node_pointers_.clear();
+    for (FlutterSemanticsNode2& node : nodes_) {
+      node_pointers_.push_back(&node);
+    }
+    FlutterSemanticsUpdate2 update = {};
+    update.struct_size = sizeof(FlutterSemanticsUpdate2);
+    update.node_count = node_pointers_.size();
+    update.nodes = node_pointers_.data();
+    return update;
+  }
+
+ private:
+  FlutterSemanticsFlags flags_ = {};
+  std::vector<FlutterSemanticsNode2> nodes_;
+  std::vector<FlutterSemanticsNode2*> node_pointers_;
+  std::vector<std::string> labels_;
+  std::vector<std::vector<int32_t>> children_;
+};
+
+std::string GetName(const AccessibilityBridge& bridge, int32_t id) {
+  const ui::AXNode* node = bridge.GetTree()->GetFromId(id);
+  if (!node) {
+    return "<missing>";
+  }
+  return node->GetStringAttribute(ax::mojom::StringAttribute::kName);
+}
+
+}  // namespace
+
+TEST(SemanticsUpdateBufferTest, ReplaysLatestVersionOfEachNode) {
+  SemanticsUpdateBuffer buffer;
+  {
+    UpdateBuilder builder;
+    builder.AddNode(0, "root", {1, 2}).AddNode(1, "a").AddNode(2, "b");
+    FlutterSemanticsUpdate2 update = builder.Build();
+    buffer.AddUpdate(update);
+  }
+  {
+    UpdateBuilder builder;
+    builder.AddNode(2, "b2", {3}).AddNode(3, "c");
+    FlutterSemanticsUpdate2 update = builder.Build();
+    buffer.AddUpdate(update);
+  }
+  EXPECT_EQ(buffer.node_count(), 4u);
+
+  auto bridge = std::make_shared<TestBridge>();
+  buffer.Replay(*bridge);
+  bridge->CommitUpdates();
+
+  EXPECT_EQ(bridge->GetTree()->size(), 4);
+  EXPECT_EQ(GetName(*bridge, 0), "root");
+  EXPECT_EQ(GetName(*bridge, 1), "a");
+  EXPECT_EQ(GetName(*bridge, 2), "b2");
+  EXPECT_EQ(GetName(*bridge, 3), "c");
+  EXPECT_EQ(bridge->GetTree()->GetFromId(2)->children()[0]->id(), 3);
+}
+
+TEST(SemanticsUpdateBufferTest, SkipsRemovedNodes) {
+  SemanticsUpdateBuffer buffer;
+  {
+    UpdateBuilder builder;
+    builder.AddNode(0, "root", {1, 2}).AddNode(1, "a").AddNode(2, "b");
+    FlutterSemanticsUpdate2 update = builder.Build();
+    buffer.AddUpdate(update);
+  }
+  {
+    UpdateBuilder builder;
+    builder.AddNode(0, "root", {2});
+    FlutterSemanticsUpdate2 update = builder.Build();
+    buffer.AddUpdate(update);
+  }
+
+  auto bridge = std::make_shared<TestBridge>();
+  buffer.Replay(*bridge);
+  bridge->CommitUpdates();
+
+  EXPECT_EQ(bridge->GetTree()->size(), 2);
+  EXPECT_EQ(GetName(*bridge, 1), "<missing>");
+  EXPECT_EQ(GetName(*bridge, 2), "b");
+}
+
+TEST(SemanticsUpdateBufferTest, PrunesRemovedNodes) {
+  SemanticsUpdateBuffer buffer;
+  // Replaces the only child of the root on every update, as a list scrolling
+  // through new items would.
+  for (int32_t id = 1; id <= 1000; id++) {
+    UpdateBuilder builder;
+    builder.AddNode(0, "root", {id}).AddNode(id, std::to_string(id));
+    FlutterSemanticsUpdate2 update = builder.Build();
+    buffer.AddUpdate(update);
+  }
+  EXPECT_LE(buffer.node_count(), 512u);
+
+  auto bridge = std::make_shared<TestBridge>();
+  buffer.Replay(*bridge);
+  bridge->CommitUpdates();
+  EXPECT_EQ(bridge->GetTree()->size(), 2);
+  EXPECT_EQ(GetName(*bridge, 1000), "1000");
+
+  buffer.Clear();
+  EXPECT_EQ(buffer.node_count(), 0u);
+}
+
+}  // namespace testing
+}  // namespace flutter
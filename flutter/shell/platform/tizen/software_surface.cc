@@ -0,0 +1,185 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "software_surface.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "flutter/shell/platform/tizen/logger.h"
+#include "flutter/shell/platform/tizen/pixel_format_converter.h"
+
+namespace flutter {
+
+namespace {
+
+// Generic vector types that are lowered to NEON on ARM and SSE on x86.
+typedef uint32_t U32x4 __attribute__((vector_size(16)));
+typedef uint16_t U16x4 __attribute__((vector_size(8)));
+
+constexpr size_t kSourceBytesPerPixel = 4;
+
+// The granularity of row comparisons, which the compiler lowers to vector
+// compares.
+constexpr size_t kCompareChunkSize = 16;
+
+size_t GetBytesPerPixel(FlutterSoftwarePixelFormat format) {
+  switch (format) {
+    case kFlutterSoftwarePixelFormatRGB565:
+      return 2;
+    case kFlutterSoftwarePixelFormatRGBA8888:
+    case kFlutterSoftwarePixelFormatBGRA8888:
+      return 4;
+    default:
+      return 0;
+  }
+}
+
+// Converts |width| premultiplied BGRA pixels to RGB565, which is equivalent
+// to blending them over black.
+void ConvertRowToRGB565(const uint8_t* src, uint8_t* dst, size_t width) {
+  size_t x = 0;
+  for (; x + 4 <= width; x += 4) {
+    U32x4 pixels;
+    memcpy(&pixels, src + x * kSourceBytesPerPixel, sizeof(pixels));
+    U32x4 rgb565 = ((pixels >> 8) & 0xF800u) | ((pixels >> 5) & 0x07E0u) |
+                   ((pixels >> 3) & 0x001Fu);
+    U16x4 packed = __builtin_convertvector(rgb565, U16x4);
+    memcpy(dst + x * 2, &packed, sizeof(packed));
+  }
+  for (; x < width; x++) {
+    const uint8_t* s = src + x * kSourceBytesPerPixel;
+    uint16_t pixel = static_cast<uint16_t>(((s[2] & 0xF8) << 8) |
+                                           ((s[1] & 0xFC) << 3) | (s[0] >> 3));
+    memcpy(dst + x * 2, &pixel, sizeof(pixel));
+  }
+}
+
+// Returns the offset of the first byte that differs between |a| and |b|, or
+// |length| if they are equal.
+size_t FindFirstDifference(const uint8_t* a, const uint8_t* b, size_t length) {
+  size_t i = 0;
+  while (i + kCompareChunkSize <= length &&
+         memcmp(a + i, b + i, kCompareChunkSize) == 0) {
+    i += kCompareChunkSize;
+  }
+  while (i < length && a[i] == b[i]) {
+    i++;
+  }
+  return i;
+}
+
+// Returns one past the offset of the last byte that differs between |a| and
+// |b|, searching no further back than |start|.
+size_t FindLastDifference(const uint8_t* a,
+                          const uint8_t* b,
+                          size_t start,
+                          size_t length) {
+  size_t i = length;
+  while (i >= start + kCompareChunkSize &&
+         memcmp(a + i - kCompareChunkSize, b + i - kCompareChunkSize,
+                kCompareChunkSize) == 0) {
+    i -= kCompareChunkSize;
+  }
+  while (i > start && a[i - 1] == b[i - 1]) {
+    i--;
+  }
+  return i;
+}
+
+}  // namespace
+
+SoftwareSurface::SoftwareSurface(std::unique_ptr<SoftwareSurfaceSink> sink)
+    : sink_(std::move(sink)) {
+  pixel_format_ = sink_->GetPixelFormat();
+  bytes_per_pixel_ = GetBytesPerPixel(pixel_format_);
+  if (bytes_per_pixel_ == 0) {
+    FT_LOG(Error) << "Unsupported pixel format: " << pixel_format_;
+  }
+}
+
+bool SoftwareSurface::Present(const void* allocation,
+                              size_t row_bytes,
+                              size_t width,
+                              size_t height) {
+  if (!allocation || bytes_per_pixel_ == 0 ||
+      row_bytes < width * kSourceBytesPerPixel) {
+    return false;
+  }
+  if (width != width_ || height != height_) {
+    width_ = width;
+    height_ = height;
+    frame_.assign(width * height * bytes_per_pixel_, 0);
+    scratch_row_.resize(width * bytes_per_pixel_);
+    full_damage_ = true;
+  }
+
+  damage_.clear();
+  SoftwareSurfaceRect* band = nullptr;
+  const uint8_t* source = static_cast<const uint8_t*>(allocation);
+  for (size_t y = 0; y < height_; y++) {
+    const uint8_t* row = source + y * row_bytes;
+    switch (pixel_format_) {
+      case kFlutterSoftwarePixelFormatRGBA8888:
+        SwizzleRow(row, scratch_row_.data(), width_);
+        row = scratch_row_.data();
+        break;
+      case kFlutterSoftwarePixelFormatRGB565:
+        ConvertRowToRGB565(row, scratch_row_.data(), width_);
+        row = scratch_row_.data();
+        break;
+      default:
+        break;
+    }
+
+    size_t left, right;
+    if (!UpdateRow(row, y, &left, &right)) {
+      band = nullptr;
+      continue;
+    }
+    // Merge the changed spans of adjacent rows into a single rectangle.
+    if (band) {
+      size_t band_right = std::max(band->left + band->width, right);
+      band->left = std::min(band->left, left);
+      band->width = band_right - band->left;
+      band->height++;
+    } else {
+      damage_.push_back({left, y, right - left, 1});
+      band = &damage_.back();
+    }
+  }
+  full_damage_ = false;
+
+  if (damage_.empty()) {
+    // Nothing changed since the previous frame.
+    return true;
+  }
+  return sink_->Present(frame_.data(), width_ * bytes_per_pixel_, width_,
+                        height_, damage_);
+}
+
+bool SoftwareSurface::UpdateRow(const uint8_t* source,
+                                size_t y,
+                                size_t* left,
+                                size_t* right) {
+  size_t length = width_ * bytes_per_pixel_;
+  uint8_t* destination = frame_.data() + y * length;
+
+  size_t start = 0;
+  size_t end = length;
+  if (!full_damage_) {
+    start = FindFirstDifference(source, destination, length);
+    if (start == length) {
+      return false;
+    }
+    end = FindLastDifference(source, destination, start, length);
+  }
+  memcpy(destination + start, source + start, end - start);
+
+  *left = start / bytes_per_pixel_;
+  *right = (end + bytes_per_pixel_ - 1) / bytes_per_pixel_;
+  return true;
+}
+
+}  // namespace flutter
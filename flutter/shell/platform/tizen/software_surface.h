@@ -0,0 +1,100 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef EMBEDDER_SOFTWARE_SURFACE_H_
+#define EMBEDDER_SOFTWARE_SURFACE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "flutter/shell/platform/embedder/embedder.h"
+
+namespace flutter {
+
+// A rectangle in physical pixels.
+struct SoftwareSurfaceRect {
+  size_t left = 0, top = 0, width = 0, height = 0;
+};
+
+// The output of a software renderer, such as an Evas image or a wl_shm
+// buffer.
+class SoftwareSurfaceSink {
+ public:
+  virtual ~SoftwareSurfaceSink() = default;
+
+  // The pixel format of the frames passed to Present. Only
+  // kFlutterSoftwarePixelFormatBGRA8888, kFlutterSoftwarePixelFormatRGBA8888
+  // and kFlutterSoftwarePixelFormatRGB565 are supported.
+  virtual FlutterSoftwarePixelFormat GetPixelFormat() = 0;
+
+  // Displays |frame| of |height| rows of |row_bytes| bytes. Only the pixels
+  // in |damage| have changed since the previous call, unless the size of the
+  // frame has changed. The frame is not valid after returning.
+  //
+  // Called on the raster thread.
+  virtual bool Present(const uint8_t* frame,
+                       size_t row_bytes,
+                       size_t width,
+                       size_t height,
+                       const std::vector<SoftwareSurfaceRect>& damage) = 0;
+};
+
+// Copies frames rendered by the engine's software rasterizer into a
+// SoftwareSurfaceSink.
+//
+// The surface keeps the last frame in the pixel format of the sink. Each new
+// frame is compared with it row by row, and only the changed span of each row
+// is converted and copied, so that the sink only needs to update the damaged
+// area. Idle frames, such as a blinking cursor, touch a few rows only.
+//
+// The comparison still reads the whole frame, and for sinks that are not
+// BGRA8888 every row is converted before it is compared.
+class SoftwareSurface {
+ public:
+  explicit SoftwareSurface(std::unique_ptr<SoftwareSurfaceSink> sink);
+
+  // Prevent copying.
+  SoftwareSurface(SoftwareSurface const&) = delete;
+  SoftwareSurface& operator=(SoftwareSurface const&) = delete;
+
+  // Presents a frame of |width| x |height| premultiplied BGRA8888 pixels
+  // with |row_bytes| bytes per row. Called on the raster thread.
+  bool Present(const void* allocation,
+               size_t row_bytes,
+               size_t width,
+               size_t height);
+
+  // The area updated by the last call to Present.
+  const std::vector<SoftwareSurfaceRect>& damage() const { return damage_; }
+
+ private:
+  // Compares row |y| of the last frame with |source|, which has |width_|
+  // pixels in the sink pixel format, and copies the changed span. Returns
+  // the span in [|left|, |right|), or false if nothing changed.
+  bool UpdateRow(const uint8_t* source, size_t y, size_t* left, size_t* right);
+
+  std::unique_ptr<SoftwareSurfaceSink> sink_;
+  FlutterSoftwarePixelFormat pixel_format_;
+  size_t bytes_per_pixel_;
+
+  size_t width_ = 0;
+  size_t height_ = 0;
+
+  // The last presented frame in the sink pixel format.
+  std::vector<uint8_t> frame_;
+
+  // A row of the new frame converted to the sink pixel format.
+  std::vector<uint8_t> scratch_row_;
+
+  // Whether the whole frame must be presented, such as after resizing.
+  bool full_damage_ = true;
+
+  std::vector<SoftwareSurfaceRect> damage_;
+};
+
+}  // namespace flutter
+
+#endif  // EMBEDDER_SOFTWARE_SURFACE_H_
@@ -0,0 +1,208 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/tizen/software_surface.h"
+
+#include <cstring>
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+// Wide enough to cover both the vectorized and the scalar code paths.
+constexpr size_t kWidth = 37;
+constexpr size_t kHeight = 9;
+
+// A sink that keeps its own copy of the displayed pixels, and only updates
+// the damaged area like a real display server would.
+class FakeSink : public SoftwareSurfaceSink {
+ public:
+  explicit FakeSink(FlutterSoftwarePixelFormat pixel_format)
+      : pixel_format_(pixel_format) {}
+
+  FlutterSoftwarePixelFormat GetPixelFormat() override {
+    return pixel_format_;
+  }
+
+  bool Present(const uint8_t* frame,
+               size_t row_bytes,
+               size_t width,
+               size_t height,
+               const std::vector<SoftwareSurfaceRect>& damage) override {
+    if (width != width_ || height != height_) {
+      width_ = width;
+      height_ = height;
+      pixels.assign(row_bytes * height, 0xCD);
+    }
+    size_t bytes_per_pixel = row_bytes / width;
+    for (const SoftwareSurfaceRect& rect : damage) {
+      EXPECT_LE(rect.left + rect.width, width);
+      EXPECT_LE(rect.top + rect.height, height);
+      for (size_t y = rect.top; y < rect.top + rect.height; y++) {
+        size_t offset = y * row_bytes + rect.left * bytes_per_pixel;
+        memcpy(pixels.data() + offset, frame + offset,
+               rect.width * bytes_per_pixel);
+      }
+    }
+    present_count++;
+    return true;
+  }
+
+  std::vector<uint8_t> pixels;
+  size_t present_count = 0;
+
+ private:
+  FlutterSoftwarePixelFormat pixel_format_;
+  size_t width_ = 0;
+  size_t height_ = 0;
+};
+
+std::vector<uint8_t> CreateFrame(size_t row_bytes, uint8_t seed) {
+  std::vector<uint8_t> frame(row_bytes * kHeight);
+  for (size_t i = 0; i < frame.size(); i++) {
+    frame[i] = static_cast<uint8_t>(seed + i * 7);
+  }
+  return frame;
+}
+
+uint8_t* GetPixel(std::vector<uint8_t>& frame,
+                  size_t row_bytes,
+                  size_t x,
+                  size_t y) {
+  return frame.data() + y * row_bytes + x * 4;
+}
+
+}  // namespace
+
+TEST(SoftwareSurfaceTest, PresentsFirstFrameFully) {
+  auto sink = std::make_unique<FakeSink>(kFlutterSoftwarePixelFormatBGRA8888);
+  FakeSink* fake_sink = sink.get();
+  SoftwareSurface surface(std::move(sink));
+
+  size_t row_bytes = kWidth * 4 + 12;
+  std::vector<uint8_t> frame = CreateFrame(row_bytes, 1);
+  ASSERT_TRUE(surface.Present(frame.data(), row_bytes, kWidth, kHeight));
+
+  ASSERT_EQ(surface.damage().size(), 1u);
+  EXPECT_EQ(surface.damage()[0].left, 0u);
+  EXPECT_EQ(surface.damage()[0].top, 0u);
+  EXPECT_EQ(surface.damage()[0].width, kWidth);
+  EXPECT_EQ(surface.damage()[0].height, kHeight);
+  for (size_t y = 0; y < kHeight; y++) {
+    EXPECT_EQ(memcmp(fake_sink->pixels.data() + y * kWidth * 4,
+                     frame.data() + y * row_bytes, kWidth * 4),
+              0);
+  }
+}
+
+TEST(SoftwareSurfaceTest, SkipsUnchangedFrames) {
+  auto sink = std::make_unique<FakeSink>(kFlutterSoftwarePixelFormatBGRA8888);
+  FakeSink* fake_sink = sink.get();
+  SoftwareSurface surface(std::move(sink));
+
+  std::vector<uint8_t> frame = CreateFrame(kWidth * 4, 1);
+  ASSERT_TRUE(surface.Present(frame.data(), kWidth * 4, kWidth, kHeight));
+  ASSERT_TRUE(surface.Present(frame.data(), kWidth * 4, kWidth, kHeight));
+  EXPECT_TRUE(surface.damage().empty());
+  EXPECT_EQ(fake_sink->present_count, 1u);
+}
+
+TEST(SoftwareSurfaceTest, PresentsOnlyDamagedArea) {
+  auto sink = std::make_unique<FakeSink>(kFlutterSoftwarePixelFormatBGRA8888);
+  FakeSink* fake_sink = sink.get();
+  SoftwareSurface surface(std::move(sink));
+
+  size_t row_bytes = kWidth * 4;
+  std::vector<uint8_t> frame = CreateFrame(row_bytes, 1);
+  ASSERT_TRUE(surface.Present(frame.data(), row_bytes, kWidth, kHeight));
+
+  // Two adjacent rows and a separate row change.
+  GetPixel(frame, row_bytes, 3, 2)[0] ^= 0xFF;
+  GetPixel(frame, row_bytes, 20, 3)[3] ^= 0xFF;
+  GetPixel(frame, row_bytes, 36, 7)[1] ^= 0xFF;
+  ASSERT_TRUE(surface.Present(frame.data(), row_bytes, kWidth, kHeight));
+
+  const std::vector<SoftwareSurfaceRect>& damage = surface.damage();
+  ASSERT_EQ(damage.size(), 2u);
+  EXPECT_EQ(damage[0].left, 3u);
+  EXPECT_EQ(damage[0].top, 2u);
+  EXPECT_EQ(damage[0].width, 18u);
+  EXPECT_EQ(damage[0].height, 2u);
+  EXPECT_EQ(damage[1].left, 36u);
+  EXPECT_EQ(damage[1].top, 7u);
+  EXPECT_EQ(damage[1].width, 1u);
+  EXPECT_EQ(damage[1].height, 1u);
+  EXPECT_EQ(fake_sink->pixels, frame);
+}
+
+TEST(SoftwareSurfaceTest, ResizePresentsFullFrame) {
+  auto sink = std::make_unique<FakeSink>(kFlutterSoftwarePixelFormatBGRA8888);
+  SoftwareSurface surface(std::move(sink));
+
+  std::vector<uint8_t> frame = CreateFrame(kWidth * 4, 1);
+  ASSERT_TRUE(surface.Present(frame.data(), kWidth * 4, kWidth, kHeight));
+  ASSERT_TRUE(
+      surface.Present(frame.data(), kWidth * 4, kWidth - 1, kHeight - 1));
+  ASSERT_EQ(surface.damage().size(), 1u);
+  EXPECT_EQ(surface.damage()[0].width, kWidth - 1);
+  EXPECT_EQ(surface.damage()[0].height, kHeight - 1);
+}
+
+TEST(SoftwareSurfaceTest, ConvertsToRGBA) {
+  auto sink = std::make_unique<FakeSink>(kFlutterSoftwarePixelFormatRGBA8888);
+  FakeSink* fake_sink = sink.get();
+  SoftwareSurface surface(std::move(sink));
+
+  size_t row_bytes = kWidth * 4;
+  std::vector<uint8_t> frame = CreateFrame(row_bytes, 5);
+  ASSERT_TRUE(surface.Present(frame.data(), row_bytes, kWidth, kHeight));
+  GetPixel(frame, row_bytes, 10, 4)[2] ^= 0xFF;
+  ASSERT_TRUE(surface.Present(frame.data(), row_bytes, kWidth, kHeight));
+
+  for (size_t i = 0; i < frame.size(); i += 4) {
+    EXPECT_EQ(fake_sink->pixels[i], frame[i + 2]);
+    EXPECT_EQ(fake_sink->pixels[i + 1], frame[i + 1]);
+    EXPECT_EQ(fake_sink->pixels[i + 2], frame[i]);
+    EXPECT_EQ(fake_sink->pixels[i + 3], frame[i + 3]);
+  }
+}
+
+TEST(SoftwareSurfaceTest, ConvertsToRGB565) {
+  auto sink = std::make_unique<FakeSink>(kFlutterSoftwarePixelFormatRGB565);
+  FakeSink* fake_sink = sink.get();
+  SoftwareSurface surface(std::move(sink));
+
+  size_t row_bytes = kWidth * 4;
+  std::vector<uint8_t> frame = CreateFrame(row_bytes, 9);
+  ASSERT_TRUE(surface.Present(frame.data(), row_bytes, kWidth, kHeight));
+  ASSERT_EQ(fake_sink->pixels.size(), kWidth * kHeight * 2);
+
+  for (size_t i = 0; i < kWidth * kHeight; i++) {
+    const uint8_t* bgra = &frame[i * 4];
+    uint16_t expected = ((bgra[2] >> 3) << 11) | ((bgra[1] >> 2) << 5) |
+                        (bgra[0] >> 3);
+    uint16_t actual;
+    memcpy(&actual, &fake_sink->pixels[i * 2], sizeof(actual));
+    EXPECT_EQ(actual, expected);
+  }
+}
+
+TEST(SoftwareSurfaceTest, RejectsInvalidFrames) {
+  auto sink = std::make_unique<FakeSink>(kFlutterSoftwarePixelFormatBGRA8888);
+  SoftwareSurface surface(std::move(sink));
+
+  std::vector<uint8_t> frame = CreateFrame(kWidth * 4, 1);
+  EXPECT_FALSE(surface.Present(nullptr, kWidth * 4, kWidth, kHeight));
+  EXPECT_FALSE(surface.Present(frame.data(), kWidth * 4 - 1, kWidth, kHeight));
+
+  auto gray_sink = std::make_unique<FakeSink>(kFlutterSoftwarePixelFormatGray8);
+  SoftwareSurface gray_surface(std::move(gray_sink));
+  EXPECT_FALSE(gray_surface.Present(frame.data(), kWidth * 4, kWidth, kHeight));
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -23,6 +23,29 @@ class EngineModifier {
   // engine unless overwritten again.
   FlutterEngineProcTable& embedder_api() { return engine_->embedder_api_; }
 
+  // Applies a semantics update as if it were sent by the engine.
+  void UpdateSemantics(const FlutterSemanticsUpdate2* update) {
+    engine_->OnUpdateSemantics(update);
+  }
+
+  // Notifies the engine of a query from an assistive client.
+  void QueryAccessibility() { engine_->OnAccessibilityQuery(); }
+
+  // Replaces the accessibility settings read from the system, allowing tests
+  // to simulate the screen reader state.
+  void SetAccessibilitySettings(
+      std::unique_ptr<AccessibilitySettings> settings) {
+    engine_->accessibility_settings_ = std::move(settings);
+  }
+
+  // Adds |view| drawn by |renderer|, without requiring a running engine with
+  // an implicit view.
+  bool AddView(FlutterTizenView* view,
+               std::unique_ptr<TizenRenderer> renderer,
+               FlutterTizenEngine::ViewCallback callback) {
+    return engine_->AddView(view, std::move(renderer), std::move(callback));
+  }
+
  private:
   FlutterTizenEngine* engine_;
 };
@@ -0,0 +1,40 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef EMBEDDER_TESTING_ENGINE_POOL_MODIFIER_H_
+#define EMBEDDER_TESTING_ENGINE_POOL_MODIFIER_H_
+
+#include <functional>
+#include <utility>
+
+#include "flutter/shell/platform/tizen/flutter_tizen_engine_pool.h"
+
+namespace flutter {
+
+// A test utility class providing the ability to alter the engines created by
+// an engine pool and to fill the pool without running the main loop.
+class EnginePoolModifier {
+ public:
+  explicit EnginePoolModifier(FlutterTizenEnginePool* pool) : pool_(pool) {}
+
+  // Sets a callback called with every engine the pool creates, before the
+  // engine is prewarmed. Use EngineModifier to mock its embedder API.
+  void SetEngineCreatedCallback(
+      std::function<void(FlutterTizenEngine*)> callback) {
+    pool_->engine_created_callback_ = std::move(callback);
+  }
+
+  // Prewarms engines until the pool is full or prewarming fails.
+  void Fill() {
+    while (pool_->AddEngine()) {
+    }
+  }
+
+ private:
+  FlutterTizenEnginePool* pool_;
+};
+
+}  // namespace flutter
+
+#endif  // EMBEDDER_TESTING_ENGINE_POOL_MODIFIER_H_
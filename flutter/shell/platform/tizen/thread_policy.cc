@@ -0,0 +1,177 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "thread_policy.h"
+
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <array>
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <optional>
+#include <sstream>
+
+#include "flutter/shell/platform/tizen/logger.h"
+
+namespace flutter {
+
+namespace {
+
+constexpr size_t kThreadPriorityCount = 4;
+
+std::mutex policies_mutex;
+std::array<std::optional<ThreadPolicy>, kThreadPriorityCount> policies;
+
+bool IsValidPriority(FlutterThreadPriority priority) {
+  return priority >= kBackground &&
+         static_cast<size_t>(priority) < kThreadPriorityCount;
+}
+
+bool ParseInteger(const std::string& value, int* result) {
+  if (value.empty()) {
+    return false;
+  }
+  char* end = nullptr;
+  errno = 0;
+  long number = strtol(value.c_str(), &end, 10);
+  if (errno != 0 || *end != '\0' || number < INT_MIN || number > INT_MAX) {
+    return false;
+  }
+  *result = static_cast<int>(number);
+  return true;
+}
+
+bool ParseMask(const std::string& value, uint64_t* result) {
+  if (value.empty() || value[0] == '-') {
+    return false;
+  }
+  char* end = nullptr;
+  errno = 0;
+  *result = strtoull(value.c_str(), &end, 0);
+  return errno == 0 && *end == '\0';
+}
+
+bool ParseScheduler(const std::string& value, int* scheduler) {
+  if (value == "other") {
+    *scheduler = SCHED_OTHER;
+  } else if (value == "batch") {
+    *scheduler = SCHED_BATCH;
+  } else if (value == "idle") {
+    *scheduler = SCHED_IDLE;
+  } else if (value == "fifo") {
+    *scheduler = SCHED_FIFO;
+  } else if (value == "rr") {
+    *scheduler = SCHED_RR;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+bool IsRealtime(int scheduler) {
+  return scheduler == SCHED_FIFO || scheduler == SCHED_RR;
+}
+
+}  // namespace
+
+bool ParseThreadPolicy(const std::string& spec, ThreadPolicy* policy) {
+  ThreadPolicy result;
+  std::istringstream stream(spec);
+  std::string entry;
+  while (std::getline(stream, entry, ',')) {
+    size_t separator = entry.find('=');
+    if (separator == std::string::npos) {
+      return false;
+    }
+    std::string key = entry.substr(0, separator);
+    std::string value = entry.substr(separator + 1);
+    if (key == "sched") {
+      if (!ParseScheduler(value, &result.scheduler)) {
+        return false;
+      }
+    } else if (key == "priority") {
+      if (!ParseInteger(value, &result.priority)) {
+        return false;
+      }
+    } else if (key == "affinity") {
+      if (!ParseMask(value, &result.cpu_mask)) {
+        return false;
+      }
+    } else {
+      return false;
+    }
+  }
+  *policy = result;
+  return true;
+}
+
+void SetThreadPolicy(FlutterThreadPriority priority,
+                     const ThreadPolicy& policy) {
+  if (!IsValidPriority(priority)) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(policies_mutex);
+  policies[priority] = policy;
+}
+
+bool GetThreadPolicy(FlutterThreadPriority priority, ThreadPolicy* policy) {
+  if (!IsValidPriority(priority)) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(policies_mutex);
+  if (!policies[priority]) {
+    return false;
+  }
+  *policy = *policies[priority];
+  return true;
+}
+
+void ResetThreadPolicies() {
+  std::lock_guard<std::mutex> lock(policies_mutex);
+  policies.fill(std::nullopt);
+}
+
+void ApplyThreadPolicy(FlutterThreadPriority priority) {
+  ThreadPolicy policy;
+  if (!GetThreadPolicy(priority, &policy)) {
+    return;
+  }
+  pid_t tid = static_cast<pid_t>(syscall(SYS_gettid));
+
+  sched_param param = {};
+  if (IsRealtime(policy.scheduler)) {
+    param.sched_priority = policy.priority;
+  }
+  if (policy.scheduler != SCHED_OTHER &&
+      sched_setscheduler(tid, policy.scheduler, &param) != 0) {
+    FT_LOG(Warn) << "Could not set the scheduling policy of thread " << tid
+                 << ": " << strerror(errno);
+  }
+  if (!IsRealtime(policy.scheduler) && policy.scheduler != SCHED_IDLE &&
+      setpriority(PRIO_PROCESS, tid, policy.priority) != 0) {
+    FT_LOG(Warn) << "Could not set the nice value of thread " << tid << ": "
+                 << strerror(errno);
+  }
+
+  if (policy.cpu_mask != 0) {
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (size_t cpu = 0; cpu < 64; cpu++) {
+      if (policy.cpu_mask & (uint64_t{1} << cpu)) {
+        CPU_SET(cpu, &cpu_set);
+      }
+    }
+    if (sched_setaffinity(tid, sizeof(cpu_set), &cpu_set) != 0) {
+      FT_LOG(Warn) << "Could not set the CPU affinity of thread " << tid
+                   << ": " << strerror(errno);
+    }
+  }
+}
+
+}  // namespace flutter
@@ -0,0 +1,65 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef EMBEDDER_THREAD_POLICY_H_
+#define EMBEDDER_THREAD_POLICY_H_
+
+#include <sched.h>
+
+#include <cstdint>
+#include <string>
+
+#include "flutter/shell/platform/embedder/embedder.h"
+
+namespace flutter {
+
+// The scheduling parameters of a thread.
+struct ThreadPolicy {
+  // The scheduling policy, such as SCHED_OTHER or SCHED_FIFO.
+  int scheduler = SCHED_OTHER;
+
+  // The nice value for SCHED_OTHER and SCHED_BATCH, or the static priority
+  // for SCHED_FIFO and SCHED_RR. Ignored for SCHED_IDLE.
+  int priority = 0;
+
+  // The CPUs the thread may run on, one bit per CPU. Zero leaves the affinity
+  // unchanged.
+  uint64_t cpu_mask = 0;
+};
+
+// Parses a policy of comma-separated key=value pairs into |policy|:
+//
+//  - sched: One of other, batch, idle, fifo and rr. Defaults to other.
+//  - priority: The nice value or the real-time priority.
+//  - affinity: The CPU mask, such as 0xf0 for the CPUs 4 to 7.
+//
+// For example, "sched=fifo,priority=10,affinity=0xf0".
+//
+// Returns false if |spec| is malformed.
+bool ParseThreadPolicy(const std::string& spec, ThreadPolicy* policy);
+
+// Sets the policy of threads with |priority|. Threads with a priority whose
+// policy is not set keep their default scheduling parameters.
+//
+// The policies are shared by all engines in the process.
+void SetThreadPolicy(FlutterThreadPriority priority,
+                     const ThreadPolicy& policy);
+
+// Retrieves the policy of threads with |priority|.
+//
+// Returns false if no policy is set.
+bool GetThreadPolicy(FlutterThreadPriority priority, ThreadPolicy* policy);
+
+// Discards all policies set with SetThreadPolicy.
+void ResetThreadPolicies();
+
+// Applies the policy of |priority| to the calling thread, if any.
+//
+// Used as FlutterCustomTaskRunners.thread_priority_setter for the engine's
+// threads, and called by the embedder's own threads.
+void ApplyThreadPolicy(FlutterThreadPriority priority);
+
+}  // namespace flutter
+
+#endif  // EMBEDDER_THREAD_POLICY_H_
@@ -0,0 +1,120 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/tizen/thread_policy.h"
+
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <thread>
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+class ThreadPolicyTest : public ::testing::Test {
+ protected:
+  void TearDown() override { ResetThreadPolicies(); }
+};
+
+struct ThreadState {
+  int nice = 0;
+  cpu_set_t cpu_set;
+};
+
+// Applies the policy of |priority| on a new thread and returns the resulting
+// scheduling parameters of the thread.
+ThreadState ApplyOnNewThread(FlutterThreadPriority priority) {
+  ThreadState state;
+  std::thread thread([&state, priority]() {
+    ApplyThreadPolicy(priority);
+    pid_t tid = static_cast<pid_t>(syscall(SYS_gettid));
+    state.nice = getpriority(PRIO_PROCESS, tid);
+    sched_getaffinity(tid, sizeof(state.cpu_set), &state.cpu_set);
+  });
+  thread.join();
+  return state;
+}
+
+}  // namespace
+
+TEST_F(ThreadPolicyTest, ParsesPolicy) {
+  ThreadPolicy policy;
+  ASSERT_TRUE(ParseThreadPolicy("sched=fifo,priority=10,affinity=0xf0",
+                                &policy));
+  EXPECT_EQ(policy.scheduler, SCHED_FIFO);
+  EXPECT_EQ(policy.priority, 10);
+  EXPECT_EQ(policy.cpu_mask, 0xf0u);
+
+  ASSERT_TRUE(ParseThreadPolicy("priority=-5", &policy));
+  EXPECT_EQ(policy.scheduler, SCHED_OTHER);
+  EXPECT_EQ(policy.priority, -5);
+  EXPECT_EQ(policy.cpu_mask, 0u);
+}
+
+TEST_F(ThreadPolicyTest, RejectsMalformedPolicy) {
+  ThreadPolicy policy;
+  policy.priority = 3;
+  EXPECT_FALSE(ParseThreadPolicy("sched=deadline", &policy));
+  EXPECT_FALSE(ParseThreadPolicy("priority=high", &policy));
+  EXPECT_FALSE(ParseThreadPolicy("affinity=-1", &policy));
+  EXPECT_FALSE(ParseThreadPolicy("nice=1", &policy));
+  EXPECT_FALSE(ParseThreadPolicy("priority", &policy));
+  EXPECT_EQ(policy.priority, 3);
+}
+
+TEST_F(ThreadPolicyTest, MapsPrioritiesToPolicies) {
+  ThreadPolicy background;
+  background.priority = 10;
+  SetThreadPolicy(kBackground, background);
+  ThreadPolicy raster;
+  raster.scheduler = SCHED_FIFO;
+  raster.priority = 5;
+  SetThreadPolicy(kRaster, raster);
+
+  ThreadPolicy policy;
+  ASSERT_TRUE(GetThreadPolicy(kBackground, &policy));
+  EXPECT_EQ(policy.priority, 10);
+  ASSERT_TRUE(GetThreadPolicy(kRaster, &policy));
+  EXPECT_EQ(policy.scheduler, SCHED_FIFO);
+  EXPECT_FALSE(GetThreadPolicy(kNormal, &policy));
+  EXPECT_FALSE(GetThreadPolicy(kDisplay, &policy));
+
+  ResetThreadPolicies();
+  EXPECT_FALSE(GetThreadPolicy(kBackground, &policy));
+}
+
+TEST_F(ThreadPolicyTest, AppliesPolicyToCallingThread) {
+  cpu_set_t allowed;
+  ASSERT_EQ(sched_getaffinity(0, sizeof(allowed), &allowed), 0);
+  int first_cpu = 0;
+  while (first_cpu < 64 && !CPU_ISSET(first_cpu, &allowed)) {
+    first_cpu++;
+  }
+  ASSERT_LT(first_cpu, 64);
+  int process_nice = getpriority(PRIO_PROCESS, 0);
+
+  // Raising the nice value and narrowing the affinity need no privileges.
+  ThreadPolicy background;
+  background.priority = process_nice + 5;
+  background.cpu_mask = uint64_t{1} << first_cpu;
+  SetThreadPolicy(kBackground, background);
+
+  ThreadState state = ApplyOnNewThread(kBackground);
+  EXPECT_EQ(state.nice, process_nice + 5);
+  EXPECT_EQ(CPU_COUNT(&state.cpu_set), 1);
+  EXPECT_TRUE(CPU_ISSET(first_cpu, &state.cpu_set));
+
+  // Threads without a policy are left unchanged.
+  state = ApplyOnNewThread(kDisplay);
+  EXPECT_EQ(state.nice, process_nice);
+  EXPECT_TRUE(CPU_EQUAL(&state.cpu_set, &allowed));
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -8,6 +8,7 @@
 #include <utility>
 
 #include "flutter/shell/platform/tizen/tizen_renderer_evas_gl.h"
+#include "flutter/shell/platform/tizen/tracer.h"
 
 namespace flutter {
 
@@ -36,6 +37,8 @@ bool TizenEventLoop::RunsTasksOnCurrentThread() const {
 }
 
 void TizenEventLoop::ExecuteTaskEvents() {
+  FT_TRACE_SCOPE("TizenEventLoop::ExecuteTaskEvents");
+
   const TaskTimePoint now = TaskTimePoint::clock::now();
   {
     std::lock_guard<std::mutex> lock1(task_queue_mutex_);
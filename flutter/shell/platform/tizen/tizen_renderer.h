@@ -25,6 +25,17 @@ class TizenRenderer {
   virtual std::unique_ptr<ExternalTexture> CreateExternalTexture(
       const FlutterDesktopTextureInfo* texture_info) = 0;
 
+  // The compositor to be passed to the engine along with the renderer config,
+  // or nullptr if the renderer only presents through the renderer config.
+  virtual const FlutterCompositor* GetCompositor() { return nullptr; }
+
+  // Presents the layers of a frame composited by the engine. Only called on
+  // renderers that provide a compositor, on the raster thread.
+  virtual bool PresentLayers(const FlutterLayer** layers,
+                             size_t layers_count) {
+    return false;
+  }
+
  protected:
   bool CreateSurface(TizenViewBase* view);
   virtual bool CreateSurface(void* render_target,
@@ -20,12 +20,70 @@
 #include "flutter/shell/platform/tizen/external_texture_surface_egl.h"
 #include "flutter/shell/platform/tizen/external_texture_surface_egl_impeller.h"
 #include "flutter/shell/platform/tizen/logger.h"
+#include "flutter/shell/platform/tizen/tracer.h"
 
 namespace flutter {
 
+namespace {
+
+// The attribute locations of |kVertexShader|.
+constexpr GLuint kPositionAttribute = 0;
+constexpr GLuint kTexCoordAttribute = 1;
+
+constexpr char kVertexShader[] = R"(
+attribute vec2 position;
+attribute vec2 tex_coord_in;
+varying vec2 tex_coord;
+void main() {
+  tex_coord = tex_coord_in;
+  gl_Position = vec4(position, 0.0, 1.0);
+}
+)";
+
+constexpr char kFragmentShader[] = R"(
+precision mediump float;
+uniform sampler2D layer_texture;
+varying vec2 tex_coord;
+void main() {
+  gl_FragColor = texture2D(layer_texture, tex_coord);
+}
+)";
+
+// The GL objects of a backing store.
+struct GLBackingStore {
+  GLuint texture = 0;
+  GLuint framebuffer = 0;
+  GLuint stencil_buffer = 0;
+};
+
+GLuint CompileShader(GLenum type, const char* source) {
+  GLuint shader = glCreateShader(type);
+  glShaderSource(shader, 1, &source, nullptr);
+  glCompileShader(shader);
+  GLint compiled = GL_FALSE;
+  glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+  if (compiled != GL_TRUE) {
+    char log[512] = {};
+    glGetShaderInfoLog(shader, sizeof(log), nullptr, log);
+    FT_LOG(Error) << "Could not compile a shader: " << log;
+    glDeleteShader(shader);
+    return 0;
+  }
+  return shader;
+}
+
+}  // namespace
+
 TizenRendererEgl::TizenRendererEgl(TizenViewBase* view_base,
                                    bool enable_impeller)
     : enable_impeller_(enable_impeller) {
+  InitializeCompositor();
+  TizenRenderer::CreateSurface(view_base);
+}
+
+TizenRendererEgl::TizenRendererEgl(TizenViewBase* view_base,
+                                   TizenRendererEgl* primary)
+    : enable_impeller_(primary->enable_impeller_), primary_(primary) {
   TizenRenderer::CreateSurface(view_base);
 }
 
@@ -46,6 +104,16 @@ std::unique_ptr<ExternalTexture> TizenRendererEgl::CreateExternalTexture(
             texture_info->pixel_buffer_config.callback,
             texture_info->pixel_buffer_config.user_data);
       }
+    case kFlutterDesktopPixelBufferDescriptorTexture:
+      if (enable_impeller_) {
+        return std::make_unique<ExternalTexturePixelEGLImpeller>(
+            texture_info->pixel_buffer_descriptor_config.callback,
+            texture_info->pixel_buffer_descriptor_config.user_data);
+      } else {
+        return std::make_unique<ExternalTexturePixelEGL>(
+            texture_info->pixel_buffer_descriptor_config.callback,
+            texture_info->pixel_buffer_descriptor_config.user_data);
+      }
     case kFlutterDesktopGpuSurfaceTexture:
       if (enable_impeller_) {
         return std::make_unique<ExternalTextureSurfaceEGLImpeller>(
@@ -65,6 +133,10 @@ bool TizenRendererEgl::CreateSurface(void* render_target,
                                      void* render_target_display,
                                      int32_t width,
                                      int32_t height) {
+  if (primary_) {
+    return CreateSharedSurface(render_target, render_target_display);
+  }
+
   if (render_target_display) {
     egl_display_ =
         eglGetDisplay(static_cast<wl_display*>(render_target_display));
@@ -149,7 +221,53 @@ bool TizenRendererEgl::CreateSurface(void* render_target,
   return true;
 }
 
+bool TizenRendererEgl::CreateSharedSurface(void* render_target,
+                                           void* render_target_display) {
+  if (!primary_->IsValid()) {
+    FT_LOG(Error) << "The renderer of the view owning the engine is invalid.";
+    return false;
+  }
+  // The onscreen context of |primary_| can only be made current with surfaces
+  // of the same display.
+  if (!render_target_display ||
+      eglGetDisplay(static_cast<wl_display*>(render_target_display)) !=
+          primary_->egl_display_) {
+    FT_LOG(Error) << "An additional view must be a window on the display of "
+                     "the view owning the engine.";
+    return false;
+  }
+  egl_display_ = primary_->egl_display_;
+  egl_config_ = primary_->egl_config_;
+  egl_extension_str_ = primary_->egl_extension_str_;
+
+  const EGLint attribs[] = {EGL_NONE};
+  auto* egl_window =
+      static_cast<EGLNativeWindowType*>(ecore_wl2_egl_window_native_get(
+          static_cast<Ecore_Wl2_Egl_Window*>(render_target)));
+  egl_surface_ =
+      eglCreateWindowSurface(egl_display_, egl_config_, egl_window, attribs);
+  if (egl_surface_ == EGL_NO_SURFACE) {
+    PrintEGLError();
+    FT_LOG(Error) << "Could not create an onscreen window surface.";
+    return false;
+  }
+
+  is_valid_ = true;
+  return true;
+}
+
 void TizenRendererEgl::DestroySurface() {
+  if (primary_) {
+    // The display and the contexts belong to |primary_|.
+    if (EGL_NO_SURFACE != egl_surface_) {
+      eglDestroySurface(egl_display_, egl_surface_);
+      egl_surface_ = EGL_NO_SURFACE;
+    }
+    egl_display_ = EGL_NO_DISPLAY;
+    is_valid_ = false;
+    return;
+  }
+
   if (egl_display_) {
     eglMakeCurrent(egl_display_, EGL_NO_SURFACE, EGL_NO_SURFACE,
                    EGL_NO_CONTEXT);
@@ -309,6 +427,8 @@ bool TizenRendererEgl::OnMakeResourceCurrent() {
 }
 
 bool TizenRendererEgl::OnPresent() {
+  FT_TRACE_SCOPE("TizenRendererEgl::OnPresent");
+
   if (!IsValid()) {
     return false;
   }
@@ -328,6 +448,221 @@ uint32_t TizenRendererEgl::OnGetFBO() {
   return 0;
 }
 
+void TizenRendererEgl::InitializeCompositor() {
+  compositor_.struct_size = sizeof(FlutterCompositor);
+  compositor_.user_data = this;
+  compositor_.create_backing_store_callback =
+      [](const FlutterBackingStoreConfig* config,
+         FlutterBackingStore* backing_store_out, void* user_data) -> bool {
+    auto* self = static_cast<TizenRendererEgl*>(user_data);
+    return self->CreateBackingStore(config, backing_store_out);
+  };
+  compositor_.collect_backing_store_callback =
+      [](const FlutterBackingStore* backing_store, void* user_data) -> bool {
+    // Called on the raster thread with the onscreen context current.
+    auto* store = static_cast<GLBackingStore*>(backing_store->user_data);
+    glDeleteFramebuffers(1, &store->framebuffer);
+    glDeleteTextures(1, &store->texture);
+    if (store->stencil_buffer) {
+      glDeleteRenderbuffers(1, &store->stencil_buffer);
+    }
+    delete store;
+    return true;
+  };
+  compositor_.present_view_callback =
+      [](const FlutterPresentViewInfo* info) -> bool {
+    auto* self = static_cast<TizenRendererEgl*>(info->user_data);
+    return self->PresentLayers(info->layers, info->layers_count);
+  };
+}
+
+bool TizenRendererEgl::CreateBackingStore(
+    const FlutterBackingStoreConfig* config,
+    FlutterBackingStore* backing_store_out) {
+  auto width = static_cast<GLsizei>(config->size.width);
+  auto height = static_cast<GLsizei>(config->size.height);
+  auto* store = new GLBackingStore();
+
+  glGenTextures(1, &store->texture);
+  glBindTexture(GL_TEXTURE_2D, store->texture);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA,
+               GL_UNSIGNED_BYTE, nullptr);
+  glBindTexture(GL_TEXTURE_2D, 0);
+
+  glGenFramebuffers(1, &store->framebuffer);
+  glBindFramebuffer(GL_FRAMEBUFFER, store->framebuffer);
+  glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
+                         store->texture, 0);
+  if (enable_impeller_) {
+    // Impeller requires a stencil buffer, as requested by the EGL config of
+    // the window surface.
+    glGenRenderbuffers(1, &store->stencil_buffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, store->stencil_buffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_STENCIL_INDEX8, width, height);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT,
+                              GL_RENDERBUFFER, store->stencil_buffer);
+  }
+  GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+  glBindFramebuffer(GL_FRAMEBUFFER, 0);
+  if (status != GL_FRAMEBUFFER_COMPLETE) {
+    FT_LOG(Error) << "Could not create a " << width << "x" << height
+                  << " backing store: " << status;
+    glDeleteFramebuffers(1, &store->framebuffer);
+    glDeleteTextures(1, &store->texture);
+    if (store->stencil_buffer) {
+      glDeleteRenderbuffers(1, &store->stencil_buffer);
+    }
+    delete store;
+    return false;
+  }
+
+  backing_store_out->type = kFlutterBackingStoreTypeOpenGL;
+  backing_store_out->user_data = store;
+  backing_store_out->open_gl.type = kFlutterOpenGLTargetTypeFramebuffer;
+  backing_store_out->open_gl.framebuffer.target = GL_RGBA8_OES;
+  backing_store_out->open_gl.framebuffer.name = store->framebuffer;
+  backing_store_out->open_gl.framebuffer.user_data = nullptr;
+  // The GL objects are deleted by the collect callback.
+  backing_store_out->open_gl.framebuffer.destruction_callback =
+      [](void* user_data) {};
+  return true;
+}
+
+bool TizenRendererEgl::PresentLayers(const FlutterLayer** layers,
+                                     size_t layers_count) {
+  if (!IsValid()) {
+    return false;
+  }
+  if (primary_) {
+    return primary_->DrawLayers(egl_surface_, layers, layers_count);
+  }
+  return DrawLayers(egl_surface_, layers, layers_count);
+}
+
+bool TizenRendererEgl::DrawLayers(EGLSurface surface,
+                                  const FlutterLayer** layers,
+                                  size_t layers_count) {
+  FT_TRACE_SCOPE("TizenRendererEgl::DrawLayers");
+
+  if (surface != egl_surface_ &&
+      eglMakeCurrent(egl_display_, surface, surface, egl_context_) !=
+          EGL_TRUE) {
+    PrintEGLError();
+    FT_LOG(Error) << "Could not make the surface of a view current.";
+    return false;
+  }
+
+  bool result = program_ || CreateProgram();
+  if (result) {
+    EGLint width = 0;
+    EGLint height = 0;
+    eglQuerySurface(egl_display_, surface, EGL_WIDTH, &width);
+    eglQuerySurface(egl_display_, surface, EGL_HEIGHT, &height);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glViewport(0, 0, width, height);
+    glDisable(GL_SCISSOR_TEST);
+    glClearColor(0, 0, 0, 0);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    glUseProgram(program_);
+    // The layers have premultiplied alpha.
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    glActiveTexture(GL_TEXTURE0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glEnableVertexAttribArray(kPositionAttribute);
+    glEnableVertexAttribArray(kTexCoordAttribute);
+
+    // Platform views are composited by the embedder through textures, so only
+    // backing store layers are drawn.
+    for (size_t i = 0; i < layers_count; i++) {
+      const FlutterLayer* layer = layers[i];
+      if (layer->type != kFlutterLayerContentTypeBackingStore) {
+        continue;
+      }
+      auto* store =
+          static_cast<GLBackingStore*>(layer->backing_store->user_data);
+      // Layer offsets are top-down while GL coordinates are bottom-up. The
+      // textures are bottom-up too, so they are drawn unflipped.
+      GLfloat left = layer->offset.x / width * 2 - 1;
+      GLfloat right = (layer->offset.x + layer->size.width) / width * 2 - 1;
+      GLfloat top = 1 - layer->offset.y / height * 2;
+      GLfloat bottom = 1 - (layer->offset.y + layer->size.height) / height * 2;
+      const GLfloat positions[] = {left, bottom, right, bottom,
+                                   left, top,    right, top};
+      const GLfloat tex_coords[] = {0, 0, 1, 0, 0, 1, 1, 1};
+      glVertexAttribPointer(kPositionAttribute, 2, GL_FLOAT, GL_FALSE, 0,
+                            positions);
+      glVertexAttribPointer(kTexCoordAttribute, 2, GL_FLOAT, GL_FALSE, 0,
+                            tex_coords);
+      glBindTexture(GL_TEXTURE_2D, store->texture);
+      glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+    }
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glDisableVertexAttribArray(kPositionAttribute);
+    glDisableVertexAttribArray(kTexCoordAttribute);
+    glDisable(GL_BLEND);
+    glUseProgram(0);
+
+    if (eglSwapBuffers(egl_display_, surface) != EGL_TRUE) {
+      PrintEGLError();
+      FT_LOG(Error) << "Could not swap EGL buffers.";
+      result = false;
+    }
+  }
+
+  if (surface != egl_surface_ &&
+      eglMakeCurrent(egl_display_, egl_surface_, egl_surface_, egl_context_) !=
+          EGL_TRUE) {
+    PrintEGLError();
+    FT_LOG(Error) << "Could not make the onscreen context current.";
+    return false;
+  }
+  return result;
+}
+
+bool TizenRendererEgl::CreateProgram() {
+  GLuint vertex_shader = CompileShader(GL_VERTEX_SHADER, kVertexShader);
+  GLuint fragment_shader = CompileShader(GL_FRAGMENT_SHADER, kFragmentShader);
+  if (!vertex_shader || !fragment_shader) {
+    glDeleteShader(vertex_shader);
+    glDeleteShader(fragment_shader);
+    return false;
+  }
+
+  GLuint program = glCreateProgram();
+  glAttachShader(program, vertex_shader);
+  glAttachShader(program, fragment_shader);
+  glBindAttribLocation(program, kPositionAttribute, "position");
+  glBindAttribLocation(program, kTexCoordAttribute, "tex_coord_in");
+  glLinkProgram(program);
+  glDeleteShader(vertex_shader);
+  glDeleteShader(fragment_shader);
+
+  GLint linked = GL_FALSE;
+  glGetProgramiv(program, GL_LINK_STATUS, &linked);
+  if (linked != GL_TRUE) {
+    char log[512] = {};
+    glGetProgramInfoLog(program, sizeof(log), nullptr, log);
+    FT_LOG(Error) << "Could not link the compositor program: " << log;
+    glDeleteProgram(program);
+    return false;
+  }
+
+  glUseProgram(program);
+  glUniform1i(glGetUniformLocation(program, "layer_texture"), 0);
+  glUseProgram(0);
+  program_ = program;
+  return true;
+}
+
 void TizenRendererEgl::PrintEGLError() {
   EGLint error = eglGetError();
   switch (error) {
@@ -6,6 +6,7 @@
 #define EMBEDDER_TIZEN_RENDERER_EGL_H_
 
 #include <EGL/egl.h>
+#include <GLES2/gl2.h>
 
 #include <string>
 
@@ -20,6 +21,11 @@ class TizenRendererEgl : public TizenRendererGL {
  public:
   explicit TizenRendererEgl(TizenViewBase* view_base, bool enable_impeller);
 
+  // Creates a renderer for the window of an additional view, which draws with
+  // the display and the onscreen context of |primary|. Its frames are only
+  // presented through the compositor of |primary|.
+  TizenRendererEgl(TizenViewBase* view_base, TizenRendererEgl* primary);
+
   virtual ~TizenRendererEgl();
 
   virtual bool OnMakeCurrent() override;
@@ -41,6 +47,17 @@ class TizenRendererEgl : public TizenRendererGL {
   virtual std::unique_ptr<ExternalTexture> CreateExternalTexture(
       const FlutterDesktopTextureInfo* texture_info) override;
 
+  // The compositor that renders frames into textures and draws them into the
+  // window surface of each view, so that the engine can render additional
+  // views. Presenting through it costs an extra draw per frame, so it is only
+  // used by engines with additional views.
+  const FlutterCompositor* GetCompositor() override { return &compositor_; }
+
+  // Draws the backing store layers among |layers| into the window surface.
+  // Called on the raster thread with the onscreen context current.
+  bool PresentLayers(const FlutterLayer** layers,
+                     size_t layers_count) override;
+
  protected:
   bool CreateSurface(void* render_target,
                      void* render_target_display,
@@ -54,6 +71,24 @@ class TizenRendererEgl : public TizenRendererGL {
 
   void PrintEGLError();
 
+  // Creates |egl_surface_| for an additional view on the display of
+  // |primary_|.
+  bool CreateSharedSurface(void* render_target, void* render_target_display);
+
+  void InitializeCompositor();
+
+  bool CreateBackingStore(const FlutterBackingStoreConfig* config,
+                          FlutterBackingStore* backing_store_out);
+
+  // Draws |layers| into |surface| with the onscreen context, then makes
+  // |egl_surface_| current again.
+  bool DrawLayers(EGLSurface surface,
+                  const FlutterLayer** layers,
+                  size_t layers_count);
+
+  // Creates |program_|, which draws a texture into a rectangle.
+  bool CreateProgram();
+
   EGLConfig egl_config_ = nullptr;
   EGLDisplay egl_display_ = EGL_NO_DISPLAY;
   EGLContext egl_context_ = EGL_NO_CONTEXT;
@@ -63,6 +98,15 @@ class TizenRendererEgl : public TizenRendererGL {
 
   std::string egl_extension_str_;
   bool enable_impeller_;
+
+  // The renderer whose display and contexts are shared, or nullptr if this
+  // renderer owns them.
+  TizenRendererEgl* primary_ = nullptr;
+
+  FlutterCompositor compositor_ = {};
+
+  // Only accessed on the raster thread. Deleted along with |egl_context_|.
+  GLuint program_ = 0;
 };
 
 }  // namespace flutter
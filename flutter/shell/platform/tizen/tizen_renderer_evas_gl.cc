@@ -31,6 +31,10 @@ std::unique_ptr<ExternalTexture> TizenRendererEvasGL::CreateExternalTexture(
       return std::make_unique<ExternalTexturePixelEvasGL>(
           texture_info->pixel_buffer_config.callback,
           texture_info->pixel_buffer_config.user_data);
+    case kFlutterDesktopPixelBufferDescriptorTexture:
+      return std::make_unique<ExternalTexturePixelEvasGL>(
+          texture_info->pixel_buffer_descriptor_config.callback,
+          texture_info->pixel_buffer_descriptor_config.user_data);
     case kFlutterDesktopGpuSurfaceTexture:
       return std::make_unique<ExternalTextureSurfaceEvasGL>(
           GetExternalTextureExtensionType(),
@@ -72,6 +76,8 @@ bool TizenRendererEvasGL::CreateSurface(void* render_target,
   gl_surface_ = evas_gl_surface_create(evas_gl_, gl_config_, width, height);
   gl_resource_surface_ = evas_gl_pbuffer_surface_create(evas_gl_, gl_config_,
                                                         width, height, nullptr);
+  surface_width_ = width;
+  surface_height_ = height;
 
   Evas_Native_Surface native_surface;
   evas_gl_native_surface_get(evas_gl_, gl_surface_, &native_surface);
@@ -173,14 +179,19 @@ void TizenRendererEvasGL::MarkPixelsDirty() {
 }
 
 void TizenRendererEvasGL::ResizeSurface(int32_t width, int32_t height) {
+  if (width == surface_width_ && height == surface_height_) {
+    return;
+  }
+  surface_width_ = width;
+  surface_height_ = height;
+
+  // The resource surface is never presented, so only the onscreen surface
+  // needs to follow the size of the view.
   evas_gl_surface_destroy(evas_gl_, gl_surface_);
-  evas_gl_surface_destroy(evas_gl_, gl_resource_surface_);
 
   evas_object_image_native_surface_set(image_, nullptr);
   evas_object_image_size_set(image_, width, height);
   gl_surface_ = evas_gl_surface_create(evas_gl_, gl_config_, width, height);
-  gl_resource_surface_ = evas_gl_pbuffer_surface_create(evas_gl_, gl_config_,
-                                                        width, height, nullptr);
 
   Evas_Native_Surface native_surface;
   evas_gl_native_surface_get(evas_gl_, gl_surface_, &native_surface);
@@ -62,6 +62,8 @@ class TizenRendererEvasGL : public TizenRendererGL {
   Evas_GL_Context* gl_resource_context_ = nullptr;
   Evas_GL_Surface* gl_surface_ = nullptr;
   Evas_GL_Surface* gl_resource_surface_ = nullptr;
+  int32_t surface_width_ = 0;
+  int32_t surface_height_ = 0;
 
   Evas_Object* image_ = nullptr;
   OnPixelsDirty on_pixels_dirty_;
@@ -14,6 +14,10 @@ namespace flutter {
 TizenRendererGL::TizenRendererGL() {}
 
 FlutterRendererConfig TizenRendererGL::GetRendererConfig() {
+  return CreateRendererConfig();
+}
+
+FlutterRendererConfig TizenRendererGL::CreateRendererConfig() {
   FlutterRendererConfig config = {};
   config.type = kOpenGL;
   config.open_gl.struct_size = sizeof(config.open_gl);
@@ -22,6 +26,7 @@ FlutterRendererConfig TizenRendererGL::GetRendererConfig() {
     if (!engine->view()) {
       return false;
     }
+    engine->frame_statistics()->OnMakeCurrent();
     return dynamic_cast<TizenRendererGL*>(engine->renderer())->OnMakeCurrent();
   };
   config.open_gl.make_resource_current = [](void* user_data) -> bool {
@@ -44,14 +49,28 @@ FlutterRendererConfig TizenRendererGL::GetRendererConfig() {
     if (!engine->view()) {
       return false;
     }
-    return dynamic_cast<TizenRendererGL*>(engine->renderer())->OnPresent();
+    auto* renderer = dynamic_cast<TizenRendererGL*>(engine->renderer());
+    if (!engine->view()->ShouldPresentFrame(renderer->frame_width_,
+                                            renderer->frame_height_)) {
+      // A frame rendered for the previous window size.
+      return true;
+    }
+    engine->frame_statistics()->OnPresentBegin();
+    bool result = renderer->OnPresent();
+    engine->frame_statistics()->OnPresentEnd();
+    return result;
   };
-  config.open_gl.fbo_callback = [](void* user_data) -> uint32_t {
+  config.open_gl.fbo_with_frame_info_callback =
+      [](void* user_data, const FlutterFrameInfo* frame_info) -> uint32_t {
     auto* engine = static_cast<FlutterTizenEngine*>(user_data);
     if (!engine->view()) {
       return false;
     }
-    return dynamic_cast<TizenRendererGL*>(engine->renderer())->OnGetFBO();
+    auto* renderer = dynamic_cast<TizenRendererGL*>(engine->renderer());
+    renderer->frame_width_ = frame_info->size.width;
+    renderer->frame_height_ = frame_info->size.height;
+    engine->frame_statistics()->OnFrameBegin();
+    return renderer->OnGetFBO();
   };
   config.open_gl.surface_transformation =
       [](void* user_data) -> FlutterTransformation {
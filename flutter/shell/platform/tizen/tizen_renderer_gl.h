@@ -5,6 +5,7 @@
 #ifndef EMBEDDER_TIZEN_RENDERER_GL_H_
 #define EMBEDDER_TIZEN_RENDERER_GL_H_
 
+#include <cstddef>
 #include <cstdint>
 #include "flutter/shell/platform/embedder/embedder.h"
 #include "flutter/shell/platform/tizen/tizen_renderer.h"
@@ -34,7 +35,17 @@ class TizenRendererGL : public TizenRenderer {
 
   FlutterRendererConfig GetRendererConfig() override;
 
+  // Creates an OpenGL renderer config whose callbacks look up the renderer
+  // through the engine, so it can be used before any renderer is created.
+  static FlutterRendererConfig CreateRendererConfig();
+
   ExternalTextureExtensionType GetExternalTextureExtensionType();
+
+ private:
+  // The size of the frame being rendered, in physical pixels. Only accessed on
+  // the raster thread.
+  size_t frame_width_ = 0;
+  size_t frame_height_ = 0;
 };
 
 }  // namespace flutter
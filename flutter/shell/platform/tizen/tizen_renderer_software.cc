@@ -0,0 +1,311 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "tizen_renderer_software.h"
+
+#include <Ecore.h>
+#include <Elementary.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+
+#include "flutter/shell/platform/tizen/flutter_tizen_engine.h"
+#include "flutter/shell/platform/tizen/logger.h"
+#include "flutter/shell/platform/tizen/tizen_view_elementary.h"
+#include "flutter/shell/platform/tizen/tizen_window_elementary.h"
+
+namespace flutter {
+
+namespace {
+
+constexpr size_t kBytesPerPixel = 4;
+
+// The number of pending damage rectangles above which they are merged into
+// their bounding box.
+constexpr size_t kMaxPendingDamageRects = 16;
+
+// Presents frames into an Evas image with the ARGB8888 colorspace, whose
+// memory layout is BGRA on little-endian CPUs.
+//
+// Evas must only be accessed on the main thread, so damaged rows are staged
+// on the raster thread and copied into the image on the main thread.
+class EvasImageSink : public SoftwareSurfaceSink {
+ public:
+  explicit EvasImageSink(Evas_Object* image)
+      : state_(std::make_shared<State>()) {
+    state_->image = image;
+    evas_object_image_colorspace_set(image, EVAS_COLORSPACE_ARGB8888);
+    evas_object_image_alpha_set(image, EINA_TRUE);
+  }
+
+  ~EvasImageSink() {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    state_->image = nullptr;
+  }
+
+  FlutterSoftwarePixelFormat GetPixelFormat() override {
+    return kFlutterSoftwarePixelFormatBGRA8888;
+  }
+
+  bool Present(const uint8_t* frame,
+               size_t row_bytes,
+               size_t width,
+               size_t height,
+               const std::vector<SoftwareSurfaceRect>& damage) override {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    if (width != state_->width || height != state_->height) {
+      state_->width = width;
+      state_->height = height;
+      state_->pixels.resize(width * height * kBytesPerPixel);
+      state_->damage.clear();
+    }
+    size_t staging_row_bytes = width * kBytesPerPixel;
+    for (const SoftwareSurfaceRect& rect : damage) {
+      for (size_t y = rect.top; y < rect.top + rect.height; y++) {
+        memcpy(state_->pixels.data() + y * staging_row_bytes +
+                   rect.left * kBytesPerPixel,
+               frame + y * row_bytes + rect.left * kBytesPerPixel,
+               rect.width * kBytesPerPixel);
+      }
+    }
+    AddDamage(damage);
+
+    if (!state_->commit_scheduled) {
+      state_->commit_scheduled = true;
+      ecore_main_loop_thread_safe_call_async(
+          [](void* data) {
+            std::unique_ptr<std::shared_ptr<State>> state(
+                static_cast<std::shared_ptr<State>*>(data));
+            Commit(state->get());
+          },
+          new std::shared_ptr<State>(state_));
+    }
+    return true;
+  }
+
+ private:
+  struct State {
+    std::mutex mutex;
+    // Null once the sink is destroyed.
+    Evas_Object* image = nullptr;
+    bool commit_scheduled = false;
+
+    // The latest frame, of which only the pending damage is up to date.
+    std::vector<uint8_t> pixels;
+    size_t width = 0;
+    size_t height = 0;
+    std::vector<SoftwareSurfaceRect> damage;
+
+    // The size of the image data.
+    size_t image_width = 0;
+    size_t image_height = 0;
+  };
+
+  void AddDamage(const std::vector<SoftwareSurfaceRect>& damage) {
+    std::vector<SoftwareSurfaceRect>& pending = state_->damage;
+    pending.insert(pending.end(), damage.begin(), damage.end());
+    if (pending.size() <= kMaxPendingDamageRects) {
+      return;
+    }
+    size_t left = pending[0].left, top = pending[0].top;
+    size_t right = left + pending[0].width, bottom = top + pending[0].height;
+    for (const SoftwareSurfaceRect& rect : pending) {
+      left = std::min(left, rect.left);
+      top = std::min(top, rect.top);
+      right = std::max(right, rect.left + rect.width);
+      bottom = std::max(bottom, rect.top + rect.height);
+    }
+    pending = {{left, top, right - left, bottom - top}};
+  }
+
+  // Copies the pending damage into the image. Called on the main thread.
+  static void Commit(State* state) {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->commit_scheduled = false;
+    if (!state->image || state->damage.empty()) {
+      return;
+    }
+    if (state->width != state->image_width ||
+        state->height != state->image_height) {
+      evas_object_image_size_set(state->image, state->width, state->height);
+      state->image_width = state->width;
+      state->image_height = state->height;
+      // The image data is reallocated, so the whole frame is needed.
+      state->damage = {{0, 0, state->width, state->height}};
+    }
+
+    auto* data = static_cast<uint8_t*>(
+        evas_object_image_data_get(state->image, EINA_TRUE));
+    if (!data) {
+      FT_LOG(Error) << "Could not get the image data.";
+      return;
+    }
+    size_t image_row_bytes = evas_object_image_stride_get(state->image);
+    size_t staging_row_bytes = state->width * kBytesPerPixel;
+    for (const SoftwareSurfaceRect& rect : state->damage) {
+      for (size_t y = rect.top; y < rect.top + rect.height; y++) {
+        memcpy(data + y * image_row_bytes + rect.left * kBytesPerPixel,
+               state->pixels.data() + y * staging_row_bytes +
+                   rect.left * kBytesPerPixel,
+               rect.width * kBytesPerPixel);
+      }
+    }
+    evas_object_image_data_set(state->image, data);
+    for (const SoftwareSurfaceRect& rect : state->damage) {
+      evas_object_image_data_update_add(state->image, rect.left, rect.top,
+                                        rect.width, rect.height);
+    }
+    state->damage.clear();
+  }
+
+  std::shared_ptr<State> state_;
+};
+
+}  // namespace
+
+TizenRendererSoftware::TizenRendererSoftware(TizenViewBase* view_base) {
+  InitializeCompositor();
+  if (!dynamic_cast<TizenWindowElementary*>(view_base) &&
+      !dynamic_cast<TizenViewElementary*>(view_base)) {
+    FT_LOG(Error) << "The software renderer requires an Elementary window or "
+                     "view.";
+    return;
+  }
+  TizenRenderer::CreateSurface(view_base);
+}
+
+TizenRendererSoftware::TizenRendererSoftware(
+    std::unique_ptr<SoftwareSurfaceSink> sink) {
+  InitializeCompositor();
+  surface_ = std::make_unique<SoftwareSurface>(std::move(sink));
+  is_valid_ = true;
+}
+
+TizenRendererSoftware::~TizenRendererSoftware() {
+  DestroySurface();
+}
+
+bool TizenRendererSoftware::CreateSurface(void* render_target,
+                                          void* render_target_display,
+                                          int32_t width,
+                                          int32_t height) {
+  auto* image = static_cast<Evas_Object*>(render_target);
+  if (!image) {
+    FT_LOG(Error) << "Invalid render target.";
+    return false;
+  }
+  surface_ =
+      std::make_unique<SoftwareSurface>(std::make_unique<EvasImageSink>(image));
+  is_valid_ = true;
+  return true;
+}
+
+void TizenRendererSoftware::DestroySurface() {
+  surface_.reset();
+  is_valid_ = false;
+}
+
+void TizenRendererSoftware::ResizeSurface(int32_t width, int32_t height) {
+  // The surface follows the size of the frames rendered by the engine.
+}
+
+FlutterRendererConfig TizenRendererSoftware::GetRendererConfig() {
+  FlutterRendererConfig config = {};
+  config.type = kSoftware;
+  config.software.struct_size = sizeof(config.software);
+  // Only used if the engine doesn't support the compositor.
+  config.software.surface_present_callback =
+      [](void* user_data, const void* allocation, size_t row_bytes,
+         size_t height) -> bool {
+    auto* engine = static_cast<FlutterTizenEngine*>(user_data);
+    auto* renderer = dynamic_cast<TizenRendererSoftware*>(engine->renderer());
+    return renderer && renderer->Present(allocation, row_bytes,
+                                         row_bytes / kBytesPerPixel, height);
+  };
+  return config;
+}
+
+std::unique_ptr<ExternalTexture> TizenRendererSoftware::CreateExternalTexture(
+    const FlutterDesktopTextureInfo* texture_info) {
+  FT_LOG(Error) << "External textures are not supported by the software "
+                   "renderer.";
+  return nullptr;
+}
+
+bool TizenRendererSoftware::Present(const void* allocation,
+                                    size_t row_bytes,
+                                    size_t width,
+                                    size_t height) {
+  if (!surface_) {
+    return false;
+  }
+  return surface_->Present(allocation, row_bytes, width, height);
+}
+
+bool TizenRendererSoftware::PresentLayers(const FlutterLayer** layers,
+                                          size_t layers_count) {
+  // Platform views are composited by the embedder through textures, so the
+  // engine only presents a single backing store layer.
+  for (size_t i = 0; i < layers_count; i++) {
+    const FlutterLayer* layer = layers[i];
+    if (layer->type != kFlutterLayerContentTypeBackingStore) {
+      continue;
+    }
+    const FlutterSoftwareBackingStore2& backing_store =
+        layer->backing_store->software2;
+    size_t width = std::min(static_cast<size_t>(layer->size.width),
+                            backing_store.row_bytes / kBytesPerPixel);
+    size_t height =
+        std::min(static_cast<size_t>(layer->size.height), backing_store.height);
+    return Present(backing_store.allocation, backing_store.row_bytes, width,
+                   height);
+  }
+  return true;
+}
+
+void TizenRendererSoftware::InitializeCompositor() {
+  compositor_.struct_size = sizeof(FlutterCompositor);
+  compositor_.user_data = this;
+  compositor_.create_backing_store_callback =
+      [](const FlutterBackingStoreConfig* config,
+         FlutterBackingStore* backing_store_out, void* user_data) -> bool {
+    size_t width = static_cast<size_t>(config->size.width);
+    size_t height = static_cast<size_t>(config->size.height);
+    size_t row_bytes = width * kBytesPerPixel;
+    void* allocation = calloc(height, row_bytes);
+    if (!allocation) {
+      FT_LOG(Error) << "Could not allocate a " << width << "x" << height
+                    << " backing store.";
+      return false;
+    }
+    backing_store_out->type = kFlutterBackingStoreTypeSoftware2;
+    backing_store_out->user_data = nullptr;
+    backing_store_out->software2.struct_size =
+        sizeof(FlutterSoftwareBackingStore2);
+    backing_store_out->software2.allocation = allocation;
+    backing_store_out->software2.row_bytes = row_bytes;
+    backing_store_out->software2.height = height;
+    backing_store_out->software2.user_data = allocation;
+    backing_store_out->software2.destruction_callback = [](void* user_data) {
+      free(user_data);
+    };
+    backing_store_out->software2.pixel_format =
+        kFlutterSoftwarePixelFormatBGRA8888;
+    return true;
+  };
+  compositor_.collect_backing_store_callback =
+      [](const FlutterBackingStore* backing_store, void* user_data) -> bool {
+    // The allocation is freed by the destruction callback.
+    return true;
+  };
+  compositor_.present_view_callback =
+      [](const FlutterPresentViewInfo* info) -> bool {
+    auto* self = static_cast<TizenRendererSoftware*>(info->user_data);
+    return self->PresentLayers(info->layers, info->layers_count);
+  };
+}
+
+}  // namespace flutter
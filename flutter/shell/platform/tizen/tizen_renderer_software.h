@@ -0,0 +1,82 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef EMBEDDER_TIZEN_RENDERER_SOFTWARE_H_
+#define EMBEDDER_TIZEN_RENDERER_SOFTWARE_H_
+
+#include <memory>
+
+#include "flutter/shell/platform/embedder/embedder.h"
+#include "flutter/shell/platform/tizen/external_texture.h"
+#include "flutter/shell/platform/tizen/software_surface.h"
+#include "flutter/shell/platform/tizen/tizen_renderer.h"
+#include "flutter/shell/platform/tizen/tizen_view_base.h"
+
+namespace flutter {
+
+// A renderer for devices without usable GL, such as low-end devices and
+// emulators.
+//
+// The engine rasterizes frames on the CPU into software backing stores
+// provided by the compositor of this renderer, which are then copied into an
+// Evas image. Only the damaged area of each frame is copied and updated.
+//
+// Limitations:
+// - External textures are not supported, because the engine's software
+//   renderer has no external texture callback. CreateExternalTexture always
+//   fails, so plugins such as video players cannot display frames.
+// - Every frame is compared with the previous one in full to find the damage,
+//   since the engine does not report it. The damaged spans are then copied
+//   three times: into the last frame kept by SoftwareSurface, into the
+//   staging buffer of the sink, and into the Evas image on the main thread.
+class TizenRendererSoftware : public TizenRenderer {
+ public:
+  // Renders into the Evas image of an Elementary window or view.
+  explicit TizenRendererSoftware(TizenViewBase* view_base);
+
+  // Renders into |sink|.
+  explicit TizenRendererSoftware(std::unique_ptr<SoftwareSurfaceSink> sink);
+
+  virtual ~TizenRendererSoftware();
+
+  void ResizeSurface(int32_t width, int32_t height) override;
+
+  FlutterRendererConfig GetRendererConfig() override;
+
+  const FlutterCompositor* GetCompositor() override { return &compositor_; }
+
+  std::unique_ptr<ExternalTexture> CreateExternalTexture(
+      const FlutterDesktopTextureInfo* texture_info) override;
+
+  // Presents a frame of |width| x |height| BGRA8888 pixels. Called on the
+  // raster thread.
+  bool Present(const void* allocation,
+               size_t row_bytes,
+               size_t width,
+               size_t height);
+
+  // Presents the backing store layer among |layers|. Called on the raster
+  // thread.
+  bool PresentLayers(const FlutterLayer** layers,
+                     size_t layers_count) override;
+
+ protected:
+  bool CreateSurface(void* render_target,
+                     void* render_target_display,
+                     int32_t width,
+                     int32_t height) override;
+
+  void DestroySurface() override;
+
+ private:
+  void InitializeCompositor();
+
+  std::unique_ptr<SoftwareSurface> surface_;
+
+  FlutterCompositor compositor_ = {};
+};
+
+}  // namespace flutter
+
+#endif  // EMBEDDER_TIZEN_RENDERER_SOFTWARE_H_
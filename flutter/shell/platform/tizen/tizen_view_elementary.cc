@@ -306,11 +306,24 @@ void TizenViewElementary::RegisterEventHandlers() {
     if (self->view_delegate_) {
       if (self->container_ == object) {
         self->focused_ = true;
+        self->view_delegate_->OnFocusChange(true);
       }
     }
   };
   evas_object_smart_callback_add(container_, "focused", focused_callback_,
                                  this);
+
+  unfocused_callback_ = [](void* data, Evas_Object* object, void* event_info) {
+    auto* self = static_cast<TizenViewElementary*>(data);
+    if (self->view_delegate_) {
+      if (self->container_ == object) {
+        self->focused_ = false;
+        self->view_delegate_->OnFocusChange(false);
+      }
+    }
+  };
+  evas_object_smart_callback_add(container_, "unfocused", unfocused_callback_,
+                                 this);
 }
 
 void TizenViewElementary::UnregisterEventHandlers() {
@@ -334,6 +347,7 @@ void TizenViewElementary::UnregisterEventHandlers() {
   evas_object_event_callback_del(container_, EVAS_CALLBACK_KEY_UP,
                                  evas_object_callbacks_[EVAS_CALLBACK_KEY_UP]);
   evas_object_smart_callback_del(container_, "focused", focused_callback_);
+  evas_object_smart_callback_del(container_, "unfocused", unfocused_callback_);
 }
 
 TizenGeometry TizenViewElementary::GetGeometry() {
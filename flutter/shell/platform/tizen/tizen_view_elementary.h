@@ -60,6 +60,7 @@ class TizenViewElementary : public TizenView {
       evas_object_callbacks_;
   std::vector<Ecore_Event_Handler*> ecore_event_key_handlers_;
   Evas_Smart_Cb focused_callback_ = nullptr;
+  Evas_Smart_Cb unfocused_callback_ = nullptr;
 
   bool scroll_hold_ = false;
 };
@@ -64,6 +64,8 @@ class TizenViewEventHandlerDelegate {
   virtual void OnComposeEnd() = 0;
 
   virtual void OnCommit(const std::string& str) = 0;
+
+  virtual void OnFocusChange(bool focused) = 0;
 };
 
 }  // namespace flutter
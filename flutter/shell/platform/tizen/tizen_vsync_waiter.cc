@@ -8,6 +8,8 @@
 
 #include "flutter/shell/platform/tizen/flutter_tizen_engine.h"
 #include "flutter/shell/platform/tizen/logger.h"
+#include "flutter/shell/platform/tizen/thread_policy.h"
+#include "flutter/shell/platform/tizen/tracer.h"
 
 namespace flutter {
 
@@ -67,6 +69,7 @@ void TizenVsyncWaiter::SendMessage(int event, intptr_t baton) {
 
 void TizenVsyncWaiter::RunVblankLoop(void* data, Ecore_Thread* thread) {
   auto* self = static_cast<TizenVsyncWaiter*>(data);
+  ApplyThreadPolicy(kDisplay);
 
   std::weak_ptr<TdmClient> tdm_client = self->tdm_client_;
   if (!tdm_client.lock()->IsValid()) {
@@ -168,6 +171,7 @@ void TdmClient::VblankCallback(tdm_client_vblank* vblank,
                                void* user_data) {
   auto* self = static_cast<TdmClient*>(user_data);
   FT_ASSERT(self != nullptr);
+  FT_TRACE_EVENT_INSTANT("TdmClient::OnVblank");
 
   std::lock_guard<std::mutex> lock(self->engine_mutex_);
   if (self->engine_) {
@@ -25,6 +25,10 @@ class TizenWindow : public TizenViewBase {
 
   virtual void* GetRenderTargetDisplay() = 0;
 
+  // Resizes the render target to |geometry| if it doesn't follow the size of
+  // the window by itself.
+  virtual void ResizeRenderTarget(const TizenGeometry& geometry) = 0;
+
   // Returns the geometry of the display screen.
   virtual TizenGeometry GetScreenGeometry() = 0;
 
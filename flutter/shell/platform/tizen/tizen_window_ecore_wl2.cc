@@ -411,9 +411,11 @@ void TizenWindowEcoreWl2::RegisterEventHandlers() {
               reinterpret_cast<Ecore_Wl2_Event_Window_Rotation*>(event);
           if (rotation_event->win == self->GetWindowId()) {
             int32_t degree = rotation_event->angle;
+            // The EGL window is resized with the new rotation by OnRotate,
+            // which must complete before the change is acknowledged.
+            ecore_wl2_window_rotation_set(self->ecore_wl2_window_, degree);
             self->view_delegate_->OnRotate(degree);
             TizenGeometry geometry = self->GetGeometry();
-            ecore_wl2_window_rotation_set(self->ecore_wl2_window_, degree);
             ecore_wl2_window_rotation_change_done_send(
                 self->ecore_wl2_window_, rotation_event->rotation,
                 geometry.width, geometry.height);
@@ -432,11 +434,9 @@ void TizenWindowEcoreWl2::RegisterEventHandlers() {
           auto* configure_event =
               reinterpret_cast<Ecore_Wl2_Event_Window_Configure*>(event);
           if (configure_event->win == self->GetWindowId()) {
-            ecore_wl2_egl_window_resize_with_rotation(
-                self->ecore_wl2_egl_window_, configure_event->x,
-                configure_event->y, configure_event->w, configure_event->h,
-                self->GetRotation());
-
+            // The EGL window is resized along with the surface and the
+            // window metrics once per frame, so that the frames presented
+            // until then still match its size.
             self->view_delegate_->OnResize(
                 configure_event->x, configure_event->y, configure_event->w,
                 configure_event->h);
@@ -645,6 +645,12 @@ bool TizenWindowEcoreWl2::SetGeometry(TizenGeometry geometry) {
   return true;
 }
 
+void TizenWindowEcoreWl2::ResizeRenderTarget(const TizenGeometry& geometry) {
+  ecore_wl2_egl_window_resize_with_rotation(
+      ecore_wl2_egl_window_, geometry.left, geometry.top, geometry.width,
+      geometry.height, GetRotation());
+}
+
 TizenGeometry TizenWindowEcoreWl2::GetScreenGeometry() {
   TizenGeometry result = {};
   ecore_wl2_display_screen_size_get(ecore_wl2_display_, &result.width,
@@ -39,6 +39,8 @@ class TizenWindowEcoreWl2 : public TizenWindow {
 
   void* GetRenderTargetDisplay() override { return wl2_display_; }
 
+  void ResizeRenderTarget(const TizenGeometry& geometry) override;
+
   void* GetNativeHandle() override { return ecore_wl2_window_; }
 
   int32_t GetRotation() override;
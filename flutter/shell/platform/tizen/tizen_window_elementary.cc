@@ -166,6 +166,27 @@ void TizenWindowElementary::RegisterEventHandlers() {
   evas_object_smart_callback_add(elm_win_, "rotation,changed",
                                  rotation_changed_callback_, this);
 
+  focused_callback_ = [](void* data, Evas_Object* object, void* event_info) {
+    auto* self = static_cast<TizenWindowElementary*>(data);
+    if (self->view_delegate_) {
+      if (self->elm_win_ == object) {
+        self->view_delegate_->OnFocusChange(true);
+      }
+    }
+  };
+  evas_object_smart_callback_add(elm_win_, "focused", focused_callback_, this);
+
+  unfocused_callback_ = [](void* data, Evas_Object* object, void* event_info) {
+    auto* self = static_cast<TizenWindowElementary*>(data);
+    if (self->view_delegate_) {
+      if (self->elm_win_ == object) {
+        self->view_delegate_->OnFocusChange(false);
+      }
+    }
+  };
+  evas_object_smart_callback_add(elm_win_, "unfocused", unfocused_callback_,
+                                 this);
+
   evas_object_callbacks_[EVAS_CALLBACK_RESIZE] =
       [](void* data, Evas* evas, Evas_Object* object, void* event_info) {
         auto* self = static_cast<TizenWindowElementary*>(data);
@@ -321,6 +342,8 @@ void TizenWindowElementary::RegisterEventHandlers() {
 void TizenWindowElementary::UnregisterEventHandlers() {
   evas_object_smart_callback_del(elm_win_, "rotation,changed",
                                  rotation_changed_callback_);
+  evas_object_smart_callback_del(elm_win_, "focused", focused_callback_);
+  evas_object_smart_callback_del(elm_win_, "unfocused", unfocused_callback_);
 
   evas_object_event_callback_del(
       image_, EVAS_CALLBACK_MOUSE_DOWN,
@@ -36,6 +36,9 @@ class TizenWindowElementary : public TizenWindow {
 
   void* GetRenderTargetDisplay() override { return nullptr; }
 
+  // The image is resized by the renderer.
+  void ResizeRenderTarget(const TizenGeometry& geometry) override {}
+
   void* GetNativeHandle() override { return elm_win_; }
 
   int32_t GetRotation() override;
@@ -71,6 +74,8 @@ class TizenWindowElementary : public TizenWindow {
   Evas_Object* image_ = nullptr;
 
   Evas_Smart_Cb rotation_changed_callback_ = nullptr;
+  Evas_Smart_Cb focused_callback_ = nullptr;
+  Evas_Smart_Cb unfocused_callback_ = nullptr;
   std::unordered_map<Evas_Callback_Type, Evas_Object_Event_Cb>
       evas_object_callbacks_;
 };
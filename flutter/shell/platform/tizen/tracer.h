@@ -0,0 +1,86 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef EMBEDDER_TRACER_H_
+#define EMBEDDER_TRACER_H_
+
+#include <atomic>
+
+#include "flutter/shell/platform/embedder/embedder.h"
+
+namespace flutter {
+
+// Forwards embedder trace events to the engine timeline through the trace
+// functions of the embedder API proc table.
+//
+// Trace events are dropped until Start() is called with a valid proc table.
+class Tracer {
+ public:
+  static void Start(const FlutterEngineProcTable& embedder_api) {
+    duration_begin_ = embedder_api.TraceEventDurationBegin;
+    duration_end_ = embedder_api.TraceEventDurationEnd;
+    instant_ = embedder_api.TraceEventInstant;
+  }
+
+  static void BeginDuration(const char* name) {
+    if (auto begin = duration_begin_.load(std::memory_order_relaxed)) {
+      begin(name);
+    }
+  }
+
+  static void EndDuration(const char* name) {
+    if (auto end = duration_end_.load(std::memory_order_relaxed)) {
+      end(name);
+    }
+  }
+
+  static void Instant(const char* name) {
+    if (auto instant = instant_.load(std::memory_order_relaxed)) {
+      instant(name);
+    }
+  }
+
+ private:
+  static inline std::atomic<FlutterEngineTraceEventDurationBeginFnPtr>
+      duration_begin_ = nullptr;
+  static inline std::atomic<FlutterEngineTraceEventDurationEndFnPtr>
+      duration_end_ = nullptr;
+  static inline std::atomic<FlutterEngineTraceEventInstantFnPtr> instant_ =
+      nullptr;
+};
+
+// Records a duration event spanning the lifetime of this object.
+//
+// |name| must be a string literal since the engine may keep a reference to it.
+class TraceScope {
+ public:
+  explicit TraceScope(const char* name) : name_(name) {
+    Tracer::BeginDuration(name_);
+  }
+
+  ~TraceScope() { Tracer::EndDuration(name_); }
+
+  // Prevent copying.
+  TraceScope(const TraceScope&) = delete;
+  TraceScope& operator=(const TraceScope&) = delete;
+
+ private:
+  const char* name_;
+};
+
+}  // namespace flutter
+
+#define FT_TRACE_CONCAT_INTERNAL(a, b) a##b
+#define FT_TRACE_CONCAT(a, b) FT_TRACE_CONCAT_INTERNAL(a, b)
+
+#if defined(TRACING_SUPPORT)
+#define FT_TRACE_SCOPE(name) \
+  flutter::TraceScope FT_TRACE_CONCAT(trace_scope_, __LINE__)(name)
+#define FT_TRACE_EVENT_INSTANT(name) flutter::Tracer::Instant(name)
+#else
+#define FT_TRACE_SCOPE(name)
+#define FT_TRACE_EVENT_INSTANT(name) ((void)0)
+#endif
+
+#endif  // EMBEDDER_TRACER_H_
@@ -0,0 +1,124 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef UI_ACCESSIBILITY_AX_ATTRIBUTE_LIST_H_
+#define UI_ACCESSIBILITY_AX_ATTRIBUTE_LIST_H_
+
+#include <algorithm>
+#include <bitset>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace ui {
+
+// A sparse list of <attribute id, attribute value> pairs of one attribute
+// type, such as ax::mojom::IntAttribute, kept in insertion order.
+//
+// The presence of each attribute is also recorded in a bitset indexed by the
+// attribute id, so that checking for an attribute is O(1). Most lookups are
+// for attributes that aren't set and never scan the list; the lists of set
+// attributes are short.
+//
+// For reading, this behaves like the std::vector of pairs it stores.
+// Attributes are added and removed through Set() and Remove() so that the
+// bitset stays in sync.
+template <typename Attribute, typename Value>
+class AXAttributeList {
+ public:
+  using value_type = std::pair<Attribute, Value>;
+  using const_iterator = typename std::vector<value_type>::const_iterator;
+
+  AXAttributeList() = default;
+  AXAttributeList(const AXAttributeList& other) = default;
+  AXAttributeList& operator=(const AXAttributeList& other) = default;
+
+  // Leaves |other| empty.
+  AXAttributeList(AXAttributeList&& other) noexcept
+      : pairs_(std::move(other.pairs_)), present_(other.present_) {
+    other.clear();
+  }
+
+  AXAttributeList& operator=(AXAttributeList&& other) noexcept {
+    if (this != &other) {
+      pairs_ = std::move(other.pairs_);
+      present_ = other.present_;
+      other.clear();
+    }
+    return *this;
+  }
+
+  bool empty() const { return pairs_.empty(); }
+  size_t size() const { return pairs_.size(); }
+  const value_type& operator[](size_t index) const { return pairs_[index]; }
+  const_iterator begin() const { return pairs_.begin(); }
+  const_iterator end() const { return pairs_.end(); }
+
+  bool operator==(const AXAttributeList& other) const {
+    return pairs_ == other.pairs_;
+  }
+  bool operator!=(const AXAttributeList& other) const {
+    return !(*this == other);
+  }
+
+  void clear() {
+    pairs_.clear();
+    present_.reset();
+  }
+
+  bool Has(Attribute attribute) const { return present_[Index(attribute)]; }
+
+  // Returns the value of |attribute|, or nullptr if it isn't set.
+  const Value* Find(Attribute attribute) const {
+    if (!Has(attribute))
+      return nullptr;
+    return &FindPair(attribute)->second;
+  }
+
+  Value* Find(Attribute attribute) {
+    if (!Has(attribute))
+      return nullptr;
+    return &FindPair(attribute)->second;
+  }
+
+  // Appends |attribute|, removing its previous value if any.
+  void Set(Attribute attribute, Value value) {
+    Remove(attribute);
+    pairs_.emplace_back(attribute, std::move(value));
+    present_.set(Index(attribute));
+  }
+
+  void Remove(Attribute attribute) {
+    if (!Has(attribute))
+      return;
+    pairs_.erase(FindPair(attribute));
+    present_.reset(Index(attribute));
+  }
+
+ private:
+  static size_t Index(Attribute attribute) {
+    return static_cast<size_t>(attribute);
+  }
+
+  typename std::vector<value_type>::iterator FindPair(Attribute attribute) {
+    return std::find_if(pairs_.begin(), pairs_.end(),
+                        [attribute](const value_type& pair) {
+                          return pair.first == attribute;
+                        });
+  }
+
+  const_iterator FindPair(Attribute attribute) const {
+    return std::find_if(pairs_.begin(), pairs_.end(),
+                        [attribute](const value_type& pair) {
+                          return pair.first == attribute;
+                        });
+  }
+
+  std::vector<value_type> pairs_;
+  std::bitset<static_cast<size_t>(Attribute::kMaxValue) + 1> present_;
+};
+
+}  // namespace ui
+
+#endif  // UI_ACCESSIBILITY_AX_ATTRIBUTE_LIST_H_
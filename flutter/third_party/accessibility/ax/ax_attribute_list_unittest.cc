@@ -0,0 +1,144 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ax_attribute_list.h"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <utility>
+
+#include "gtest/gtest.h"
+
+#include "ax_enums.h"
+#include "ax_node_data.h"
+
+namespace ui {
+
+TEST(AXAttributeListTest, SetFindAndRemove) {
+  AXAttributeList<ax::mojom::IntAttribute, int32_t> list;
+  EXPECT_TRUE(list.empty());
+  EXPECT_FALSE(list.Has(ax::mojom::IntAttribute::kColor));
+  EXPECT_EQ(list.Find(ax::mojom::IntAttribute::kColor), nullptr);
+
+  list.Set(ax::mojom::IntAttribute::kColor, 1);
+  list.Set(ax::mojom::IntAttribute::kPosInSet, 2);
+  ASSERT_EQ(list.size(), 2u);
+  EXPECT_TRUE(list.Has(ax::mojom::IntAttribute::kColor));
+  ASSERT_NE(list.Find(ax::mojom::IntAttribute::kPosInSet), nullptr);
+  EXPECT_EQ(*list.Find(ax::mojom::IntAttribute::kPosInSet), 2);
+
+  // Replacing an attribute moves it to the end, as AXNodeData always did.
+  list.Set(ax::mojom::IntAttribute::kColor, 3);
+  ASSERT_EQ(list.size(), 2u);
+  EXPECT_EQ(list[0].first, ax::mojom::IntAttribute::kPosInSet);
+  EXPECT_EQ(list[1].first, ax::mojom::IntAttribute::kColor);
+  EXPECT_EQ(list[1].second, 3);
+
+  list.Remove(ax::mojom::IntAttribute::kPosInSet);
+  list.Remove(ax::mojom::IntAttribute::kSetSize);
+  EXPECT_EQ(list.size(), 1u);
+  EXPECT_FALSE(list.Has(ax::mojom::IntAttribute::kPosInSet));
+
+  list.clear();
+  EXPECT_TRUE(list.empty());
+  EXPECT_FALSE(list.Has(ax::mojom::IntAttribute::kColor));
+}
+
+TEST(AXAttributeListTest, CopyAndMove) {
+  AXAttributeList<ax::mojom::StringAttribute, std::string> list;
+  list.Set(ax::mojom::StringAttribute::kName, "name");
+
+  AXAttributeList<ax::mojom::StringAttribute, std::string> copy = list;
+  EXPECT_EQ(copy, list);
+  copy.Set(ax::mojom::StringAttribute::kValue, "value");
+  EXPECT_NE(copy, list);
+
+  AXAttributeList<ax::mojom::StringAttribute, std::string> moved =
+      std::move(copy);
+  EXPECT_TRUE(moved.Has(ax::mojom::StringAttribute::kValue));
+  // A moved-from list is empty and can be reused.
+  EXPECT_TRUE(copy.empty());
+  EXPECT_FALSE(copy.Has(ax::mojom::StringAttribute::kValue));
+  copy.Set(ax::mojom::StringAttribute::kValue, "other");
+  EXPECT_EQ(*copy.Find(ax::mojom::StringAttribute::kValue), "other");
+}
+
+namespace {
+
+// Fills |data| with the attributes typically set by the Flutter
+// accessibility bridge.
+void AddTypicalAttributes(AXNodeData& data) {
+  data.role = ax::mojom::Role::kButton;
+  data.SetName("label");
+  data.SetValue("value");
+  data.AddIntAttribute(ax::mojom::IntAttribute::kTextSelStart, -1);
+  data.AddIntAttribute(ax::mojom::IntAttribute::kTextSelEnd, -1);
+  data.AddIntAttribute(ax::mojom::IntAttribute::kCheckedState, 1);
+  data.AddBoolAttribute(ax::mojom::BoolAttribute::kScrollable, false);
+  data.AddBoolAttribute(ax::mojom::BoolAttribute::kClickable, true);
+  data.AddBoolAttribute(ax::mojom::BoolAttribute::kSelected, false);
+}
+
+template <typename Function>
+int64_t MeasureNanoseconds(int iterations, Function function) {
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) {
+    function();
+  }
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now() - start)
+             .count() /
+         iterations;
+}
+
+}  // namespace
+
+// Measures the attribute queries made when walking the tree, most of which
+// are for attributes that aren't set. Run with
+// --gtest_also_run_disabled_tests.
+TEST(AXAttributeListTest, DISABLED_LookupBenchmark) {
+  constexpr int kIterations = 1000000;
+  AXNodeData data;
+  AddTypicalAttributes(data);
+
+  int found = 0;
+  int64_t missing = MeasureNanoseconds(kIterations, [&data, &found]() {
+    found += data.HasIntAttribute(ax::mojom::IntAttribute::kHierarchicalLevel);
+    found += data.HasStringAttribute(ax::mojom::StringAttribute::kPlaceholder);
+    found += data.HasBoolAttribute(ax::mojom::BoolAttribute::kBusy);
+  });
+  int64_t present = MeasureNanoseconds(kIterations, [&data, &found]() {
+    found += data.GetIntAttribute(ax::mojom::IntAttribute::kCheckedState);
+    found += data.GetStringAttribute(ax::mojom::StringAttribute::kValue).size();
+    found += data.GetBoolAttribute(ax::mojom::BoolAttribute::kSelected);
+  });
+
+  std::cout << "Missing: " << missing << " ns, present: " << present
+            << " ns (" << found << ")" << std::endl;
+}
+
+// Measures building the node data of a typical node and replacing one of its
+// attributes.
+TEST(AXAttributeListTest, DISABLED_MutationBenchmark) {
+  constexpr int kIterations = 200000;
+
+  int64_t build = MeasureNanoseconds(kIterations, []() {
+    AXNodeData data;
+    AddTypicalAttributes(data);
+  });
+
+  AXNodeData data;
+  AddTypicalAttributes(data);
+  int32_t checked_state = 0;
+  int64_t replace = MeasureNanoseconds(kIterations, [&data, &checked_state]() {
+    data.AddIntAttribute(ax::mojom::IntAttribute::kCheckedState,
+                         checked_state++ % 3);
+  });
+
+  std::cout << "Build: " << build << " ns, replace: " << replace << " ns"
+            << std::endl;
+}
+
+}  // namespace ui
@@ -171,9 +171,24 @@ void AXEventGenerator::ClearEvents() {
   tree_events_.clear();
 }
 
+// static
+AXEventGenerator::EventSet AXEventGenerator::DefaultEnabledEvents() {
+  EventSet events;
+  events.set();
+  events.reset(static_cast<size_t>(Event::LOCATION_CHANGED));
+  return events;
+}
+
+void AXEventGenerator::SetEnabledEvents(const EventSet& events) {
+  enabled_events_ = events;
+}
+
 void AXEventGenerator::AddEvent(AXNode* node, AXEventGenerator::Event event) {
   BASE_DCHECK(node);
 
+  if (!ShouldRecordEvent(event))
+    return;
+
   if (node->data().role == ax::mojom::Role::kInlineTextBox)
     return;
 
@@ -191,13 +206,19 @@ void AXEventGenerator::OnNodeDataChanged(AXTree* tree,
   // node or a line break node, which enables us to determine character bounds
   // and line layout. We don't expose those to platform APIs, though, so
   // suppress CHILDREN_CHANGED events on static text nodes.
-  if (new_node_data.child_ids != old_node_data.child_ids &&
+  if (ShouldRecordEvent(Event::CHILDREN_CHANGED) &&
+      new_node_data.child_ids != old_node_data.child_ids &&
       !ui::IsText(new_node_data.role)) {
     AXNode* node = tree_->GetFromId(new_node_data.id);
     tree_events_[node].emplace(Event::CHILDREN_CHANGED,
                                ax::mojom::EventFrom::kNone,
                                tree_->event_intents());
   }
+
+  if (IsEventEnabled(Event::LOCATION_CHANGED) &&
+      new_node_data.relative_bounds != old_node_data.relative_bounds) {
+    AddEvent(tree_->GetFromId(new_node_data.id), Event::LOCATION_CHANGED);
+  }
 }
 
 void AXEventGenerator::OnRoleChanged(AXTree* tree,
@@ -613,7 +634,8 @@ void AXEventGenerator::OnAtomicUpdateFinished(
     if (change.type == SUBTREE_CREATED) {
       AddEvent(change.node, Event::SUBTREE_CREATED);
     } else if (change.type != NODE_CREATED) {
-      FireRelationSourceEvents(tree, change.node);
+      if (ShouldRecordEvent(Event::RELATED_NODE_CHANGED))
+        FireRelationSourceEvents(tree, change.node);
       continue;
     }
 
@@ -631,6 +653,10 @@ void AXEventGenerator::OnAtomicUpdateFinished(
 }
 
 void AXEventGenerator::FireLiveRegionEvents(AXNode* node) {
+  if (!ShouldRecordEvent(Event::LIVE_REGION_NODE_CHANGED) &&
+      !ShouldRecordEvent(Event::LIVE_REGION_CHANGED))
+    return;
+
   AXNode* live_root = node;
   while (live_root && !live_root->data().HasStringAttribute(
                           ax::mojom::StringAttribute::kLiveStatus))
@@ -878,6 +904,45 @@ void AXEventGenerator::PostprocessEvents() {
     else
       ++iter;
   }
+
+  // Done separately, as the loop above looks at the events of other nodes.
+  if (!enabled_events_.all())
+    RemoveDisabledEvents();
+}
+
+bool AXEventGenerator::ShouldRecordEvent(Event event) const {
+  if (IsEventEnabled(event))
+    return true;
+  switch (event) {
+    case Event::ALERT:
+    case Event::ENABLED_CHANGED:
+    case Event::IGNORED_CHANGED:
+    case Event::LIVE_REGION_CREATED:
+    case Event::SELECTED_CHANGED:
+    case Event::SUBTREE_CREATED:
+    case Event::TEXT_ATTRIBUTE_CHANGED:
+      return true;
+    default:
+      return false;
+  }
+}
+
+void AXEventGenerator::RemoveDisabledEvents() {
+  auto iter = tree_events_.begin();
+  while (iter != tree_events_.end()) {
+    std::set<EventParams>& node_events = iter->second;
+    for (auto event_iter = node_events.begin();
+         event_iter != node_events.end();) {
+      if (IsEventEnabled(event_iter->event))
+        ++event_iter;
+      else
+        event_iter = node_events.erase(event_iter);
+    }
+    if (node_events.empty())
+      iter = tree_events_.erase(iter);
+    else
+      ++iter;
+  }
 }
 
 // static
@@ -994,6 +1059,8 @@ const char* ToString(AXEventGenerator::Event event) {
       return "LOAD_COMPLETE";
     case AXEventGenerator::Event::LOAD_START:
       return "LOAD_START";
+    case AXEventGenerator::Event::LOCATION_CHANGED:
+      return "LOCATION_CHANGED";
     case AXEventGenerator::Event::MENU_ITEM_SELECTED:
       return "MENU_ITEM_SELECTED";
     case AXEventGenerator::Event::MULTILINE_STATE_CHANGED:
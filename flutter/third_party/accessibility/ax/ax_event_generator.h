@@ -67,6 +67,9 @@ class AX_EXPORT AXEventGenerator : public AXTreeObserver {
     LIVE_STATUS_CHANGED,
     LOAD_COMPLETE,
     LOAD_START,
+    // Fired when the bounds of a node change. Not generated by default, see
+    // DefaultEnabledEvents().
+    LOCATION_CHANGED,
     MENU_ITEM_SELECTED,
     MULTILINE_STATE_CHANGED,
     MULTISELECTABLE_STATE_CHANGED,
@@ -101,6 +104,13 @@ class AX_EXPORT AXEventGenerator : public AXTreeObserver {
     WIN_IACCESSIBLE_STATE_CHANGED,
   };
 
+  // The number of event types.
+  static constexpr size_t kEventCount =
+      static_cast<size_t>(Event::WIN_IACCESSIBLE_STATE_CHANGED) + 1;
+
+  // A set of event types, indexed by the value of each Event.
+  using EventSet = std::bitset<kEventCount>;
+
   // For distinguishing between show and hide state when a node has
   // IGNORED_CHANGED event.
   enum class IgnoredChangedState : uint8_t { kShow, kHide, kCount = 2 };
@@ -204,6 +214,22 @@ class AX_EXPORT AXEventGenerator : public AXTreeObserver {
     always_fire_load_complete_ = val;
   }
 
+  // Returns the events generated unless SetEnabledEvents is called: every
+  // event except LOCATION_CHANGED, which fires on every frame of an
+  // animation.
+  static EventSet DefaultEnabledEvents();
+
+  // Limits the generated events to |events|, so that platforms don't pay for
+  // events they ignore.
+  //
+  // Events are coalesced per node and type until ClearEvents is called,
+  // whether or not a subset is enabled.
+  void SetEnabledEvents(const EventSet& events);
+
+  bool IsEventEnabled(Event event) const {
+    return enabled_events_[static_cast<size_t>(event)];
+  }
+
  protected:
   // AXTreeObserver overrides.
   void OnNodeDataChanged(AXTree* tree,
@@ -277,6 +303,11 @@ class AX_EXPORT AXEventGenerator : public AXTreeObserver {
       std::map<AXNode*, IgnoredChangedStatesBitset>&
           ancestor_ignored_changed_map);
   void PostprocessEvents();
+  // Returns whether |event| needs to be recorded during an update, either
+  // because it is enabled or because PostprocessEvents depends on it.
+  bool ShouldRecordEvent(Event event) const;
+  // Removes the events that were only recorded for PostprocessEvents.
+  void RemoveDisabledEvents();
   static void GetRestrictionStates(ax::mojom::Restriction restriction,
                                    bool* is_enabled,
                                    bool* is_readonly);
@@ -294,6 +325,8 @@ class AX_EXPORT AXEventGenerator : public AXTreeObserver {
   std::vector<AXNode*> active_descendant_changed_;
 
   bool always_fire_load_complete_ = false;
+
+  EventSet enabled_events_ = DefaultEnabledEvents();
 };
 
 AX_EXPORT std::ostream& operator<<(std::ostream& os,
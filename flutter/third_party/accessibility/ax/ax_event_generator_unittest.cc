@@ -25,6 +25,10 @@ bool HasEvent(AXEventGenerator& src,
   return false;
 }
 
+size_t CountEvents(AXEventGenerator& src) {
+  return std::distance(src.begin(), src.end());
+}
+
 }  // namespace
 
 TEST(AXEventGeneratorTest, LoadCompleteSameTree) {
@@ -2208,4 +2212,110 @@ TEST(AXEventGeneratorTest, MultilineStateChanged) {
                        1));
 }
 
+TEST(AXEventGeneratorTest, CoalescesEventsPerNodeAndType) {
+  AXTreeUpdate initial_state;
+  initial_state.root_id = 1;
+  initial_state.nodes.resize(2);
+  initial_state.nodes[0].id = 1;
+  initial_state.nodes[0].child_ids.push_back(2);
+  initial_state.nodes[1].id = 2;
+
+  AXTree tree(initial_state);
+  AXEventGenerator event_generator(&tree);
+  AXTreeUpdate update = initial_state;
+
+  // Two updates before the events are cleared, as in one bridge commit.
+  update.nodes[1].SetName("First");
+  EXPECT_TRUE(tree.Unserialize(update));
+  size_t event_count = CountEvents(event_generator);
+  update.nodes[1].SetName("Second");
+  EXPECT_TRUE(tree.Unserialize(update));
+  EXPECT_TRUE(
+      HasEvent(event_generator, AXEventGenerator::Event::NAME_CHANGED, 2));
+  EXPECT_EQ(CountEvents(event_generator), event_count);
+}
+
+TEST(AXEventGeneratorTest, LocationChangedIsOnlyGeneratedIfEnabled) {
+  AXTreeUpdate initial_state;
+  initial_state.root_id = 1;
+  initial_state.nodes.resize(1);
+  initial_state.nodes[0].id = 1;
+  initial_state.nodes[0].relative_bounds.bounds = gfx::RectF(0, 0, 100, 100);
+
+  AXTree tree(initial_state);
+  AXEventGenerator event_generator(&tree);
+  EXPECT_FALSE(event_generator.IsEventEnabled(
+      AXEventGenerator::Event::LOCATION_CHANGED));
+  AXTreeUpdate update = initial_state;
+
+  update.nodes[0].relative_bounds.bounds = gfx::RectF(10, 0, 100, 100);
+  EXPECT_TRUE(tree.Unserialize(update));
+  EXPECT_EQ(CountEvents(event_generator), 0u);
+
+  AXEventGenerator::EventSet events =
+      AXEventGenerator::DefaultEnabledEvents();
+  events.set(static_cast<size_t>(AXEventGenerator::Event::LOCATION_CHANGED));
+  event_generator.SetEnabledEvents(events);
+  update.nodes[0].relative_bounds.bounds = gfx::RectF(20, 0, 100, 100);
+  EXPECT_TRUE(tree.Unserialize(update));
+  EXPECT_TRUE(
+      HasEvent(event_generator, AXEventGenerator::Event::LOCATION_CHANGED, 1));
+  EXPECT_EQ(CountEvents(event_generator), 1u);
+
+  event_generator.ClearEvents();
+  update.nodes[0].SetName("Name");
+  EXPECT_TRUE(tree.Unserialize(update));
+  EXPECT_FALSE(
+      HasEvent(event_generator, AXEventGenerator::Event::LOCATION_CHANGED, 1));
+}
+
+TEST(AXEventGeneratorTest, OnlyEnabledEventsAreGenerated) {
+  AXTreeUpdate initial_state;
+  initial_state.root_id = 1;
+  initial_state.nodes.resize(2);
+  initial_state.nodes[0].id = 1;
+  initial_state.nodes[0].child_ids.push_back(2);
+  initial_state.nodes[1].id = 2;
+
+  AXTree tree(initial_state);
+  AXEventGenerator event_generator(&tree);
+  AXEventGenerator::EventSet events;
+  events.set(static_cast<size_t>(AXEventGenerator::Event::NAME_CHANGED));
+  event_generator.SetEnabledEvents(events);
+  AXTreeUpdate update = initial_state;
+
+  update.nodes[0].child_ids.push_back(3);
+  update.nodes.resize(3);
+  update.nodes[1].SetName("Name");
+  update.nodes[1].SetCheckedState(ax::mojom::CheckedState::kTrue);
+  update.nodes[2].id = 3;
+  EXPECT_TRUE(tree.Unserialize(update));
+  EXPECT_TRUE(
+      HasEvent(event_generator, AXEventGenerator::Event::NAME_CHANGED, 2));
+  EXPECT_EQ(CountEvents(event_generator), 1u);
+}
+
+TEST(AXEventGeneratorTest, DisabledEventsStillSuppressOtherEvents) {
+  AXTreeUpdate initial_state;
+  initial_state.root_id = 1;
+  initial_state.nodes.resize(2);
+  initial_state.nodes[0].id = 1;
+  initial_state.nodes[0].child_ids.push_back(2);
+  initial_state.nodes[1].id = 2;
+
+  AXTree tree(initial_state);
+  AXEventGenerator event_generator(&tree);
+  AXEventGenerator::EventSet events;
+  events.set(static_cast<size_t>(AXEventGenerator::Event::NAME_CHANGED));
+  event_generator.SetEnabledEvents(events);
+  AXTreeUpdate update = initial_state;
+
+  // A node that becomes ignored doesn't fire NAME_CHANGED, even if
+  // IGNORED_CHANGED isn't generated.
+  update.nodes[1].SetName("Name");
+  update.nodes[1].AddState(ax::mojom::State::kIgnored);
+  EXPECT_TRUE(tree.Unserialize(update));
+  EXPECT_EQ(CountEvents(event_generator), 0u);
+}
+
 }  // namespace ui
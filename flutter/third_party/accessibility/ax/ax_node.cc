@@ -18,6 +18,30 @@
 
 namespace ui {
 
+namespace {
+
+bool HasSameIntAttribute(const AXNodeData& a,
+                         const AXNodeData& b,
+                         ax::mojom::IntAttribute attribute) {
+  int a_value = 0;
+  int b_value = 0;
+  bool a_has = a.GetIntAttribute(attribute, &a_value);
+  bool b_has = b.GetIntAttribute(attribute, &b_value);
+  return a_has == b_has && a_value == b_value;
+}
+
+// Returns true if |a| and |b| give the same bounds to a node and its
+// descendants. See AXTree::RelativeToTreeBoundsInternal.
+bool HasSameLocation(const AXNodeData& a, const AXNodeData& b) {
+  return a.relative_bounds == b.relative_bounds &&
+         HasSameIntAttribute(a, b, ax::mojom::IntAttribute::kScrollX) &&
+         HasSameIntAttribute(a, b, ax::mojom::IntAttribute::kScrollY) &&
+         a.GetBoolAttribute(ax::mojom::BoolAttribute::kClipsChildren) ==
+             b.GetBoolAttribute(ax::mojom::BoolAttribute::kClipsChildren);
+}
+
+}  // namespace
+
 constexpr AXNode::AXID AXNode::kInvalidAXID;
 
 AXNode::AXNode(AXNode::OwnerTree* tree,
@@ -28,7 +52,8 @@ AXNode::AXNode(AXNode::OwnerTree* tree,
     : tree_(tree),
       index_in_parent_(index_in_parent),
       unignored_index_in_parent_(unignored_index_in_parent),
-      parent_(parent) {
+      parent_(parent),
+      location_generation_(tree->IncrementLocationGeneration()) {
   data_.id = id;
 }
 
@@ -44,6 +69,15 @@ AXNodeData&& AXNode::TakeData() {
   return std::move(data_);
 }
 
+AXNodeData AXNode::ExchangeData(const AXNodeData& src) {
+  AXNodeData old_data = std::move(data_);
+  data_ = src;
+  if (!HasSameLocation(old_data, data_))
+    location_generation_ = tree_->IncrementLocationGeneration();
+  InvalidateTextCaches();
+  return old_data;
+}
+
 AXNode* AXNode::GetUnignoredChildAtIndex(size_t index) const {
   BASE_DCHECK(!tree_->GetTreeUpdateInProgressState());
   size_t count = 0;
@@ -371,12 +405,24 @@ bool AXNode::IsLineBreak() const {
 }
 
 void AXNode::SetData(const AXNodeData& src) {
+  if (!HasSameLocation(data_, src))
+    location_generation_ = tree_->IncrementLocationGeneration();
   data_ = src;
+  InvalidateTextCaches();
 }
 
 void AXNode::SetLocation(int32_t offset_container_id,
                          const gfx::RectF& location,
                          gfx::Transform* transform) {
+  const AXRelativeBounds& bounds = data_.relative_bounds;
+  if (bounds.offset_container_id == offset_container_id &&
+      bounds.bounds == location &&
+      (transform ? bounds.transform && *bounds.transform == *transform
+                 : !bounds.transform)) {
+    return;
+  }
+  location_generation_ = tree_->IncrementLocationGeneration();
+
   data_.relative_bounds.offset_container_id = offset_container_id;
   data_.relative_bounds.bounds = location;
   if (transform) {
@@ -398,10 +444,7 @@ void AXNode::UpdateUnignoredCachedValues() {
 
 void AXNode::SwapChildren(std::vector<AXNode*>* children) {
   children->swap(children_);
-}
-
-void AXNode::Destroy() {
-  delete this;
+  InvalidateTextCaches();
 }
 
 bool AXNode::IsDescendantOf(const AXNode* ancestor) const {
@@ -420,11 +463,16 @@ std::vector<int> AXNode::GetOrComputeLineStartOffsets() {
     return line_offsets;
   }
 
-  int start_offset = 0;
-  ComputeLineStartOffsets(&line_offsets, &start_offset);
-  data_.AddIntListAttribute(ax::mojom::IntListAttribute::kCachedLineStarts,
-                            line_offsets);
-  return line_offsets;
+  // The line starts are only valid as long as the text caches are, see
+  // InvalidateTextCaches.
+  ComputeTextCachesIfNeeded();
+  if (!has_line_start_offsets_) {
+    int start_offset = 0;
+    line_start_offsets_.clear();
+    ComputeLineStartOffsets(&line_start_offsets_, &start_offset);
+    has_line_start_offsets_ = true;
+  }
+  return line_start_offsets_;
 }
 
 void AXNode::ComputeLineStartOffsets(std::vector<int>* line_offsets,
@@ -453,6 +501,63 @@ void AXNode::ComputeLineStartOffsets(std::vector<int>* line_offsets,
   }
 }
 
+int AXNode::GetTextContentLengthUTF16() const {
+  ComputeTextCachesIfNeeded();
+  return text_length_;
+}
+
+int AXNode::GetChildTextOffsetUTF16(size_t child_index) const {
+  ComputeTextCachesIfNeeded();
+  if (text_length_ < 0)
+    return -1;
+  BASE_DCHECK(child_index < child_text_offsets_.size());
+  return child_text_offsets_[child_index];
+}
+
+void AXNode::ComputeTextCachesIfNeeded() const {
+  if (has_text_caches_)
+    return;
+
+  bool has_child_tree =
+      data().HasStringAttribute(ax::mojom::StringAttribute::kChildTreeId);
+  child_text_offsets_.resize(children().size() + 1);
+  child_text_offsets_[0] = 0;
+  for (size_t i = 0; i < children().size(); ++i) {
+    int child_length = children()[i]->GetTextContentLengthUTF16();
+    if (child_length < 0) {
+      has_child_tree = true;
+      child_length = 0;
+    }
+    child_text_offsets_[i + 1] = child_text_offsets_[i] + child_length;
+  }
+
+  // Matches AXNodePosition::MaxTextOffset.
+  int value_length = 0;
+  if (children().empty()) {
+    value_length = static_cast<int>(
+        data().GetString16Attribute(ax::mojom::StringAttribute::kValue).size());
+  }
+  if (has_child_tree) {
+    text_length_ = -1;
+  } else if (value_length) {
+    text_length_ = value_length;
+  } else if (IsText()) {
+    text_length_ = static_cast<int>(
+        data().GetString16Attribute(ax::mojom::StringAttribute::kName).size());
+  } else {
+    text_length_ = child_text_offsets_.back();
+  }
+  has_text_caches_ = true;
+}
+
+void AXNode::InvalidateTextCaches() {
+  for (AXNode* node = this; node && node->has_text_caches_;
+       node = node->parent_) {
+    node->has_text_caches_ = false;
+    node->has_line_start_offsets_ = false;
+  }
+}
+
 const std::string& AXNode::GetInheritedStringAttribute(
     ax::mojom::StringAttribute attribute) const {
   const AXNode* current_node = this;
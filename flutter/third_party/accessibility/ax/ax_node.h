@@ -69,6 +69,8 @@ class AX_EXPORT AXNode final {
     virtual Selection GetUnignoredSelection() const = 0;
     virtual bool GetTreeUpdateInProgressState() const = 0;
     virtual bool HasPaginationSupport() const = 0;
+    // See AXTree::IncrementLocationGeneration.
+    virtual uint64_t IncrementLocationGeneration() = 0;
   };
 
   template <typename NodeType,
@@ -113,9 +115,18 @@ class AX_EXPORT AXNode final {
   const std::vector<AXNode*>& children() const { return children_; }
   size_t index_in_parent() const { return index_in_parent_; }
 
+  // The location generation of the owner tree when the data positioning this
+  // node and its descendants last changed. This covers the node's relative
+  // bounds as well as its scroll offset and clipping. See
+  // AXTree::RelativeToTreeBounds.
+  uint64_t location_generation() const { return location_generation_; }
+
   // Returns ownership of |data_| to the caller; effectively clearing |data_|.
   AXNodeData&& TakeData();
 
+  // Replaces |data_| with |src| like |SetData| and returns the previous data.
+  AXNodeData ExchangeData(const AXNodeData& src);
+
   // Walking the tree skipping ignored nodes.
   size_t GetUnignoredChildCount() const;
   AXNode* GetUnignoredChildAtIndex(size_t index) const;
@@ -185,13 +196,6 @@ class AX_EXPORT AXNode final {
   // now owns all of the passed children.
   void SwapChildren(std::vector<AXNode*>* children);
 
-  // This is called when the AXTree no longer includes this node in the
-  // tree. Reference counting is used on some platforms because the
-  // operating system may hold onto a reference to an AXNode
-  // object even after we're through with it, so this may decrement the
-  // reference count and clear out the object's data.
-  void Destroy();
-
   // Return true if this object is equal to or a descendant of |ancestor|.
   bool IsDescendantOf(const AXNode* ancestor) const;
 
@@ -199,9 +203,24 @@ class AX_EXPORT AXNode final {
   AXNode* GetParentCrossingTreeBoundary() const;
 
   // Gets the text offsets where new lines start either from the node's data or
-  // by computing them and caching the result.
+  // by computing them and caching the result until the subtree changes.
   std::vector<int> GetOrComputeLineStartOffsets();
 
+  // Returns the length, in UTF-16 code units, of the text of this node as seen
+  // by text navigation: the value of a leaf node that has one, the name of a
+  // text node, or else the text of all its children. Returns -1 if the subtree
+  // hosts a child tree, whose text this tree doesn't know.
+  //
+  // Like GetChildTextOffsetUTF16, it's computed for the whole subtree at once
+  // and cached until the subtree changes.
+  int GetTextContentLengthUTF16() const;
+
+  // Returns the offset, in UTF-16 code units, at which the text of the child at
+  // |child_index| starts within the concatenated text of all children, or the
+  // length of that text if |child_index| is the child count. Returns -1 if the
+  // subtree hosts a child tree.
+  int GetChildTextOffsetUTF16(size_t child_index) const;
+
   // Accessing accessibility attributes.
   // See |AXNodeData| for more information.
 
@@ -454,6 +473,12 @@ class AX_EXPORT AXNode final {
   // leaf nodes.
   void ComputeLineStartOffsets(std::vector<int>* line_offsets,
                                int* start_offset) const;
+  // Fills in the text caches of this node and its descendants, unless they
+  // are up to date.
+  void ComputeTextCachesIfNeeded() const;
+  // Drops the text caches of this node and of its ancestors, whose text
+  // includes this node's.
+  void InvalidateTextCaches();
   AXTableInfo* GetAncestorTableInfo() const;
   void IdVectorToNodeVector(const std::vector<int32_t>& ids,
                             std::vector<AXNode*>* nodes) const;
@@ -469,6 +494,16 @@ class AX_EXPORT AXNode final {
   AXNode* const parent_;
   std::vector<AXNode*> children_;
   AXNodeData data_;
+  uint64_t location_generation_;
+
+  // The text caches. When they are valid for a node, they are valid for all
+  // its descendants too, so invalidation stops at the first invalid ancestor.
+  mutable bool has_text_caches_ = false;
+  mutable int text_length_ = 0;
+  // Prefix sums of the text lengths of the children, starting with 0.
+  mutable std::vector<int> child_text_offsets_;
+  mutable bool has_line_start_offsets_ = false;
+  mutable std::vector<int> line_start_offsets_;
 };
 
 AX_EXPORT std::ostream& operator<<(std::ostream& stream, const AXNode& node);
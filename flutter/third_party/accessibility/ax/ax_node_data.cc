@@ -12,7 +12,6 @@
 
 #include "ax_enum_util.h"
 #include "ax_role_properties.h"
-#include "base/container_utils.h"
 #include "base/logging.h"
 #include "base/no_destructor.h"
 #include "base/string_utils.h"
@@ -71,27 +70,6 @@ std::string IntVectorToString(const std::vector<int>& items) {
   return str;
 }
 
-// Predicate that returns true if the first value of a pair is |first|.
-template <typename FirstType, typename SecondType>
-struct FirstIs {
-  explicit FirstIs(FirstType first) : first_(first) {}
-  bool operator()(std::pair<FirstType, SecondType> const& p) {
-    return p.first == first_;
-  }
-  FirstType first_;
-};
-
-// Helper function that finds a key in a vector of pairs by matching on the
-// first value, and returns an iterator.
-template <typename FirstType, typename SecondType>
-typename std::vector<std::pair<FirstType, SecondType>>::const_iterator
-FindInVectorOfPairs(
-    FirstType first,
-    const std::vector<std::pair<FirstType, SecondType>>& vector) {
-  return std::find_if(vector.begin(), vector.end(),
-                      FirstIs<FirstType, SecondType>(first));
-}
-
 }  // namespace
 
 // Return true if |attr| is a node ID that would need to be mapped when
@@ -231,12 +209,12 @@ AXNodeData::AXNodeData(AXNodeData&& other) {
   role = other.role;
   state = other.state;
   actions = other.actions;
-  string_attributes.swap(other.string_attributes);
-  int_attributes.swap(other.int_attributes);
-  float_attributes.swap(other.float_attributes);
-  bool_attributes.swap(other.bool_attributes);
-  intlist_attributes.swap(other.intlist_attributes);
-  stringlist_attributes.swap(other.stringlist_attributes);
+  string_attributes = std::move(other.string_attributes);
+  int_attributes = std::move(other.int_attributes);
+  float_attributes = std::move(other.float_attributes);
+  bool_attributes = std::move(other.bool_attributes);
+  intlist_attributes = std::move(other.intlist_attributes);
+  stringlist_attributes = std::move(other.stringlist_attributes);
   html_attributes.swap(other.html_attributes);
   child_ids.swap(other.child_ids);
   relative_bounds = other.relative_bounds;
@@ -247,21 +225,20 @@ AXNodeData& AXNodeData::operator=(AXNodeData other) {
   role = other.role;
   state = other.state;
   actions = other.actions;
-  string_attributes = other.string_attributes;
-  int_attributes = other.int_attributes;
-  float_attributes = other.float_attributes;
-  bool_attributes = other.bool_attributes;
-  intlist_attributes = other.intlist_attributes;
-  stringlist_attributes = other.stringlist_attributes;
-  html_attributes = other.html_attributes;
-  child_ids = other.child_ids;
+  string_attributes = std::move(other.string_attributes);
+  int_attributes = std::move(other.int_attributes);
+  float_attributes = std::move(other.float_attributes);
+  bool_attributes = std::move(other.bool_attributes);
+  intlist_attributes = std::move(other.intlist_attributes);
+  stringlist_attributes = std::move(other.stringlist_attributes);
+  html_attributes = std::move(other.html_attributes);
+  child_ids = std::move(other.child_ids);
   relative_bounds = other.relative_bounds;
   return *this;
 }
 
 bool AXNodeData::HasBoolAttribute(ax::mojom::BoolAttribute attribute) const {
-  auto iter = FindInVectorOfPairs(attribute, bool_attributes);
-  return iter != bool_attributes.end();
+  return bool_attributes.Has(attribute);
 }
 
 bool AXNodeData::GetBoolAttribute(ax::mojom::BoolAttribute attribute) const {
@@ -273,9 +250,8 @@ bool AXNodeData::GetBoolAttribute(ax::mojom::BoolAttribute attribute) const {
 
 bool AXNodeData::GetBoolAttribute(ax::mojom::BoolAttribute attribute,
                                   bool* value) const {
-  auto iter = FindInVectorOfPairs(attribute, bool_attributes);
-  if (iter != bool_attributes.end()) {
-    *value = iter->second;
+  if (const auto* attribute_value = bool_attributes.Find(attribute)) {
+    *value = *attribute_value;
     return true;
   }
 
@@ -283,8 +259,7 @@ bool AXNodeData::GetBoolAttribute(ax::mojom::BoolAttribute attribute,
 }
 
 bool AXNodeData::HasFloatAttribute(ax::mojom::FloatAttribute attribute) const {
-  auto iter = FindInVectorOfPairs(attribute, float_attributes);
-  return iter != float_attributes.end();
+  return float_attributes.Has(attribute);
 }
 
 float AXNodeData::GetFloatAttribute(ax::mojom::FloatAttribute attribute) const {
@@ -296,9 +271,8 @@ float AXNodeData::GetFloatAttribute(ax::mojom::FloatAttribute attribute) const {
 
 bool AXNodeData::GetFloatAttribute(ax::mojom::FloatAttribute attribute,
                                    float* value) const {
-  auto iter = FindInVectorOfPairs(attribute, float_attributes);
-  if (iter != float_attributes.end()) {
-    *value = iter->second;
+  if (const auto* attribute_value = float_attributes.Find(attribute)) {
+    *value = *attribute_value;
     return true;
   }
 
@@ -306,8 +280,7 @@ bool AXNodeData::GetFloatAttribute(ax::mojom::FloatAttribute attribute,
 }
 
 bool AXNodeData::HasIntAttribute(ax::mojom::IntAttribute attribute) const {
-  auto iter = FindInVectorOfPairs(attribute, int_attributes);
-  return iter != int_attributes.end();
+  return int_attributes.Has(attribute);
 }
 
 int AXNodeData::GetIntAttribute(ax::mojom::IntAttribute attribute) const {
@@ -319,9 +292,8 @@ int AXNodeData::GetIntAttribute(ax::mojom::IntAttribute attribute) const {
 
 bool AXNodeData::GetIntAttribute(ax::mojom::IntAttribute attribute,
                                  int* value) const {
-  auto iter = FindInVectorOfPairs(attribute, int_attributes);
-  if (iter != int_attributes.end()) {
-    *value = static_cast<int>(iter->second);
+  if (const auto* attribute_value = int_attributes.Find(attribute)) {
+    *value = static_cast<int>(*attribute_value);
     return true;
   }
 
@@ -330,21 +302,19 @@ bool AXNodeData::GetIntAttribute(ax::mojom::IntAttribute attribute,
 
 bool AXNodeData::HasStringAttribute(
     ax::mojom::StringAttribute attribute) const {
-  auto iter = FindInVectorOfPairs(attribute, string_attributes);
-  return iter != string_attributes.end();
+  return string_attributes.Has(attribute);
 }
 
 const std::string& AXNodeData::GetStringAttribute(
     ax::mojom::StringAttribute attribute) const {
-  auto iter = FindInVectorOfPairs(attribute, string_attributes);
-  return iter != string_attributes.end() ? iter->second : base::EmptyString();
+  const std::string* value = string_attributes.Find(attribute);
+  return value ? *value : base::EmptyString();
 }
 
 bool AXNodeData::GetStringAttribute(ax::mojom::StringAttribute attribute,
                                     std::string* value) const {
-  auto iter = FindInVectorOfPairs(attribute, string_attributes);
-  if (iter != string_attributes.end()) {
-    *value = iter->second;
+  if (const auto* attribute_value = string_attributes.Find(attribute)) {
+    *value = *attribute_value;
     return true;
   }
 
@@ -370,24 +340,21 @@ bool AXNodeData::GetString16Attribute(ax::mojom::StringAttribute attribute,
 
 bool AXNodeData::HasIntListAttribute(
     ax::mojom::IntListAttribute attribute) const {
-  auto iter = FindInVectorOfPairs(attribute, intlist_attributes);
-  return iter != intlist_attributes.end();
+  return intlist_attributes.Has(attribute);
 }
 
 const std::vector<int32_t>& AXNodeData::GetIntListAttribute(
     ax::mojom::IntListAttribute attribute) const {
   static const base::NoDestructor<std::vector<int32_t>> empty_vector;
-  auto iter = FindInVectorOfPairs(attribute, intlist_attributes);
-  if (iter != intlist_attributes.end())
-    return iter->second;
+  if (const auto* value = intlist_attributes.Find(attribute))
+    return *value;
   return *empty_vector;
 }
 
 bool AXNodeData::GetIntListAttribute(ax::mojom::IntListAttribute attribute,
                                      std::vector<int32_t>* value) const {
-  auto iter = FindInVectorOfPairs(attribute, intlist_attributes);
-  if (iter != intlist_attributes.end()) {
-    *value = iter->second;
+  if (const auto* attribute_value = intlist_attributes.Find(attribute)) {
+    *value = *attribute_value;
     return true;
   }
 
@@ -396,25 +363,22 @@ bool AXNodeData::GetIntListAttribute(ax::mojom::IntListAttribute attribute,
 
 bool AXNodeData::HasStringListAttribute(
     ax::mojom::StringListAttribute attribute) const {
-  auto iter = FindInVectorOfPairs(attribute, stringlist_attributes);
-  return iter != stringlist_attributes.end();
+  return stringlist_attributes.Has(attribute);
 }
 
 const std::vector<std::string>& AXNodeData::GetStringListAttribute(
     ax::mojom::StringListAttribute attribute) const {
   static const base::NoDestructor<std::vector<std::string>> empty_vector;
-  auto iter = FindInVectorOfPairs(attribute, stringlist_attributes);
-  if (iter != stringlist_attributes.end())
-    return iter->second;
+  if (const auto* value = stringlist_attributes.Find(attribute))
+    return *value;
   return *empty_vector;
 }
 
 bool AXNodeData::GetStringListAttribute(
     ax::mojom::StringListAttribute attribute,
     std::vector<std::string>* value) const {
-  auto iter = FindInVectorOfPairs(attribute, stringlist_attributes);
-  if (iter != stringlist_attributes.end()) {
-    *value = iter->second;
+  if (const auto* attribute_value = stringlist_attributes.Find(attribute)) {
+    *value = *attribute_value;
     return true;
   }
 
@@ -447,93 +411,68 @@ bool AXNodeData::GetHtmlAttribute(const char* html_attr,
 void AXNodeData::AddStringAttribute(ax::mojom::StringAttribute attribute,
                                     const std::string& value) {
   BASE_DCHECK(attribute != ax::mojom::StringAttribute::kNone);
-  if (HasStringAttribute(attribute))
-    RemoveStringAttribute(attribute);
-  string_attributes.push_back(std::make_pair(attribute, value));
+  string_attributes.Set(attribute, value);
 }
 
 void AXNodeData::AddIntAttribute(ax::mojom::IntAttribute attribute, int value) {
   BASE_DCHECK(attribute != ax::mojom::IntAttribute::kNone);
-  if (HasIntAttribute(attribute))
-    RemoveIntAttribute(attribute);
-  int_attributes.push_back(std::make_pair(attribute, value));
+  int_attributes.Set(attribute, value);
 }
 
 void AXNodeData::AddFloatAttribute(ax::mojom::FloatAttribute attribute,
                                    float value) {
   BASE_DCHECK(attribute != ax::mojom::FloatAttribute::kNone);
-  if (HasFloatAttribute(attribute))
-    RemoveFloatAttribute(attribute);
-  float_attributes.push_back(std::make_pair(attribute, value));
+  float_attributes.Set(attribute, value);
 }
 
 void AXNodeData::AddBoolAttribute(ax::mojom::BoolAttribute attribute,
                                   bool value) {
   BASE_DCHECK(attribute != ax::mojom::BoolAttribute::kNone);
-  if (HasBoolAttribute(attribute))
-    RemoveBoolAttribute(attribute);
-  bool_attributes.push_back(std::make_pair(attribute, value));
+  bool_attributes.Set(attribute, value);
 }
 
 void AXNodeData::AddIntListAttribute(ax::mojom::IntListAttribute attribute,
                                      const std::vector<int32_t>& value) {
   BASE_DCHECK(attribute != ax::mojom::IntListAttribute::kNone);
-  if (HasIntListAttribute(attribute))
-    RemoveIntListAttribute(attribute);
-  intlist_attributes.push_back(std::make_pair(attribute, value));
+  intlist_attributes.Set(attribute, value);
 }
 
 void AXNodeData::AddStringListAttribute(
     ax::mojom::StringListAttribute attribute,
     const std::vector<std::string>& value) {
   BASE_DCHECK(attribute != ax::mojom::StringListAttribute::kNone);
-  if (HasStringListAttribute(attribute))
-    RemoveStringListAttribute(attribute);
-  stringlist_attributes.push_back(std::make_pair(attribute, value));
+  stringlist_attributes.Set(attribute, value);
 }
 
 void AXNodeData::RemoveStringAttribute(ax::mojom::StringAttribute attribute) {
   BASE_DCHECK(attribute != ax::mojom::StringAttribute::kNone);
-  base::EraseIf(string_attributes, [attribute](const auto& string_attribute) {
-    return string_attribute.first == attribute;
-  });
+  string_attributes.Remove(attribute);
 }
 
 void AXNodeData::RemoveIntAttribute(ax::mojom::IntAttribute attribute) {
   BASE_DCHECK(attribute != ax::mojom::IntAttribute::kNone);
-  base::EraseIf(int_attributes, [attribute](const auto& int_attribute) {
-    return int_attribute.first == attribute;
-  });
+  int_attributes.Remove(attribute);
 }
 
 void AXNodeData::RemoveFloatAttribute(ax::mojom::FloatAttribute attribute) {
   BASE_DCHECK(attribute != ax::mojom::FloatAttribute::kNone);
-  base::EraseIf(float_attributes, [attribute](const auto& float_attribute) {
-    return float_attribute.first == attribute;
-  });
+  float_attributes.Remove(attribute);
 }
 
 void AXNodeData::RemoveBoolAttribute(ax::mojom::BoolAttribute attribute) {
   BASE_DCHECK(attribute != ax::mojom::BoolAttribute::kNone);
-  base::EraseIf(bool_attributes, [attribute](const auto& bool_attribute) {
-    return bool_attribute.first == attribute;
-  });
+  bool_attributes.Remove(attribute);
 }
 
 void AXNodeData::RemoveIntListAttribute(ax::mojom::IntListAttribute attribute) {
   BASE_DCHECK(attribute != ax::mojom::IntListAttribute::kNone);
-  base::EraseIf(intlist_attributes, [attribute](const auto& intlist_attribute) {
-    return intlist_attribute.first == attribute;
-  });
+  intlist_attributes.Remove(attribute);
 }
 
 void AXNodeData::RemoveStringListAttribute(
     ax::mojom::StringListAttribute attribute) {
   BASE_DCHECK(attribute != ax::mojom::StringListAttribute::kNone);
-  base::EraseIf(stringlist_attributes,
-                [attribute](const auto& stringlist_attribute) {
-                  return stringlist_attribute.first == attribute;
-                });
+  stringlist_attributes.Remove(attribute);
 }
 
 AXNodeTextStyles AXNodeData::GetTextStyles() const {
@@ -575,17 +514,11 @@ void AXNodeData::SetName(const std::string& name) {
     BASE_UNREACHABLE();
   }
 
-  auto iter = std::find_if(string_attributes.begin(), string_attributes.end(),
-                           [](const auto& string_attribute) {
-                             return string_attribute.first ==
-                                    ax::mojom::StringAttribute::kName;
-                           });
-
-  if (iter == string_attributes.end()) {
-    string_attributes.push_back(
-        std::make_pair(ax::mojom::StringAttribute::kName, name));
+  if (std::string* value =
+          string_attributes.Find(ax::mojom::StringAttribute::kName)) {
+    *value = name;
   } else {
-    iter->second = name;
+    string_attributes.Set(ax::mojom::StringAttribute::kName, name);
   }
 
   if (HasIntAttribute(ax::mojom::IntAttribute::kNameFrom))
@@ -12,6 +12,7 @@
 #include <utility>
 #include <vector>
 
+#include "ax_attribute_list.h"
 #include "ax_base_export.h"
 #include "ax_enums.h"
 #include "ax_node_text_styles.h"
@@ -46,7 +47,8 @@ struct AX_BASE_EXPORT AXNodeData {
   // There are dozens of possible attributes for an accessibility node,
   // but only a few tend to apply to any one object, so we store them
   // in sparse arrays of <attribute id, attribute value> pairs, organized
-  // by type (bool, int, float, string, int list).
+  // by type (bool, int, float, string, int list). Each array also tracks
+  // which attributes are present, so the Has accessors are O(1).
   //
   // There are three accessors for each type of attribute: one that returns
   // true if the attribute is present and false if not, one that takes a
@@ -277,15 +279,13 @@ struct AX_BASE_EXPORT AXNodeData {
   ax::mojom::Role role;
   uint32_t state;
   uint64_t actions;
-  std::vector<std::pair<ax::mojom::StringAttribute, std::string>>
-      string_attributes;
-  std::vector<std::pair<ax::mojom::IntAttribute, int32_t>> int_attributes;
-  std::vector<std::pair<ax::mojom::FloatAttribute, float>> float_attributes;
-  std::vector<std::pair<ax::mojom::BoolAttribute, bool>> bool_attributes;
-  std::vector<std::pair<ax::mojom::IntListAttribute, std::vector<int32_t>>>
+  AXAttributeList<ax::mojom::StringAttribute, std::string> string_attributes;
+  AXAttributeList<ax::mojom::IntAttribute, int32_t> int_attributes;
+  AXAttributeList<ax::mojom::FloatAttribute, float> float_attributes;
+  AXAttributeList<ax::mojom::BoolAttribute, bool> bool_attributes;
+  AXAttributeList<ax::mojom::IntListAttribute, std::vector<int32_t>>
       intlist_attributes;
-  std::vector<
-      std::pair<ax::mojom::StringListAttribute, std::vector<std::string>>>
+  AXAttributeList<ax::mojom::StringListAttribute, std::vector<std::string>>
       stringlist_attributes;
   std::vector<std::pair<std::string, std::string>> html_attributes;
   std::vector<int32_t> child_ids;
@@ -98,6 +98,20 @@ int AXNodePosition::AnchorChildCount() const {
   return static_cast<int>(GetAnchor()->children().size());
 }
 
+int AXNodePosition::AnchorChildTextOffset(int child_index) const {
+  // The offsets cached by the anchor don't account for embedded object
+  // characters.
+  if (g_ax_embedded_object_behavior ==
+          AXEmbeddedObjectBehavior::kSuppressCharacter &&
+      GetAnchor() && child_index >= 0 &&
+      static_cast<size_t>(child_index) <= GetAnchor()->children().size()) {
+    int offset = GetAnchor()->GetChildTextOffsetUTF16(child_index);
+    if (offset >= 0)
+      return offset;
+  }
+  return AXPosition::AnchorChildTextOffset(child_index);
+}
+
 int AXNodePosition::AnchorUnignoredChildCount() const {
   if (!GetAnchor())
     return 0;
@@ -248,7 +262,8 @@ bool AXNodePosition::IsInWhiteSpace() const {
 // concatenating the strings in GetText() to then get their text length, we sum
 // the lengths of the individual strings. This is faster than concatenating the
 // strings first and then taking their length, especially when the process
-// is recursive.
+// is recursive. Unless embedded object characters are exposed, the anchor
+// caches the result.
 int AXNodePosition::MaxTextOffset() const {
   if (IsNullPosition())
     return INVALID_OFFSET;
@@ -258,6 +273,13 @@ int AXNodePosition::MaxTextOffset() const {
 
   const AXNode* anchor = GetAnchor();
   BASE_DCHECK(anchor);
+  if (g_ax_embedded_object_behavior ==
+      AXEmbeddedObjectBehavior::kSuppressCharacter) {
+    int text_length = anchor->GetTextContentLengthUTF16();
+    if (text_length >= 0)
+      return text_length;
+  }
+
   // TODO(nektar): Replace with PlatformChildCount when AXNodePosition and
   // BrowserAccessibilityPosition will make one.
   if (!AnchorChildCount()) {
@@ -44,6 +44,7 @@ class AX_EXPORT AXNodePosition : public AXPosition<AXNodePosition, AXNode> {
                    AXTreeID* tree_id,
                    AXNode::AXID* child_id) const override;
   int AnchorChildCount() const override;
+  int AnchorChildTextOffset(int child_index) const override;
   int AnchorUnignoredChildCount() const override;
   int AnchorIndexInParent() const override;
   int AnchorSiblingCount() const override;
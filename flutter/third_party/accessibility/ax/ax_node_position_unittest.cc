@@ -3,7 +3,9 @@
 // found in the LICENSE file.
 
 #include <algorithm>
+#include <chrono>
 #include <cstdint>
+#include <iostream>
 #include <memory>
 #include <string>
 #include <utility>
@@ -1107,6 +1109,217 @@ TEST_F(AXPositionTest, GetMaxTextOffsetAndGetTextWithGeneratedContent) {
             text_position->GetText());
 }
 
+TEST_F(AXPositionTest, GetMaxTextOffsetAfterSubtreeUpdate) {
+  // ++1 kRootWebArea
+  // ++++2 kGenericContainer
+  // ++++++3 kStaticText "some text"
+  // ++++4 kStaticText "more text"
+  AXNodeData root_data;
+  root_data.id = 1;
+  root_data.role = ax::mojom::Role::kRootWebArea;
+
+  AXNodeData container_data;
+  container_data.id = 2;
+  container_data.role = ax::mojom::Role::kGenericContainer;
+
+  AXNodeData text_data;
+  text_data.id = 3;
+  text_data.role = ax::mojom::Role::kStaticText;
+  text_data.SetName("some text");
+
+  AXNodeData more_text_data;
+  more_text_data.id = 4;
+  more_text_data.role = ax::mojom::Role::kStaticText;
+  more_text_data.SetName("more text");
+
+  root_data.child_ids = {2, 4};
+  container_data.child_ids = {3};
+
+  SetTree(CreateAXTree({root_data, container_data, text_data, more_text_data}));
+  AssertTextLengthEquals(GetTree(), root_data.id, 18);
+
+  // Only the text node is updated, yet the text lengths of its ancestors,
+  // which have been computed above, change too.
+  text_data.SetName("adjusted text");
+  AXTreeUpdate update;
+  update.nodes = {text_data};
+  ASSERT_TRUE(GetTree()->Unserialize(update));
+  AssertTextLengthEquals(GetTree(), container_data.id, 13);
+  AssertTextLengthEquals(GetTree(), root_data.id, 22);
+
+  AXNodeData new_text_data;
+  new_text_data.id = 5;
+  new_text_data.role = ax::mojom::Role::kStaticText;
+  new_text_data.SetName("new");
+  container_data.child_ids = {3, 5};
+  update.nodes = {container_data, new_text_data};
+  ASSERT_TRUE(GetTree()->Unserialize(update));
+  AssertTextLengthEquals(GetTree(), root_data.id, 25);
+
+  TestPositionType tree_position = AXNodePosition::CreateTreePosition(
+      GetTreeID(), root_data.id, 1 /* child_index */);
+  ASSERT_NE(nullptr, tree_position);
+  TestPositionType text_position = tree_position->AsTextPosition();
+  ASSERT_NE(nullptr, text_position);
+  EXPECT_EQ(16, text_position->text_offset());
+
+  text_position = AXNodePosition::CreateTextPosition(
+      GetTreeID(), more_text_data.id, 2 /* text_offset */,
+      ax::mojom::TextAffinity::kDownstream);
+  ASSERT_NE(nullptr, text_position);
+  text_position = text_position->CreateParentPosition();
+  ASSERT_NE(nullptr, text_position);
+  EXPECT_EQ(root_data.id, text_position->anchor_id());
+  EXPECT_EQ(18, text_position->text_offset());
+
+  container_data.child_ids = {5};
+  update.nodes = {container_data};
+  ASSERT_TRUE(GetTree()->Unserialize(update));
+  AssertTextLengthEquals(GetTree(), root_data.id, 12);
+}
+
+TEST_F(AXPositionTest, GetOrComputeLineStartOffsetsAfterSubtreeUpdate) {
+  // ++1 kRootWebArea
+  // ++++2 kGenericContainer
+  // ++++++3 kStaticText "Line 1"
+  // ++++++4 kStaticText "Line 2"
+  AXNodeData root_data;
+  root_data.id = 1;
+  root_data.role = ax::mojom::Role::kRootWebArea;
+
+  AXNodeData container_data;
+  container_data.id = 2;
+  container_data.role = ax::mojom::Role::kGenericContainer;
+
+  AXNodeData line_1_data;
+  line_1_data.id = 3;
+  line_1_data.role = ax::mojom::Role::kStaticText;
+  line_1_data.SetName("Line 1");
+
+  AXNodeData line_2_data;
+  line_2_data.id = 4;
+  line_2_data.role = ax::mojom::Role::kStaticText;
+  line_2_data.SetName("Line 2");
+
+  root_data.child_ids = {2};
+  container_data.child_ids = {3, 4};
+
+  SetTree(CreateAXTree({root_data, container_data, line_1_data, line_2_data}));
+  AXNode* root = GetTree()->root();
+  EXPECT_EQ(std::vector<int>{6}, root->GetOrComputeLineStartOffsets());
+
+  line_1_data.SetName("First line");
+  AXTreeUpdate update;
+  update.nodes = {line_1_data};
+  ASSERT_TRUE(GetTree()->Unserialize(update));
+  EXPECT_EQ(std::vector<int>{10}, root->GetOrComputeLineStartOffsets());
+
+  // A text object continuing the previous line doesn't start a new one.
+  line_2_data.AddIntAttribute(ax::mojom::IntAttribute::kPreviousOnLineId,
+                              line_1_data.id);
+  update.nodes = {line_2_data};
+  ASSERT_TRUE(GetTree()->Unserialize(update));
+  EXPECT_TRUE(root->GetOrComputeLineStartOffsets().empty());
+}
+
+// Measures text navigation in a document of many paragraphs, where every
+// step needs the text lengths of large subtrees. Run with
+// --gtest_also_run_disabled_tests.
+TEST_F(AXPositionTest, DISABLED_ParagraphTextBenchmark) {
+  constexpr int kParagraphs = 200;
+  constexpr int kTextsPerParagraph = 10;
+  constexpr int kIterations = 200;
+
+  // ++1 kRootWebArea
+  // ++++kParagraph
+  // ++++++kStaticText "Lorem ipsum "
+  // ++++++++kInlineTextBox "Lorem ipsum "
+  std::vector<AXNodeData> nodes(1);
+  nodes[0].id = 1;
+  nodes[0].role = ax::mojom::Role::kRootWebArea;
+  AXNode::AXID next_id = 2;
+  std::vector<AXNode::AXID> leaf_ids;
+  for (int i = 0; i < kParagraphs; ++i) {
+    AXNodeData paragraph;
+    paragraph.id = next_id++;
+    paragraph.role = ax::mojom::Role::kParagraph;
+    paragraph.AddBoolAttribute(ax::mojom::BoolAttribute::kIsLineBreakingObject,
+                               true);
+    nodes[0].child_ids.push_back(paragraph.id);
+    size_t paragraph_index = nodes.size();
+    nodes.push_back(paragraph);
+    for (int j = 0; j < kTextsPerParagraph; ++j) {
+      AXNodeData static_text;
+      static_text.id = next_id++;
+      static_text.role = ax::mojom::Role::kStaticText;
+      static_text.SetName("Lorem ipsum ");
+      AXNodeData inline_box;
+      inline_box.id = next_id++;
+      inline_box.role = ax::mojom::Role::kInlineTextBox;
+      inline_box.SetName("Lorem ipsum ");
+      inline_box.AddIntListAttribute(ax::mojom::IntListAttribute::kWordStarts,
+                                     std::vector<int32_t>{0, 6});
+      inline_box.AddIntListAttribute(ax::mojom::IntListAttribute::kWordEnds,
+                                     std::vector<int32_t>{5, 11});
+      static_text.child_ids.push_back(inline_box.id);
+      nodes[paragraph_index].child_ids.push_back(static_text.id);
+      leaf_ids.push_back(inline_box.id);
+      nodes.push_back(static_text);
+      nodes.push_back(inline_box);
+    }
+  }
+  SetTree(CreateAXTree(nodes));
+  const AXNode* root = GetTree()->root();
+
+  auto measure = [](auto function) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kIterations; ++i) {
+      function(i);
+    }
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now() - start)
+               .count() /
+           kIterations;
+  };
+
+  int checksum = 0;
+  // Finds the offset of a leaf's text within the document.
+  int64_t offset_in_root = measure([&](int i) {
+    TestPositionType position = AXNodePosition::CreateTextPosition(
+        GetTreeID(), leaf_ids[(i * 997) % leaf_ids.size()], 3,
+        ax::mojom::TextAffinity::kDownstream);
+    checksum += position->CreateAncestorPosition(root)->text_offset();
+  });
+  // Moves a few words from a leaf, converting through the document.
+  int64_t next_word = measure([&](int i) {
+    TestPositionType position = AXNodePosition::CreateTextPosition(
+        GetTreeID(), root->id(), (i * 7919) % (kParagraphs * 100),
+        ax::mojom::TextAffinity::kDownstream);
+    for (int j = 0; j < 5; ++j) {
+      position = position->CreateNextWordStartPosition(
+          AXBoundaryBehavior::CrossBoundary);
+    }
+    checksum += position->text_offset();
+  });
+  // Changes one leaf, then measures the document again.
+  int64_t after_update = measure([&](int i) {
+    AXNodeData leaf = GetTree()->GetFromId(leaf_ids[i])->data();
+    leaf.SetName(i % 2 ? "Lorem ipsum " : "Lorem ipsum dolor ");
+    AXTreeUpdate update;
+    update.nodes = {leaf};
+    ASSERT_TRUE(GetTree()->Unserialize(update));
+    checksum += AXNodePosition::CreateTextPosition(
+                    GetTreeID(), root->id(), 0,
+                    ax::mojom::TextAffinity::kDownstream)
+                    ->MaxTextOffset();
+  });
+
+  std::cout << "Offset in root: " << offset_in_root
+            << " us, next word: " << next_word
+            << " us, length after update: " << after_update << " us ("
+            << checksum << ")" << std::endl;
+}
+
 TEST_F(AXPositionTest, AtStartOfAnchorWithNullPosition) {
   TestPositionType null_position = AXNodePosition::CreateNullPosition();
   ASSERT_NE(nullptr, null_position);
@@ -1256,35 +1256,27 @@ class AXPosition {
     } else {
       BASE_DCHECK(copy->child_index_ >= 0);
       BASE_DCHECK(copy->child_index_ < copy->AnchorChildCount());
-      int new_offset = 0;
-      for (int i = 0; i <= child_index_; ++i) {
-        AXPositionInstance child = copy->CreateChildPositionAt(i);
+      int new_offset = copy->AnchorChildTextOffset(child_index_);
+      // If the current text offset is valid, we don't touch it to potentially
+      // allow converting from a text position to a tree position and back
+      // without losing information. Otherwise, if the text_offset is invalid,
+      // equals to 0 or is smaller than |new_offset|, we reset it to the
+      // beginning of the current child node.
+      if (copy->text_offset_ <= new_offset) {
+        copy->text_offset_ = new_offset;
+      } else {
+        AXPositionInstance child = copy->CreateChildPositionAt(child_index_);
         BASE_DCHECK(child);
-        // If the current text offset is valid, we don't touch it to
-        // potentially allow converting from a text position to a tree
-        // position and back without losing information. Otherwise, if the
-        // text_offset is invalid, equals to 0 or is smaller than
-        // |new_offset|, we reset it to the beginning of the current child
-        // node.
-        if (i == child_index_ && copy->text_offset_ <= new_offset) {
-          copy->text_offset_ = new_offset;
-          break;
-        }
-
         int child_length = child->MaxTextOffsetInParent();
         // Same comment as above: we don't touch the text offset if it's
         // already valid.
-        if (i == child_index_ &&
-            (copy->text_offset_ > (new_offset + child_length) ||
-             // When the text offset is equal to the text's length but this is
-             // not an "after text" position.
-             (!copy->AtEndOfAnchor() &&
-              copy->text_offset_ == (new_offset + child_length)))) {
+        if (copy->text_offset_ > (new_offset + child_length) ||
+            // When the text offset is equal to the text's length but this is
+            // not an "after text" position.
+            (!copy->AtEndOfAnchor() &&
+             copy->text_offset_ == (new_offset + child_length))) {
           copy->text_offset_ = new_offset;
-          break;
         }
-
-        new_offset += child_length;
       }
     }
 
@@ -3242,13 +3234,21 @@ class AXPosition {
     if (parent_position->IsNullPosition())
       return 0;
 
-    int offset_in_parent = 0;
-    for (int i = 0; i < parent_position->child_index(); ++i) {
-      AXPositionInstance child = parent_position->CreateChildPositionAt(i);
+    return parent_position->AnchorChildTextOffset(
+        parent_position->child_index());
+  }
+
+  // Returns the character offset inside our anchor at which the text of the
+  // child at |child_index| starts. Subclasses may override this to look the
+  // offset up instead of adding up the text lengths of the preceding children.
+  virtual int AnchorChildTextOffset(int child_index) const {
+    int offset = 0;
+    for (int i = 0; i < child_index; ++i) {
+      AXPositionInstance child = CreateChildPositionAt(i);
       BASE_DCHECK(child);
-      offset_in_parent += child->MaxTextOffsetInParent();
+      offset += child->MaxTextOffsetInParent();
     }
-    return offset_in_parent;
+    return offset;
   }
 
   void Initialize(AXPositionKind kind,
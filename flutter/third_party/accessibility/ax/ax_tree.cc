@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <new>
 #include <numeric>
 #include <utility>
 
@@ -22,6 +23,13 @@ namespace ui {
 
 namespace {
 
+// Ids below this index the dense id map. The ids assigned by the Flutter
+// framework stay below it.
+constexpr AXNode::AXID kMaxDenseNodeId = 1 << 16;
+
+// The number of nodes in each block of node storage.
+constexpr size_t kNodeBlockSize = 128;
+
 std::string TreeToStringHelper(const AXNode* node, int indent) {
   if (!node)
     return "";
@@ -35,8 +43,8 @@ std::string TreeToStringHelper(const AXNode* node, int indent) {
 }
 
 template <typename K, typename V>
-bool KeyValuePairsKeysMatch(std::vector<std::pair<K, V>> pairs1,
-                            std::vector<std::pair<K, V>> pairs2) {
+bool KeyValuePairsKeysMatch(const AXAttributeList<K, V>& pairs1,
+                            const AXAttributeList<K, V>& pairs2) {
   if (pairs1.size() != pairs2.size())
     return false;
   for (size_t i = 0; i < pairs1.size(); ++i) {
@@ -47,7 +55,7 @@ bool KeyValuePairsKeysMatch(std::vector<std::pair<K, V>> pairs1,
 }
 
 template <typename K, typename V>
-std::map<K, V> MapFromKeyValuePairs(std::vector<std::pair<K, V>> pairs) {
+std::map<K, V> MapFromKeyValuePairs(const AXAttributeList<K, V>& pairs) {
   std::map<K, V> result;
   for (size_t i = 0; i < pairs.size(); ++i)
     result[pairs[i].first] = pairs[i].second;
@@ -60,8 +68,8 @@ std::map<K, V> MapFromKeyValuePairs(std::vector<std::pair<K, V>> pairs) {
 // a call to the callback with the value changing from the previous value to
 // |empty_value|, and similarly when an attribute is added.
 template <typename K, typename V, typename F>
-void CallIfAttributeValuesChanged(const std::vector<std::pair<K, V>>& pairs1,
-                                  const std::vector<std::pair<K, V>>& pairs2,
+void CallIfAttributeValuesChanged(const AXAttributeList<K, V>& pairs1,
+                                  const AXAttributeList<K, V>& pairs2,
                                   const V& empty_value,
                                   F callback) {
   // Fast path - if they both have the same keys in the same order.
@@ -726,21 +734,76 @@ AXTreeID AXTree::GetAXTreeID() const {
 }
 
 AXNode* AXTree::GetFromId(int32_t id) const {
-  auto iter = id_map_.find(id);
-  return iter != id_map_.end() ? iter->second : nullptr;
+  if (id >= 0 && id < kMaxDenseNodeId) {
+    return static_cast<size_t>(id) < dense_id_map_.size() ? dense_id_map_[id]
+                                                          : nullptr;
+  }
+  auto iter = sparse_id_map_.find(id);
+  return iter != sparse_id_map_.end() ? iter->second : nullptr;
+}
+
+void AXTree::SetNodeForId(AXNode::AXID id, AXNode* node) {
+  if (id >= 0 && id < kMaxDenseNodeId) {
+    if (static_cast<size_t>(id) >= dense_id_map_.size()) {
+      if (!node)
+        return;
+      dense_id_map_.resize(id + 1, nullptr);
+    }
+    AXNode*& entry = dense_id_map_[id];
+    node_count_ += (node != nullptr) - (entry != nullptr);
+    entry = node;
+    return;
+  }
+  if (node) {
+    node_count_ += sparse_id_map_.insert_or_assign(id, node).second;
+  } else {
+    node_count_ -= sparse_id_map_.erase(id);
+  }
+}
+
+void* AXTree::AllocateNodeStorage() {
+  if (!free_node_storage_.empty()) {
+    NodeStorage* storage = free_node_storage_.back();
+    free_node_storage_.pop_back();
+    return storage;
+  }
+  if (node_blocks_.empty() || last_node_block_used_ == kNodeBlockSize) {
+    node_blocks_.push_back(std::make_unique<NodeStorage[]>(kNodeBlockSize));
+    last_node_block_used_ = 0;
+  }
+  return &node_blocks_.back()[last_node_block_used_++];
+}
+
+void AXTree::FreeNode(AXNode* node) {
+  node->~AXNode();
+  free_node_storage_.push_back(reinterpret_cast<NodeStorage*>(node));
 }
 
 void AXTree::Destroy() {
   table_info_map_.clear();
   if (root_) {
-    RecursivelyNotifyNodeDeletedForTreeTeardown(root_);
+    if (!observers_.empty())
+      RecursivelyNotifyNodeDeletedForTreeTeardown(root_);
     base::AutoReset<bool> update_state_resetter(&tree_update_in_progress_,
                                                 true);
-    DestroyNodeAndSubtree(root_, nullptr);
+    FreeSubtreeForTreeTeardown(root_);
     root_ = nullptr;
+    dense_id_map_.clear();
+    sparse_id_map_.clear();
+    node_count_ = 0;
+    int_reverse_relations_.clear();
+    intlist_reverse_relations_.clear();
+    child_tree_id_reverse_map_.clear();
+    tree_bounds_cache_.clear();
   }
 }
 
+void AXTree::FreeSubtreeForTreeTeardown(AXNode* node) {
+  for (AXNode* child : node->children())
+    FreeSubtreeForTreeTeardown(child);
+  FreeNode(node);
+}
+
 void AXTree::UpdateData(const AXTreeData& new_data) {
   if (data_ == new_data)
     return;
@@ -909,8 +972,59 @@ gfx::RectF AXTree::RelativeToTreeBounds(const AXNode* node,
                                         bool* offscreen,
                                         bool clip_bounds) const {
   bool allow_recursion = true;
-  return RelativeToTreeBoundsInternal(node, bounds, offscreen, clip_bounds,
-                                      allow_recursion);
+  // Only the bounds of whole nodes are cached, and never during an update,
+  // when the tree may be in a bad state.
+  if (bounds.width() != 0 || bounds.height() != 0 ||
+      GetTreeUpdateInProgressState()) {
+    return RelativeToTreeBoundsInternal(node, bounds, offscreen, clip_bounds,
+                                        allow_recursion);
+  }
+
+  CachedTreeBounds& cached = tree_bounds_cache_[node->id()][clip_bounds];
+  if (cached.generation != 0 &&
+      IsCachedTreeBoundsValid(node, cached.generation)) {
+    cached.generation = location_generation_;
+  } else {
+    bool node_offscreen = false;
+    cached.bounds = RelativeToTreeBoundsInternal(
+        node, bounds, &node_offscreen, clip_bounds, allow_recursion);
+    cached.offscreen = node_offscreen;
+    cached.generation = CanCacheTreeBounds(node) ? location_generation_ : 0;
+  }
+  if (offscreen != nullptr && cached.offscreen)
+    *offscreen = true;
+  return cached.bounds;
+}
+
+bool AXTree::CanCacheTreeBounds(const AXNode* node) const {
+  // The bounds of an empty node are computed from its children.
+  if (node->data().relative_bounds.bounds.IsEmpty())
+    return false;
+  // Cached bounds are validated against the node's ancestors, so the offset
+  // container of every node up to the root must be its parent or, if unset,
+  // the root.
+  for (; node != nullptr; node = node->parent()) {
+    int32_t offset_container_id =
+        node->data().relative_bounds.offset_container_id;
+    if (offset_container_id == -1)
+      continue;
+    if (node->parent() ? offset_container_id != node->parent()->id()
+                       : offset_container_id != node->id())
+      return false;
+  }
+  return true;
+}
+
+bool AXTree::IsCachedTreeBoundsValid(const AXNode* node,
+                                     uint64_t generation) const {
+  // Nothing has moved since.
+  if (generation == location_generation_)
+    return true;
+  for (; node != nullptr; node = node->parent()) {
+    if (node->location_generation() > generation)
+      return false;
+  }
+  return true;
 }
 
 gfx::RectF AXTree::GetTreeBounds(const AXNode* node,
@@ -1258,9 +1372,9 @@ AXNode* AXTree::CreateNode(AXNode* parent,
   update_state->new_node_ids.insert(id);
   // If this node is the root, use the given index_in_parent as the unignored
   // index in parent to provide consistency with index_in_parent.
-  AXNode* new_node = new AXNode(this, parent, id, index_in_parent,
-                                parent ? 0 : index_in_parent);
-  id_map_[new_node->id()] = new_node;
+  AXNode* new_node = new (AllocateNodeStorage()) AXNode(
+      this, parent, id, index_in_parent, parent ? 0 : index_in_parent);
+  SetNodeForId(new_node->id(), new_node);
   return new_node;
 }
 
@@ -1475,12 +1589,15 @@ bool AXTree::UpdateNode(const AXNodeData& src,
   if (node) {
     update_state->pending_nodes.erase(node->id());
     UpdateReverseRelations(node, src);
+    // The old data is kept, so exchange rather than take it. This lets the
+    // node tell whether its location changed.
     if (!update_state->IsCreatedNode(node) ||
         update_state->IsReparentedNode(node)) {
       update_state->old_node_id_to_data.insert(
-          std::make_pair(node->id(), node->TakeData()));
+          std::make_pair(node->id(), node->ExchangeData(src)));
+    } else {
+      node->SetData(src);
     }
-    node->SetData(src);
   } else {
     if (!is_new_root) {
       error_ = base::StringPrintf("%d is not in the tree and not the new root",
@@ -1864,7 +1981,8 @@ void AXTree::DestroyNodeAndSubtree(AXNode* node,
   empty_data.id = node->id();
   UpdateReverseRelations(node, empty_data);
 
-  id_map_.erase(node->id());
+  SetNodeForId(node->id(), nullptr);
+  tree_bounds_cache_.erase(node->id());
   for (auto* child : node->children())
     DestroyNodeAndSubtree(child, update_state);
   if (update_state) {
@@ -1878,7 +1996,7 @@ void AXTree::DestroyNodeAndSubtree(AXNode* node,
           std::make_pair(node->id(), node->TakeData()));
     }
   }
-  node->Destroy();
+  FreeNode(node);
 }
 
 void AXTree::DeleteOldChildren(AXNode* node,
@@ -2472,4 +2590,8 @@ bool AXTree::HasPaginationSupport() const {
   return has_pagination_support_;
 }
 
+uint64_t AXTree::IncrementLocationGeneration() {
+  return ++location_generation_;
+}
+
 }  // namespace ui
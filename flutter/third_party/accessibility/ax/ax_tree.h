@@ -5,6 +5,7 @@
 #ifndef UI_ACCESSIBILITY_AX_TREE_H_
 #define UI_ACCESSIBILITY_AX_TREE_H_
 
+#include <array>
 #include <cstdint>
 #include <map>
 #include <memory>
@@ -83,6 +84,8 @@ class AX_EXPORT AXTree : public AXNode::OwnerTree {
   // to false: this method may get called multiple times in a row and
   // |offscreen| will be propagated.
   // If |clip_bounds| is true, result bounds will be clipped.
+  // The bounds of a whole node, when |node_bounds| is uninitialized, are
+  // cached until the location of the node or of one of its ancestors changes.
   gfx::RectF RelativeToTreeBounds(const AXNode* node,
                                   gfx::RectF node_bounds,
                                   bool* offscreen = nullptr,
@@ -133,7 +136,7 @@ class AX_EXPORT AXTree : public AXNode::OwnerTree {
   // for testing and debugging.
   const std::string& error() const { return error_; }
 
-  int size() { return static_cast<int>(id_map_.size()); }
+  int size() { return node_count_; }
 
   // Call this to enable support for extra Mac nodes - for each table,
   // a table column header and a node for each column.
@@ -163,6 +166,10 @@ class AX_EXPORT AXTree : public AXNode::OwnerTree {
   // Returns true if the tree represents a paginated document
   bool HasPaginationSupport() const override;
 
+  // AXNode::OwnerTree override.
+  // Returns a new location generation for a node whose location changed.
+  uint64_t IncrementLocationGeneration() override;
+
   // A list of intents active during a tree update/unserialization.
   const std::vector<AXEventIntent>& event_intents() const {
     return event_intents_;
@@ -188,6 +195,20 @@ class AX_EXPORT AXTree : public AXNode::OwnerTree {
                      size_t index_in_parent,
                      AXTreeUpdateState* update_state);
 
+  // Returns the storage for a new node, reusing the storage of a destroyed
+  // node if there is one.
+  void* AllocateNodeStorage();
+
+  // Destroys |node| and makes its storage available to new nodes.
+  void FreeNode(AXNode* node);
+
+  // Adds |node| to the id map, or removes the node |id| if |node| is null.
+  void SetNodeForId(AXNode::AXID id, AXNode* node);
+
+  // Frees |node| and its subtree without updating the id map or the reverse
+  // relations, which the caller clears when tearing down the tree.
+  void FreeSubtreeForTreeTeardown(AXNode* node);
+
   // Accumulates the work that will be required to update the AXTree.
   // This allows us to notify observers of structure changes when the
   // tree is still in a stable and unchanged state.
@@ -264,8 +285,8 @@ class AX_EXPORT AXTree : public AXNode::OwnerTree {
   // information in |update_state|, then calls DestroyNodeAndSubtree on it.
   void DestroySubtree(AXNode* node, AXTreeUpdateState* update_state);
 
-  // Call Destroy() on |node|, and delete it from the id map, and then
-  // call recursively on all nodes in its subtree.
+  // Delete |node| from the id map and free it, after calling recursively on
+  // all nodes in its subtree.
   void DestroyNodeAndSubtree(AXNode* node, AXTreeUpdateState* update_state);
 
   // Iterate over the children of |node| and for each child, destroy the
@@ -292,9 +313,36 @@ class AX_EXPORT AXTree : public AXNode::OwnerTree {
                                           bool clip_bounds,
                                           bool allow_recursion) const;
 
+  // Returns true if the bounds of |node| only depend on the location of the
+  // node and its ancestors, so that they can be cached.
+  bool CanCacheTreeBounds(const AXNode* node) const;
+
+  // Returns true if neither |node| nor any of its ancestors have moved since
+  // the location generation |generation|.
+  bool IsCachedTreeBoundsValid(const AXNode* node, uint64_t generation) const;
+
   std::vector<AXTreeObserver*> observers_;
   AXNode* root_ = nullptr;
-  std::unordered_map<int32_t, AXNode*> id_map_;
+
+  // Map from node ID to node. Flutter assigns small non-negative ids, which
+  // index |dense_id_map_| directly. Other ids, such as the negative ids of
+  // internal nodes, are kept in |sparse_id_map_|.
+  std::vector<AXNode*> dense_id_map_;
+  std::unordered_map<int32_t, AXNode*> sparse_id_map_;
+  int node_count_ = 0;
+
+  // The storage of nodes is allocated in blocks, so that nodes created
+  // together, such as the children of a node, stay close to each other in
+  // memory. The storage of destroyed nodes is reused before allocating a new
+  // block, and blocks are only released with the tree.
+  struct NodeStorage {
+    alignas(AXNode) unsigned char bytes[sizeof(AXNode)];
+  };
+  std::vector<std::unique_ptr<NodeStorage[]>> node_blocks_;
+  // The number of nodes allocated from the last block in |node_blocks_|.
+  size_t last_node_block_used_ = 0;
+  std::vector<NodeStorage*> free_node_storage_;
+
   std::string error_;
   AXTreeData data_;
 
@@ -383,6 +431,22 @@ class AX_EXPORT AXTree : public AXNode::OwnerTree {
   // Indicates if the tree represents a paginated document
   bool has_pagination_support_ = false;
 
+  // Incremented whenever the location of a node changes.
+  uint64_t location_generation_ = 0;
+
+  // The bounds of a node returned by RelativeToTreeBounds.
+  struct CachedTreeBounds {
+    // The location generation at which |bounds| were last known to be valid,
+    // or 0 if they aren't cached.
+    uint64_t generation = 0;
+    gfx::RectF bounds;
+    bool offscreen = false;
+  };
+
+  // Map from node ID to the cached bounds of the node, unclipped and clipped.
+  mutable std::unordered_map<AXNode::AXID, std::array<CachedTreeBounds, 2>>
+      tree_bounds_cache_;
+
   std::vector<AXEventIntent> event_intents_;
 };
 
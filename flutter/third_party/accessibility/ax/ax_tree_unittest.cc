@@ -4,8 +4,11 @@
 
 #include "ax_tree.h"
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <iostream>
+#include <limits>
 #include <memory>
 
 #include "ax_enum_util.h"
@@ -1420,6 +1423,59 @@ TEST(AXTreeTest, GetBoundsWithScrolling) {
   EXPECT_EQ("(115, 70) size (50 x 5)", GetBoundsAsString(tree, 3));
 }
 
+// Test that the cached bounds of a node are updated when the node or one of
+// its ancestors moves, and only then.
+TEST(AXTreeTest, GetBoundsAfterLocationChanges) {
+  AXTreeUpdate tree_update;
+  tree_update.root_id = 1;
+  tree_update.nodes.resize(4);
+  tree_update.nodes[0].id = 1;
+  tree_update.nodes[0].relative_bounds.bounds = gfx::RectF(0, 0, 800, 600);
+  tree_update.nodes[0].child_ids = {2, 4};
+  tree_update.nodes[1].id = 2;
+  tree_update.nodes[1].relative_bounds.bounds = gfx::RectF(100, 50, 600, 500);
+  tree_update.nodes[1].child_ids = {3};
+  tree_update.nodes[2].id = 3;
+  tree_update.nodes[2].relative_bounds.offset_container_id = 2;
+  tree_update.nodes[2].relative_bounds.bounds = gfx::RectF(20, 30, 50, 5);
+  tree_update.nodes[3].id = 4;
+  tree_update.nodes[3].relative_bounds.bounds = gfx::RectF(0, 0, 10, 10);
+
+  AXTree tree(tree_update);
+  AXNode* node2 = tree.GetFromId(2);
+  AXNode* node4 = tree.GetFromId(4);
+  EXPECT_EQ("(120, 80) size (50 x 5)", GetBoundsAsString(tree, 3));
+
+  // Changes other than the location don't move a node.
+  uint64_t generation = node4->location_generation();
+  AXTreeUpdate name_update;
+  name_update.nodes.resize(1);
+  name_update.nodes[0] = tree_update.nodes[3];
+  name_update.nodes[0].SetName("name");
+  ASSERT_TRUE(tree.Unserialize(name_update)) << tree.error();
+  EXPECT_EQ(generation, node4->location_generation());
+  node4->SetLocation(-1, gfx::RectF(0, 0, 10, 10), nullptr);
+  EXPECT_EQ(generation, node4->location_generation());
+
+  // Scrolling a container moves its descendants.
+  AXTreeUpdate scroll_update;
+  scroll_update.nodes.resize(1);
+  scroll_update.nodes[0] = tree_update.nodes[1];
+  scroll_update.nodes[0].AddIntAttribute(ax::mojom::IntAttribute::kScrollX, 5);
+  scroll_update.nodes[0].AddIntAttribute(ax::mojom::IntAttribute::kScrollY,
+                                         10);
+  generation = node2->location_generation();
+  ASSERT_TRUE(tree.Unserialize(scroll_update)) << tree.error();
+  EXPECT_LT(generation, node2->location_generation());
+  EXPECT_EQ("(115, 70) size (50 x 5)", GetBoundsAsString(tree, 3));
+
+  gfx::Transform transform;
+  transform.Scale(2.0, 2.0);
+  node2->SetLocation(-1, gfx::RectF(200, 50, 600, 500), &transform);
+  EXPECT_EQ("(430, 140) size (100 x 10)", GetBoundsAsString(tree, 3));
+  EXPECT_EQ("(0, 0) size (10 x 10)", GetBoundsAsString(tree, 4));
+}
+
 // When a node has zero size, we try to get the bounds from an ancestor.
 TEST(AXTreeTest, GetBoundsOfNodeWithZeroSize) {
   AXTreeUpdate tree_update;
@@ -4723,4 +4779,139 @@ TEST(AXTreeTest, TestIsInListMarker) {
   ASSERT_EQ(false, inline_node2->IsInListMarker());
 }
 
+TEST(AXTreeTest, GetFromIdOutsideDenseIdRange) {
+  // Ids that are negative or too large to index the dense id map directly.
+  const int32_t large_id = 1 << 20;
+  const int32_t max_id = std::numeric_limits<int32_t>::max();
+  AXTreeUpdate initial_state;
+  initial_state.root_id = 1;
+  initial_state.nodes.resize(4);
+  initial_state.nodes[0].id = 1;
+  initial_state.nodes[0].child_ids = {large_id, -5, max_id};
+  initial_state.nodes[1].id = large_id;
+  initial_state.nodes[2].id = -5;
+  initial_state.nodes[3].id = max_id;
+  AXTree tree(initial_state);
+  EXPECT_EQ(tree.size(), 4);
+  EXPECT_EQ(tree.GetFromId(large_id)->id(), large_id);
+  EXPECT_EQ(tree.GetFromId(-5)->id(), -5);
+  EXPECT_EQ(tree.GetFromId(max_id)->id(), max_id);
+  EXPECT_EQ(tree.GetFromId(2), nullptr);
+  EXPECT_EQ(tree.GetFromId(large_id + 1), nullptr);
+
+  AXTreeUpdate update;
+  update.nodes.resize(2);
+  update.nodes[0].id = 1;
+  update.nodes[0].child_ids = {-5, 2};
+  update.nodes[1].id = 2;
+  ASSERT_TRUE(tree.Unserialize(update));
+  EXPECT_EQ(tree.size(), 3);
+  EXPECT_EQ(tree.GetFromId(large_id), nullptr);
+  EXPECT_EQ(tree.GetFromId(max_id), nullptr);
+  EXPECT_EQ(tree.GetFromId(-5)->id(), -5);
+  EXPECT_EQ(tree.GetFromId(2)->id(), 2);
+}
+
+// Measures building, looking up, traversing, updating and tearing down trees
+// shaped like a Flutter list: a root with ignored rows of three cells each.
+// Run with --gtest_also_run_disabled_tests.
+TEST(AXTreeTest, DISABLED_LargeTreeBenchmark) {
+  auto elapsed_us = [](std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now() - start)
+        .count();
+  };
+  auto make_row = [](AXTreeUpdate& update, int32_t row_id) {
+    AXNodeData row;
+    row.id = row_id;
+    row.role = ax::mojom::Role::kGenericContainer;
+    row.AddState(ax::mojom::State::kIgnored);
+    for (int32_t cell_id = row_id + 1; cell_id <= row_id + 3; cell_id++) {
+      row.child_ids.push_back(cell_id);
+    }
+    update.nodes.push_back(row);
+    for (int32_t cell_id : row.child_ids) {
+      AXNodeData cell;
+      cell.id = cell_id;
+      cell.role = ax::mojom::Role::kStaticText;
+      cell.SetName("Cell " + std::to_string(cell_id));
+      update.nodes.push_back(cell);
+    }
+  };
+
+  for (int32_t row_count : {2500, 12500}) {
+    AXTreeUpdate initial_state;
+    initial_state.root_id = 1;
+    AXNodeData root;
+    root.id = 1;
+    root.role = ax::mojom::Role::kRootWebArea;
+    for (int32_t row = 0; row < row_count; row++) {
+      root.child_ids.push_back(2 + row * 4);
+    }
+    initial_state.nodes.push_back(root);
+    for (int32_t row_id : root.child_ids) {
+      make_row(initial_state, row_id);
+    }
+    int32_t node_count = 1 + row_count * 4;
+
+    auto start = std::chrono::steady_clock::now();
+    auto tree = std::make_unique<AXTree>(initial_state);
+    int64_t build_us = elapsed_us(start);
+    ASSERT_EQ(tree->size(), node_count);
+
+    start = std::chrono::steady_clock::now();
+    size_t found = 0;
+    for (int round = 0; round < 20; round++) {
+      for (int32_t id = 1; id <= node_count; id++) {
+        found += tree->GetFromId(id) != nullptr;
+      }
+    }
+    int64_t lookup_us = elapsed_us(start);
+    EXPECT_EQ(found, 20u * node_count);
+
+    start = std::chrono::steady_clock::now();
+    size_t unignored = 0;
+    for (int round = 0; round < 20; round++) {
+      for (auto it = tree->root()->UnignoredChildrenBegin();
+           it != tree->root()->UnignoredChildrenEnd(); ++it) {
+        unignored += 1 + it->GetUnignoredChildCount();
+      }
+    }
+    int64_t traverse_us = elapsed_us(start);
+    EXPECT_EQ(unignored, 20u * row_count * 3);
+
+    // Replaces every other row with a row of new nodes, as scrolling does.
+    AXTreeUpdate update;
+    root.child_ids.clear();
+    for (int32_t row = 0; row < row_count; row++) {
+      int32_t row_id = 2 + row * 4;
+      if (row % 2) {
+        row_id += node_count;
+        make_row(update, row_id);
+      }
+      root.child_ids.push_back(row_id);
+    }
+    update.nodes.insert(update.nodes.begin(), root);
+    start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(tree->Unserialize(update));
+    int64_t update_us = elapsed_us(start);
+    ASSERT_EQ(tree->size(), node_count);
+
+    struct DeletionCounter : public AXTreeObserver {
+      void OnNodeDeleted(AXTree* tree, int32_t node_id) override { count++; }
+      int32_t count = 0;
+    } counter;
+    tree->AddObserver(&counter);
+    start = std::chrono::steady_clock::now();
+    tree.reset();
+    int64_t teardown_us = elapsed_us(start);
+    EXPECT_EQ(counter.count, node_count);
+
+    std::cout << node_count << " nodes: build " << build_us << " us, lookup "
+              << lookup_us << " us, traverse " << traverse_us
+              << " us, update " << update_us << " us, teardown "
+              << teardown_us << " us" << std::endl;
+  }
+}
+
 }  // namespace ui
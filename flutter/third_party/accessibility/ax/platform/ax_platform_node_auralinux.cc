@@ -594,15 +594,41 @@ const GInterfaceInfo Info = {reinterpret_cast<GInterfaceInitFunc>(Init),
 
 namespace atk_action {
 
+// The actions exposed after the default one, if the node supports them.
+struct NamedAction {
+  const char* name;
+  ax::mojom::Action action;
+};
+
+constexpr NamedAction kNamedActions[] = {
+    {"increment", ax::mojom::Action::kIncrement},
+    {"decrement", ax::mojom::Action::kDecrement},
+    {"scroll_up", ax::mojom::Action::kScrollUp},
+    {"scroll_down", ax::mojom::Action::kScrollDown},
+    {"scroll_left", ax::mojom::Action::kScrollLeft},
+    {"scroll_right", ax::mojom::Action::kScrollRight},
+};
+
+// Returns the named action at |index|, counting from 1 as 0 is the default
+// action, or nullptr if |obj| doesn't support that many actions.
+const NamedAction* GetNamedAction(AXPlatformNodeAuraLinux* obj, gint index) {
+  for (const NamedAction& named_action : kNamedActions) {
+    if (obj->GetData().HasAction(named_action.action) && --index == 0)
+      return &named_action;
+  }
+  return nullptr;
+}
+
 gboolean DoAction(AtkAction* atk_action, gint index) {
   g_return_val_if_fail(ATK_IS_ACTION(atk_action), FALSE);
   // TODO(JSUYA): The index of DoAction is the number of the action that can be
   // called. If there is no action that can be called in atk, the index is
-  // passed as -1. Currently, our AXPlatformNode only supports default actions,
-  // so we need to distinguish between -1 and numbers greater than 0. In Tizen,
-  // the DoActionName function in atk causes this problem. Since at-spi2-atk in
-  // tizen is not under our management scope, we temporarily return immediately
-  // when it is -1 to prevent unnecessary error messages.
+  // passed as -1. Our AXPlatformNode only supports the default action and the
+  // named actions above, so we need to distinguish between -1 and numbers
+  // greater than 0. In Tizen, the DoActionName function in atk causes this
+  // problem. Since at-spi2-atk in tizen is not under our management scope, we
+  // temporarily return immediately when it is -1 to prevent unnecessary error
+  // messages.
   if (index < 0)
     return FALSE;
 
@@ -612,7 +638,17 @@ gboolean DoAction(AtkAction* atk_action, gint index) {
   if (!obj)
     return FALSE;
 
-  return obj->DoDefaultAction();
+  if (index == 0)
+    return obj->DoDefaultAction();
+
+  const NamedAction* named_action = GetNamedAction(obj, index);
+  if (!named_action)
+    return FALSE;
+
+  AXActionData data;
+  data.action = named_action->action;
+  data.target_node_id = obj->GetData().id;
+  return obj->GetDelegate()->AccessibilityPerformAction(data);
 }
 
 gint GetNActions(AtkAction* atk_action) {
@@ -624,7 +660,12 @@ gint GetNActions(AtkAction* atk_action) {
   if (!obj)
     return 0;
 
-  return 1;
+  gint count = 1;
+  for (const NamedAction& named_action : kNamedActions) {
+    if (obj->GetData().HasAction(named_action.action))
+      count++;
+  }
+  return count;
 }
 
 const gchar* GetDescription(AtkAction*, gint) {
@@ -635,7 +676,7 @@ const gchar* GetDescription(AtkAction*, gint) {
 
 const gchar* GetName(AtkAction* atk_action, gint index) {
   g_return_val_if_fail(ATK_IS_ACTION(atk_action), nullptr);
-  g_return_val_if_fail(!index, nullptr);
+  g_return_val_if_fail(index >= 0, nullptr);
 
   AtkObject* atk_object = ATK_OBJECT(atk_action);
   AXPlatformNodeAuraLinux* obj =
@@ -643,17 +684,22 @@ const gchar* GetName(AtkAction* atk_action, gint index) {
   if (!obj)
     return nullptr;
 
-  return kActivateActionName;
+  if (index == 0)
+    return kActivateActionName;
+
+  const NamedAction* named_action = GetNamedAction(obj, index);
+  return named_action ? named_action->name : nullptr;
 }
 
 const gchar* GetKeybinding(AtkAction* atk_action, gint index) {
   g_return_val_if_fail(ATK_IS_ACTION(atk_action), nullptr);
-  g_return_val_if_fail(!index, nullptr);
+  g_return_val_if_fail(index >= 0, nullptr);
 
   AtkObject* atk_object = ATK_OBJECT(atk_action);
   AXPlatformNodeAuraLinux* obj =
       AXPlatformNodeAuraLinux::FromAtkObject(atk_object);
-  if (!obj)
+  // The access key only triggers the default action.
+  if (!obj || index)
     return nullptr;
 
   return obj->GetStringAttribute(ax::mojom::StringAttribute::kAccessKey)
@@ -3990,6 +4036,17 @@ void AXPlatformNodeAuraLinux::OnAlertShown() {
                                  ATK_STATE_SHOWING, TRUE);
 }
 
+void AXPlatformNodeAuraLinux::OnLocationChanged() {
+  AtkObject* atk_object = GetOrCreateAtkObject();
+  if (!atk_object || !ATK_IS_COMPONENT(atk_object))
+    return;
+
+  gfx::Rect extents = GetExtentsRelativeToAtkCoordinateType(ATK_XY_SCREEN);
+  AtkRectangle rect = {extents.x(), extents.y(), extents.width(),
+                       extents.height()};
+  g_signal_emit_by_name(atk_object, "bounds-changed", &rect);
+}
+
 void AXPlatformNodeAuraLinux::RunPostponedEvents() {
   if (window_activate_event_postponed_) {
     OnWindowActivated();
@@ -227,6 +227,7 @@ class AX_EXPORT AXPlatformNodeAuraLinux : public AXPlatformNodeBase {
   void OnWindowVisibilityChanged();
   void OnScrolledToAnchor();
   void OnAlertShown();
+  void OnLocationChanged();
   void RunPostponedEvents();
 
   void ResendFocusSignalsForCurrentlyFocusedNode();
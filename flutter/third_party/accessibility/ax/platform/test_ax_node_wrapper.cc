@@ -376,14 +376,7 @@ void TestAXNodeWrapper::ReplaceIntAttribute(int32_t node_id,
     return;
 
   AXNodeData new_data = node->data();
-  std::vector<std::pair<ax::mojom::IntAttribute, int32_t>>& attributes =
-      new_data.int_attributes;
-
-  auto it = std::remove_if(
-      attributes.begin(), attributes.end(),
-      [attribute](auto& pair) { return pair.first == attribute; });
-  attributes.erase(it, attributes.end());
-
+  new_data.RemoveIntAttribute(attribute);
   new_data.AddIntAttribute(attribute, value);
   node->SetData(new_data);
 }
@@ -392,14 +385,7 @@ void TestAXNodeWrapper::ReplaceFloatAttribute(
     ax::mojom::FloatAttribute attribute,
     float value) {
   AXNodeData new_data = GetData();
-  std::vector<std::pair<ax::mojom::FloatAttribute, float>>& attributes =
-      new_data.float_attributes;
-
-  auto it = std::remove_if(
-      attributes.begin(), attributes.end(),
-      [attribute](auto& pair) { return pair.first == attribute; });
-  attributes.erase(it, attributes.end());
-
+  new_data.RemoveFloatAttribute(attribute);
   new_data.AddFloatAttribute(attribute, value);
   node_->SetData(new_data);
 }
@@ -407,14 +393,7 @@ void TestAXNodeWrapper::ReplaceFloatAttribute(
 void TestAXNodeWrapper::ReplaceBoolAttribute(ax::mojom::BoolAttribute attribute,
                                              bool value) {
   AXNodeData new_data = GetData();
-  std::vector<std::pair<ax::mojom::BoolAttribute, bool>>& attributes =
-      new_data.bool_attributes;
-
-  auto it = std::remove_if(
-      attributes.begin(), attributes.end(),
-      [attribute](auto& pair) { return pair.first == attribute; });
-  attributes.erase(it, attributes.end());
-
+  new_data.RemoveBoolAttribute(attribute);
   new_data.AddBoolAttribute(attribute, value);
   node_->SetData(new_data);
 }
@@ -423,14 +402,7 @@ void TestAXNodeWrapper::ReplaceStringAttribute(
     ax::mojom::StringAttribute attribute,
     std::string value) {
   AXNodeData new_data = GetData();
-  std::vector<std::pair<ax::mojom::StringAttribute, std::string>>& attributes =
-      new_data.string_attributes;
-
-  auto it = std::remove_if(
-      attributes.begin(), attributes.end(),
-      [attribute](auto& pair) { return pair.first == attribute; });
-  attributes.erase(it, attributes.end());
-
+  new_data.RemoveStringAttribute(attribute);
   new_data.AddStringAttribute(attribute, value);
   node_->SetData(new_data);
 }
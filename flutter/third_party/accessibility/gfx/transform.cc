@@ -93,15 +93,15 @@ void Transform::Scale(float x, float y) {
 void Transform::TransformRect(RectF* rect) const {
   if (IsIdentity())
     return;
-  PointF origin = rect->origin();
-  PointF top_right = rect->top_right();
-  PointF bottom_left = rect->bottom_left();
-  TransformPoint(&origin);
-  TransformPoint(&top_right);
-  TransformPoint(&bottom_left);
-  rect->set_origin(origin);
-  rect->set_width(top_right.x() - origin.x());
-  rect->set_height(bottom_left.y() - origin.y());
+  // Only the 2D affine part of the matrix is applied, as in TransformPoint.
+  // Instead of mapping the origin, top right and bottom left corners, map
+  // the origin and scale the size: the width spans the mapped top edge along
+  // x and the height the mapped left edge along y.
+  float x = rect->x();
+  float y = rect->y();
+  rect->SetRect(x * matrix_[0] + y * matrix_[1] + matrix_[2],
+                x * matrix_[4] + y * matrix_[5] + matrix_[6],
+                rect->width() * matrix_[0], rect->height() * matrix_[5]);
 }
 
 void Transform::TransformPoint(PointF* point) const {